@@ -0,0 +1,336 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#ifndef Aeon2D_Audio_AsyncAudioBackend_H_
+#define Aeon2D_Audio_AsyncAudioBackend_H_
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <atomic>
+#include <thread>
+
+#include "../Utils/RingBuffer.h"
+#include "AudioBackend.h"
+
+namespace ae
+{
+	/// <summary>
+	/// Audio backend forwarding the calls to another backend owned by an audio thread<para/>
+	///
+	/// The calls made on the game thread are turned into commands pushed in a wait-free <see cref="RingBuffer"/>, they never wait for the audio thread.<br/>
+	/// The status and the playing position of the sources are mirrored on the game thread: they're updated straight away by the calls
+	/// and then refreshed by the audio thread once it has applied them.<br/>
+	/// When the ring buffer is full the commands are kept aside and handed over by the following calls (querying a status included).<br/>
+	/// The sources are identified before the audio thread has created them, a stream that can't be opened therefore remains stopped instead of returning 0.
+	/// </summary>
+	/// <code>
+	/// ae::SoftwareAudioBackend softwareBackend;
+	/// ae::AsyncAudioBackend backend(softwareBackend);
+	/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer(backend);
+	/// </code>
+	class AsyncAudioBackend : public AudioBackend
+	{
+	public:
+		/// <summary>Constructs the <see cref="AsyncAudioBackend"/> by providing the <paramref name="backend"/> to own and starts its audio thread</summary>
+		/// <param name="backend">The audio backend that will only be used by the audio thread (it must outlive the <see cref="AsyncAudioBackend"/>)</param>
+		/// <param name="maxSources">The maximum amount of sources existing at the same time</param>
+		/// <param name="commandCapacity">The amount of preallocated commands</param>
+		explicit AsyncAudioBackend(AudioBackend& backend, std::size_t maxSources = 4096, std::size_t commandCapacity = 8192);
+		/// <summary>Applies the remaining commands, stops the audio thread and destroys the sources that are still alive</summary>
+		virtual ~AsyncAudioBackend();
+	public:
+		/// <summary>Queues the creation of a source playing a sound <paramref name="buffer"/></summary>
+		/// <param name="buffer">The sound buffer to play</param>
+		/// <returns>The identifier of the new source, 0 if the maximum amount of sources has been reached</returns>
+		virtual SourceID createSound(const sf::SoundBuffer& buffer) override;
+		/// <summary>Queues the creation of a source streaming the audio file located at the <paramref name="filepath"/> provided</summary>
+		/// <param name="filepath">The audio file's filepath</param>
+		/// <returns>The identifier of the new source, 0 if the maximum amount of sources has been reached</returns>
+		virtual SourceID createStream(const std::string& filepath) override;
+		/// <summary>Queues the creation of a source streaming the audio file held by a region of memory, which must remain alive as long as the source exists</summary>
+		/// <param name="data">The first byte of the audio file</param>
+		/// <param name="size">The size of the audio file in bytes</param>
+		/// <returns>The identifier of the new source, 0 if the maximum amount of sources has been reached</returns>
+		virtual SourceID createStream(const void* data, std::size_t size) override;
+		/// <summary>Queues the creation of a source streaming the audio file read by a custom <paramref name="stream"/>, handed over to the owned backend</summary>
+		/// <param name="stream">The stream reading the audio file</param>
+		/// <returns>The identifier of the new source, 0 if the maximum amount of sources has been reached</returns>
+		virtual SourceID createStream(std::unique_ptr<sf::InputStream> stream) override;
+		/// <summary>
+		/// Queues the creation of a source streaming the stems located at the <paramref name="filepaths"/> provided as the layers of a single source<para/>
+		///
+		/// The layered stream is created by the owned backend, its source stays silent if the owned backend doesn't support layered streams.
+		/// </summary>
+		/// <param name="filepaths">The stems' filepaths, one per layer</param>
+		/// <returns>The identifier of the new source, 0 if the maximum amount of sources has been reached</returns>
+		virtual SourceID createLayeredStream(const std::vector<std::string>& filepaths) override;
+		/// <summary>Checks if the owned backend creates layered streams</summary>
+		/// <returns>True if the owned backend supports layered streams, false otherwise</returns>
+		virtual bool supportsLayeredStreams() const override;
+		/// <summary>Queues the destruction of a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		virtual void destroySource(SourceID source) override;
+		/// <summary>Queues the playing of a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		virtual void play(SourceID source) override;
+		/// <summary>Queues the playing of a source when the audio clock reaches the <paramref name="clockTime"/> provided</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="clockTime">The time of the audio clock at which the source starts</param>
+		virtual void playAt(SourceID source, sf::Time clockTime) override;
+		/// <summary>
+		/// Queues the chaining of the <paramref name="next"/> source to a source<para/>
+		///
+		/// The chain is forwarded to the owned backend, the next source is only started after the source if the owned backend supports it.
+		/// </summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="next">The identifier of the stopped source started after it, 0 to remove the chain</param>
+		/// <returns>True if the source exists, false otherwise</returns>
+		virtual bool chain(SourceID source, SourceID next) override;
+		/// <summary>Queues the pausing of a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		virtual void pause(SourceID source) override;
+		/// <summary>Queues the stopping of a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		virtual void stop(SourceID source) override;
+		/// <summary>Queues whether a source restarts from its beginning once it reaches its end</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="flag">True to put the source on loop, false otherwise</param>
+		virtual void setLoop(SourceID source, bool flag) override;
+		/// <summary>Queues the new <paramref name="volume"/> of a source (0 - 100)</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="volume">The new volume of the source</param>
+		virtual void setVolume(SourceID source, float volume) override;
+		/// <summary>Queues the ramp of the fade gain (0 - 1) of a source to the <paramref name="gain"/> provided over a <paramref name="duration"/></summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="gain">The fade gain reached at the end of the ramp</param>
+		/// <param name="duration">The duration of the ramp (zero to apply the <paramref name="gain"/> straight away)</param>
+		/// <param name="stop">True to stop the source once the ramp ends (i.e. a fade-out)</param>
+		virtual void fade(SourceID source, float gain, sf::Time duration, bool stop) override;
+		/// <summary>Queues the ramp of the gain (0 - 1) of a <paramref name="layer"/> of a layered stream to the <paramref name="gain"/> provided over a <paramref name="duration"/></summary>
+		/// <param name="source">The identifier of the layered stream</param>
+		/// <param name="layer">The index of the layer (the index of its stem)</param>
+		/// <param name="gain">The gain reached at the end of the ramp</param>
+		/// <param name="duration">The duration of the ramp (zero to apply the <paramref name="gain"/> straight away)</param>
+		virtual void setLayerGain(SourceID source, std::size_t layer, float gain, sf::Time duration) override;
+		/// <summary>Queues the new <paramref name="properties"/> of a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="properties">The <see cref="AudioProperties"/> to apply</param>
+		virtual void setProperties(SourceID source, const AudioProperties& properties) override;
+		/// <summary>Queues the new 3D <paramref name="position"/> of a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="position">The new 3D position of the source</param>
+		virtual void setPosition(SourceID source, const sf::Vector3f& position) override;
+		/// <summary>Queues the new playing position of a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="offset">The new playing position from the beginning of the source</param>
+		virtual void setPlayingOffset(SourceID source, sf::Time offset) override;
+		/// <summary>Retrieves the mirrored playing position of a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <returns>The playing position from the beginning of the source</returns>
+		virtual sf::Time getPlayingOffset(SourceID source) const override;
+		/// <summary>Retrieves the mirrored status of a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <returns>The status of the source, sf::SoundSource::Status::Stopped if it doesn't exist</returns>
+		virtual sf::SoundSource::Status getStatus(SourceID source) const override;
+		/// <summary>Queues the new 3D <paramref name="position"/> of the listener</summary>
+		/// <param name="position">The new 3D position of the listener</param>
+		virtual void setListenerPosition(const sf::Vector3f& position) override;
+		/// <summary>Retrieves the 3D position of the listener</summary>
+		/// <returns>The 3D position of the listener</returns>
+		virtual sf::Vector3f getListenerPosition() const override;
+		/// <summary>Retrieves the maximum amount of sound sources that should be playing at the same time</summary>
+		/// <returns>The maximum amount of sources of the owned backend, limited to the maximum amount of sources of the <see cref="AsyncAudioBackend"/></returns>
+		virtual std::size_t getMaxSources() const override;
+		/// <summary>Retrieves the audio clock of the owned backend</summary>
+		/// <returns>The current time of the audio clock</returns>
+		virtual sf::Time getAudioClock() const override;
+		/// <summary>Queues the creation of a submix of the owned backend, its identifier is given straight away</summary>
+		/// <param name="parent">The identifier of the parent submix, 0 for the output</param>
+		/// <returns>The identifier of the new submix</returns>
+		virtual SubmixID createSubmix(SubmixID parent) override;
+		/// <summary>Queues the destruction of a submix</summary>
+		/// <param name="submix">The identifier of the submix</param>
+		virtual void destroySubmix(SubmixID submix) override;
+		/// <summary>Queues the change of the <paramref name="parent"/> of a submix</summary>
+		/// <param name="submix">The identifier of the submix</param>
+		/// <param name="parent">The identifier of the new parent submix, 0 for the output</param>
+		virtual void setSubmixParent(SubmixID submix, SubmixID parent) override;
+		/// <summary>Queues the change of the <paramref name="effects"/> processing a submix</summary>
+		/// <param name="submix">The identifier of the submix</param>
+		/// <param name="effects">The effect chain, nullptr to remove it</param>
+		virtual void setSubmixEffects(SubmixID submix, EffectChain* effects) override;
+		/// <summary>Queues the routing of a source to a <paramref name="submix"/></summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="submix">The identifier of the submix, 0 for the output</param>
+		virtual void setSourceSubmix(SourceID source, SubmixID submix) override;
+		/// <summary>Queues the change of the <paramref name="effects"/> processing a single source</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="effects">The effect chain, nullptr to remove it</param>
+		virtual void setSourceEffects(SourceID source, EffectChain* effects) override;
+		/// <summary>Queues the change of the cutoff frequency of the low-pass filter muffling a single source</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="cutoff">The cutoff frequency in Hz, 0 to remove the filter</param>
+		virtual void setLowPass(SourceID source, float cutoff) override;
+		/// <summary>Queues the change of the duration a stream decodes ahead and of the duration it decodes at once</summary>
+		/// <param name="source">The identifier of the stream</param>
+		/// <param name="bufferTime">The duration decoded ahead</param>
+		/// <param name="chunkTime">The minimum duration decoded at once, zero for the stream's default</param>
+		virtual void setStreamBuffering(SourceID source, sf::Time bufferTime, sf::Time chunkTime) override;
+		/// <summary>Queues the change of the <paramref name="markers"/> of a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="markers">The positions of the markers from the beginning of the source, sorted (empty to remove them)</param>
+		virtual void setMarkers(SourceID source, const std::vector<sf::Time>& markers) override;
+		/// <summary>Pops the next marker played by a source, forwarded by the audio thread from the owned backend through a wait-free queue</summary>
+		/// <param name="source">The identifier of the source that played the marker</param>
+		/// <param name="index">The index of the marker in the source's markers</param>
+		/// <param name="clockTime">The time of the audio clock at which the marker is heard</param>
+		/// <returns>True if a marker was popped, false if none are waiting</returns>
+		virtual bool pollMarker(SourceID& source, std::size_t& index, sf::Time& clockTime) override;
+		/// <summary>Retrieves the state of the buffer decoded ahead by a stream, mirrored by the audio thread from the owned backend</summary>
+		/// <param name="source">The identifier of the stream</param>
+		/// <param name="fill">The fill level (0 - 1) of the stream's buffer</param>
+		/// <param name="underruns">The amount of times the stream ran out of decoded frames</param>
+		/// <returns>True if the owned backend's stream reports its buffer, false otherwise</returns>
+		virtual bool getStreamState(SourceID source, float& fill, std::size_t& underruns) const override;
+		/// <summary>Retrieves the time taken by the owned backend to render its last block of audio, mirrored by the audio thread</summary>
+		/// <returns>The duration of the last render</returns>
+		virtual sf::Time getRenderTime() const override;
+
+	private:
+		/// <summary>Struct used to represent a call to apply on the audio thread</summary>
+		struct Command {
+			/// <summary>The type of call</summary>
+			enum class Type { CreateSound, CreateStream, CreateMemoryStream, CreateInputStream, CreateLayeredStream, Destroy, Play, PlayAt, Chain, Pause, Stop, SetLoop, SetVolume, Fade, SetLayerGain,
+			                  SetProperties, SetPosition, SetPlayingOffset, SetListenerPosition, SetSourceSubmix, SetSourceEffects, SetLowPass, SetStreamBuffering, SetMarkers,
+			                  CreateSubmix, DestroySubmix, SetSubmixParent, SetSubmixEffects };
+
+			Type                   type;       ///< The type of call
+			std::size_t            slot;       ///< The slot of the source
+			std::size_t            next;       ///< The slot of the next source (Type::Chain, the maximum amount of sources for none)
+			std::size_t            layer;      ///< The index of the layer (Type::SetLayerGain)
+			sf::Uint32             sequence;   ///< The sequence of the source's state once the command is applied
+			const sf::SoundBuffer* buffer;     ///< The sound buffer (Type::CreateSound)
+			AudioProperties        properties; ///< The properties (Type::SetProperties)
+			sf::Vector3f           position;   ///< The 3D position (Type::SetPosition and Type::SetListenerPosition)
+			sf::Time               offset;     ///< The playing position (Type::SetPlayingOffset), the start time (Type::PlayAt), the ramp's duration (Type::Fade and Type::SetLayerGain) or the buffer's duration (Type::SetStreamBuffering)
+			sf::Time               chunk;      ///< The duration decoded at once (Type::SetStreamBuffering)
+			float                  volume;     ///< The volume (Type::SetVolume), the gain (Type::Fade and Type::SetLayerGain) or the cutoff frequency (Type::SetLowPass)
+			bool                   flag;       ///< The loop flag (Type::SetLoop) or the stop flag (Type::Fade)
+			SubmixID               submix;     ///< The submix (Type::SetSourceSubmix and the submixes' types)
+			SubmixID               parent;     ///< The parent submix (Type::CreateSubmix and Type::SetSubmixParent)
+			EffectChain*           effects;    ///< The effect chain (Type::SetSourceEffects and Type::SetSubmixEffects)
+			SourceID               source;     ///< The identifier of the source, reported along with its markers (Type::SetMarkers)
+			std::vector<sf::Time>* markers;    ///< The positions of the markers, held by a payload of the pool (Type::SetMarkers)
+
+			/// <summary>Default constructor</summary>
+			Command();
+		};
+		/// <summary>Struct used to represent the game thread's side of a source</summary>
+		struct Slot {
+			std::atomic<sf::Uint32>          state;      ///< The mirrored status (2 lowest bits), the published flag (third bit) and the sequence of the last state change
+			std::atomic<sf::Int64>           offset;     ///< The playing position set by the game thread in microseconds, read while the state isn't published
+			std::atomic<sf::Int64>           published;  ///< The playing position published by the audio thread in microseconds, read while the state is published
+			std::atomic<float>               fill;       ///< The mirrored fill level of the stream's buffer, negative if the source doesn't report it
+			std::atomic<std::size_t>         underruns;  ///< The mirrored amount of underruns of the stream
+			std::string                      filepath;   ///< The filepath of the stream to create (its capacity is reused by the next streams of the slot)
+			const void*                      data;       ///< The memory held by the stream to create
+			std::size_t                      size;       ///< The size of the memory held by the stream to create
+			std::unique_ptr<sf::InputStream> stream;     ///< The custom stream read by the stream to create, handed over to the owned backend
+			std::vector<std::string>         layers;     ///< The filepaths of the stems of the layered stream to create
+			sf::Uint32                       generation; ///< The generation of the slot, incremented when its source is destroyed
+			sf::Uint32                       sequence;   ///< The sequence of the last state change queued
+
+			/// <summary>Default constructor</summary>
+			Slot();
+		};
+		/// <summary>Struct used to represent a marker played by a source</summary>
+		struct MarkerEvent {
+			SourceID    source;    ///< The identifier of the source
+			std::size_t index;     ///< The index of the marker in the source's markers
+			sf::Time    clockTime; ///< The time of the audio clock at which the marker is heard
+		};
+
+	private:
+		/// <summary>Takes a free slot for a new source</summary>
+		/// <returns>The index of the slot, the maximum amount of sources if none are free</returns>
+		std::size_t acquireSlot();
+		/// <summary>Takes a free payload of the pool for the markers of a command, adding one to the pool if none are free (game thread only)</summary>
+		/// <returns>The payload</returns>
+		std::vector<sf::Time>* acquireMarkers();
+		/// <summary>Retrieves the slot of a <paramref name="source"/></summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <returns>The index of the slot, the maximum amount of sources if the source doesn't exist</returns>
+		std::size_t findSlot(SourceID source) const;
+		/// <summary>Queues a <paramref name="command"/>, falling back to an unbounded queue if the ring buffer is full</summary>
+		/// <param name="command">The command to queue</param>
+		void pushCommand(const Command& command);
+		/// <summary>Moves the commands that overflowed to the ring buffer, as many as it can receive (game thread only)</summary>
+		/// <returns>True if no commands are left overflowing, false otherwise</returns>
+		bool flushOverflow() const;
+		/// <summary>Queues a command changing the state of a source</summary>
+		/// <param name="type">The type of call</param>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="status">The status mirrored straight away</param>
+		void pushStateCommand(Command::Type type, SourceID source, sf::SoundSource::Status status);
+		/// <summary>Mirrors a state change of a source straight away, keeping the playing position last published by the audio thread (game thread only)</summary>
+		/// <param name="slot">The slot of the source</param>
+		/// <param name="status">The status mirrored</param>
+		void storeState(Slot& slot, sf::SoundSource::Status status);
+		/// <summary>Creates the command of a source's call</summary>
+		/// <param name="type">The type of call</param>
+		/// <param name="slot">The slot of the source</param>
+		/// <returns>The command</returns>
+		Command makeCommand(Command::Type type, std::size_t slot) const;
+		/// <summary>Body of the audio thread</summary>
+		void run();
+		/// <summary>Applies a <paramref name="command"/> to the owned backend (audio thread only)</summary>
+		/// <param name="command">The command to apply</param>
+		void execute(const Command& command);
+		/// <summary>Mirrors the render time, the streams' buffers, and the status and the playing position of the sources whose commands have all been applied (audio thread only)</summary>
+		void publishStates();
+		/// <summary>Forwards the markers played by the owned backend's sources to the game thread with their identifiers (audio thread only)</summary>
+		void forwardMarkers();
+
+	private:
+		AudioBackend&                       backend_;          ///< The backend owned by the audio thread
+		const std::size_t                   MAX_SOURCES;       ///< The maximum amount of sources existing at the same time
+		std::unique_ptr<Slot[]>             slots_;            ///< The slots of the sources
+		std::vector<std::size_t>            freeSlots_;        ///< The free slots (game thread only)
+		RingBuffer<std::size_t>             releasedSlots_;    ///< The slots released by the audio thread
+		mutable RingBuffer<Command>         commands_;         ///< The commands waiting to be applied
+		mutable std::deque<Command>         overflow_;         ///< The commands that didn't fit in the ring buffer (game thread only)
+		sf::Vector3f                        listenerPosition_; ///< The 3D position of the listener (game thread only)
+		SubmixID                            nextSubmix_;       ///< The identifier given to the next submix (game thread only)
+		std::vector<SubmixID>               innerSubmixes_;    ///< The owned backend's submix of each submix identifier (audio thread only)
+		std::vector<SourceID>               innerSources_;     ///< The owned backend's source of each slot (audio thread only)
+		std::vector<sf::Uint32>             appliedSequences_; ///< The sequence of the last command applied to each slot (audio thread only)
+		std::vector<std::size_t>            liveSlots_;        ///< The slots whose source exists (audio thread only)
+		std::vector<SourceID>               markedSources_;    ///< The identifier of the source of each slot whose markers are set, 0 for none (audio thread only)
+		RingBuffer<MarkerEvent>             markerEvents_;     ///< The markers forwarded by the audio thread
+		std::deque<std::vector<sf::Time>>   markerPool_;       ///< The payloads holding the markers of the commands, never moved once added (game thread only)
+		std::vector<std::vector<sf::Time>*> freeMarkers_;      ///< The free payloads of the pool (game thread only)
+		RingBuffer<std::vector<sf::Time>*>  releasedMarkers_;  ///< The payloads released by the audio thread
+		std::atomic<sf::Int64>              renderTime_;       ///< The mirrored render time of the owned backend in microseconds
+		std::atomic<bool>                   running_;          ///< Is the audio thread running?
+		std::thread                         thread_;           ///< The audio thread
+	};
+}
+#endif
\ No newline at end of file
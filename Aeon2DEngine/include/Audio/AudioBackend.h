@@ -0,0 +1,326 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#ifndef Aeon2D_Audio_AudioBackend_H_
+#define Aeon2D_Audio_AudioBackend_H_
+
+#include <string>
+#include <vector>
+#include <memory>
+
+#include <SFML/Audio/SoundSource.hpp>
+#include <SFML/System/InputStream.hpp>
+#include <SFML/System/Vector3.hpp>
+#include <SFML/System/Time.hpp>
+
+#include "AudioProperties.h"
+
+// Forward Declaration(s)
+namespace sf {
+	class SoundBuffer;
+}
+namespace ae {
+	class EffectChain;
+}
+
+namespace ae
+{
+	/// <summary>
+	/// Abstract base class of the audio backends that play the sources of the <see cref="SoundPlayer"/> and the <see cref="MusicPlayer"/><para/>
+	///
+	/// The sources behave like sf::Sound and sf::Music objects: they're created stopped, and stopping them rewinds them.<br/>
+	/// The default backend plays the sources with SFML, other backends can be provided to the audio players' constructors
+	/// (i.e. a <see cref="SoftwareAudioBackend"/> to mix them in software or a <see cref="NullAudioBackend"/> to run without an audio device).
+	/// </summary>
+	class AudioBackend
+	{
+	public:
+		/// <summary>Identifier of a source created by the backend (0 is never a valid identifier)</summary>
+		using SourceID = unsigned int;
+		/// <summary>Identifier of a submix created by the backend (0 is the backend's output)</summary>
+		using SubmixID = unsigned int;
+
+	public:
+		/// <summary>Virtual destructor</summary>
+		virtual ~AudioBackend();
+		/// <summary>Deleted copy constructor</summary>
+		/// <param name="copy">The <see cref="AudioBackend"/> to be copied</param>
+		AudioBackend(const AudioBackend& copy) = delete;
+	public:
+		/// <summary>Deleted assignment operator</summary>
+		/// <param name="other">The <see cref="AudioBackend"/> to be copied</param>
+		/// <returns>The caller <see cref="AudioBackend"/></returns>
+		AudioBackend& operator=(const AudioBackend& other) = delete;
+	public:
+		/// <summary>
+		/// Retrieves the default backend, playing the sources with SFML<para/>
+		///
+		/// It's used by the audio players constructed without a backend.
+		/// </summary>
+		/// <returns>The default backend</returns>
+		static AudioBackend& getDefault();
+		/// <summary>
+		/// Creates a stopped source playing a sound <paramref name="buffer"/><para/>
+		///
+		/// The <paramref name="buffer"/> must remain alive as long as the source exists.
+		/// </summary>
+		/// <param name="buffer">The sound buffer to play</param>
+		/// <returns>The identifier of the new source, 0 if it couldn't be created</returns>
+		/// <seealso cref="destroySource"/>
+		virtual SourceID createSound(const sf::SoundBuffer& buffer) = 0;
+		/// <summary>Creates a stopped source streaming the audio file located at the <paramref name="filepath"/> provided</summary>
+		/// <param name="filepath">The audio file's filepath</param>
+		/// <returns>The identifier of the new source, 0 if the file couldn't be opened</returns>
+		/// <seealso cref="destroySource"/>
+		virtual SourceID createStream(const std::string& filepath) = 0;
+		/// <summary>
+		/// Creates a stopped source streaming the audio file held by a region of memory (i.e. a memory-mapped archive)<para/>
+		///
+		/// The <paramref name="data"/> isn't copied and must remain alive as long as the source exists.
+		/// </summary>
+		/// <param name="data">The first byte of the audio file</param>
+		/// <param name="size">The size of the audio file in bytes</param>
+		/// <returns>The identifier of the new source, 0 if the file couldn't be opened</returns>
+		/// <seealso cref="destroySource"/>
+		virtual SourceID createStream(const void* data, std::size_t size) = 0;
+		/// <summary>
+		/// Creates a stopped source streaming the audio file read by a custom <paramref name="stream"/> (i.e. over an archive entry)<para/>
+		///
+		/// The source takes ownership of the <paramref name="stream"/>, it's destroyed along with the source.
+		/// </summary>
+		/// <param name="stream">The stream reading the audio file</param>
+		/// <returns>The identifier of the new source, 0 if the file couldn't be opened</returns>
+		/// <seealso cref="destroySource"/>
+		virtual SourceID createStream(std::unique_ptr<sf::InputStream> stream) = 0;
+		/// <summary>
+		/// Creates a stopped source streaming the stems located at the <paramref name="filepaths"/> provided, decoded in lockstep and mixed as the layers of a single source<para/>
+		///
+		/// The layers start at full gain, see <see cref="setLayerGain"/>.<br/>
+		/// Backends that can't mix the stems themselves (i.e. the SFML backend) don't create layered streams.
+		/// </summary>
+		/// <param name="filepaths">The stems' filepaths, one per layer</param>
+		/// <returns>The identifier of the new source, 0 if a stem couldn't be opened or if the backend doesn't support layered streams</returns>
+		/// <seealso cref="destroySource"/>
+		virtual SourceID createLayeredStream(const std::vector<std::string>& filepaths);
+		/// <summary>Checks if the backend creates layered streams (see <see cref="createLayeredStream"/>)</summary>
+		/// <returns>True if the backend supports layered streams, false otherwise</returns>
+		virtual bool supportsLayeredStreams() const;
+		/// <summary>Destroys a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		virtual void destroySource(SourceID source) = 0;
+		/// <summary>Starts or resumes playing a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		virtual void play(SourceID source) = 0;
+		/// <summary>
+		/// Starts playing a source when the audio clock reaches the <paramref name="clockTime"/> provided<para/>
+		///
+		/// The source is reported as playing straight away, a <paramref name="clockTime"/> that has already passed plays it immediately.
+		/// </summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="clockTime">The time of the audio clock at which the source starts</param>
+		/// <seealso cref="getAudioClock"/>
+		virtual void playAt(SourceID source, sf::Time clockTime) = 0;
+		/// <summary>
+		/// Chains the <paramref name="next"/> source to a source, it starts playing on the frame following the end of the source (i.e. for gapless playlists)<para/>
+		///
+		/// Stopping the source removes its chain, a source on loop keeps it until its loop is removed.<br/>
+		/// Backends that can't start a source on an exact frame (i.e. the SFML backend) return false, the caller then starts the next source once the source has stopped.
+		/// </summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="next">The identifier of the stopped source started after it, 0 to remove the chain</param>
+		/// <returns>True if the backend chains the sources, false otherwise</returns>
+		virtual bool chain(SourceID source, SourceID next);
+		/// <summary>Pauses a playing source</summary>
+		/// <param name="source">The identifier of the source</param>
+		virtual void pause(SourceID source) = 0;
+		/// <summary>Stops a source and rewinds it to its beginning</summary>
+		/// <param name="source">The identifier of the source</param>
+		virtual void stop(SourceID source) = 0;
+		/// <summary>Sets whether a source restarts from its beginning once it reaches its end</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="flag">True to put the source on loop, false otherwise</param>
+		virtual void setLoop(SourceID source, bool flag) = 0;
+		/// <summary>Sets the <paramref name="volume"/> of a source (0 - 100)</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="volume">The new volume of the source</param>
+		virtual void setVolume(SourceID source, float volume) = 0;
+		/// <summary>
+		/// Ramps the fade gain (0 - 1) of a source to the <paramref name="gain"/> provided over a <paramref name="duration"/><para/>
+		///
+		/// The fade gain is applied on top of the volume of the source, it's 1 for a new source.<br/>
+		/// The ramp is applied by the audio side while the source is playing, without any call from the game thread.
+		/// </summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="gain">The fade gain reached at the end of the ramp</param>
+		/// <param name="duration">The duration of the ramp (zero to apply the <paramref name="gain"/> straight away)</param>
+		/// <param name="stop">True to stop the source once the ramp ends (i.e. a fade-out)</param>
+		virtual void fade(SourceID source, float gain, sf::Time duration, bool stop) = 0;
+		/// <summary>Ramps the gain (0 - 1) of a <paramref name="layer"/> of a layered stream to the <paramref name="gain"/> provided over a <paramref name="duration"/></summary>
+		/// <param name="source">The identifier of the layered stream</param>
+		/// <param name="layer">The index of the layer (the index of its stem)</param>
+		/// <param name="gain">The gain reached at the end of the ramp</param>
+		/// <param name="duration">The duration of the ramp (zero to apply the <paramref name="gain"/> straight away)</param>
+		/// <seealso cref="createLayeredStream"/>
+		virtual void setLayerGain(SourceID source, std::size_t layer, float gain, sf::Time duration);
+		/// <summary>
+		/// Applies the pitch, the attenuation, the minimum distance and the listener relativity of the <paramref name="properties"/> to a source<para/>
+		///
+		/// The volume of the <paramref name="properties"/> is ignored, see <see cref="setVolume"/>.
+		/// </summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="properties">The <see cref="AudioProperties"/> to apply</param>
+		virtual void setProperties(SourceID source, const AudioProperties& properties) = 0;
+		/// <summary>Sets the 3D <paramref name="position"/> of a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="position">The new 3D position of the source</param>
+		virtual void setPosition(SourceID source, const sf::Vector3f& position) = 0;
+		/// <summary>
+		/// Sets the playing position of a source<para/>
+		///
+		/// The playing position of a stopped source is kept until it's played.
+		/// </summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="offset">The new playing position from the beginning of the source</param>
+		/// <seealso cref="getPlayingOffset"/>
+		virtual void setPlayingOffset(SourceID source, sf::Time offset) = 0;
+		/// <summary>Retrieves the playing position of a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <returns>The playing position from the beginning of the source</returns>
+		/// <seealso cref="setPlayingOffset"/>
+		virtual sf::Time getPlayingOffset(SourceID source) const = 0;
+		/// <summary>Retrieves the status of a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <returns>The status of the source, sf::SoundSource::Status::Stopped if it doesn't exist</returns>
+		virtual sf::SoundSource::Status getStatus(SourceID source) const = 0;
+		/// <summary>Sets the 3D <paramref name="position"/> of the listener</summary>
+		/// <param name="position">The new 3D position of the listener</param>
+		/// <seealso cref="getListenerPosition"/>
+		virtual void setListenerPosition(const sf::Vector3f& position) = 0;
+		/// <summary>Retrieves the 3D position of the listener</summary>
+		/// <returns>The 3D position of the listener</returns>
+		/// <seealso cref="setListenerPosition"/>
+		virtual sf::Vector3f getListenerPosition() const = 0;
+		/// <summary>Retrieves the maximum amount of sound sources that should be playing at the same time</summary>
+		/// <returns>The maximum amount of sound sources</returns>
+		virtual std::size_t getMaxSources() const = 0;
+		/// <summary>
+		/// Retrieves the audio clock, the monotonic time of the audio rendered since the backend was created<para/>
+		///
+		/// It may be called from any thread.
+		/// </summary>
+		/// <returns>The current time of the audio clock</returns>
+		/// <seealso cref="playAt"/>
+		virtual sf::Time getAudioClock() const = 0;
+		/// <summary>
+		/// Creates a submix whose sources are processed together by an <see cref="EffectChain"/> before being added to its <paramref name="parent"/><para/>
+		///
+		/// Backends that can't process effects (i.e. the SFML backend) don't create submixes.
+		/// </summary>
+		/// <param name="parent">The identifier of the parent submix, 0 for the output</param>
+		/// <returns>The identifier of the new submix, 0 if the backend doesn't support submixes</returns>
+		/// <seealso cref="destroySubmix"/>
+		virtual SubmixID createSubmix(SubmixID parent);
+		/// <summary>Destroys a submix, its sources and child submixes are routed to its parent</summary>
+		/// <param name="submix">The identifier of the submix</param>
+		/// <seealso cref="createSubmix"/>
+		virtual void destroySubmix(SubmixID submix);
+		/// <summary>Sets the <paramref name="parent"/> of a submix</summary>
+		/// <param name="submix">The identifier of the submix</param>
+		/// <param name="parent">The identifier of the new parent submix, 0 for the output</param>
+		virtual void setSubmixParent(SubmixID submix, SubmixID parent);
+		/// <summary>Sets the <paramref name="effects"/> processing a submix</summary>
+		/// <param name="submix">The identifier of the submix</param>
+		/// <param name="effects">The effect chain (it must outlive the submix), nullptr to remove it</param>
+		virtual void setSubmixEffects(SubmixID submix, EffectChain* effects);
+		/// <summary>Routes a source to a <paramref name="submix"/></summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="submix">The identifier of the submix, 0 for the output</param>
+		virtual void setSourceSubmix(SourceID source, SubmixID submix);
+		/// <summary>
+		/// Sets the <paramref name="effects"/> processing a single source before it's added to its submix<para/>
+		///
+		/// Backends that can't process effects (i.e. the SFML backend) ignore them.
+		/// </summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="effects">The effect chain (it must outlive the source), nullptr to remove it</param>
+		virtual void setSourceEffects(SourceID source, EffectChain* effects);
+		/// <summary>
+		/// Sets the cutoff frequency of the low-pass filter muffling a single source (i.e. behind walls)<para/>
+		///
+		/// Backends that can't process effects (i.e. the SFML backend) ignore it.
+		/// </summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="cutoff">The cutoff frequency in Hz, 0 to remove the filter</param>
+		virtual void setLowPass(SourceID source, float cutoff);
+		/// <summary>
+		/// Changes the duration a stream decodes ahead and the duration it decodes at once, trading memory against resilience to slow storage<para/>
+		///
+		/// The frames already decoded ahead are kept, the stream may be resized while it plays.<br/>
+		/// Backends whose streams have fixed buffers (i.e. the SFML backend) ignore it.
+		/// </summary>
+		/// <param name="source">The identifier of the stream</param>
+		/// <param name="bufferTime">The duration decoded ahead</param>
+		/// <param name="chunkTime">The minimum duration decoded at once (larger chunks keep the file accesses sequential), zero for the stream's default</param>
+		/// <seealso cref="getStreamState"/>
+		virtual void setStreamBuffering(SourceID source, sf::Time bufferTime, sf::Time chunkTime);
+		/// <summary>
+		/// Retrieves the state of the buffer decoded ahead by a stream, cheap enough to be polled every frame<para/>
+		///
+		/// Backends whose streams don't report their buffer (i.e. the SFML backend) return false.
+		/// </summary>
+		/// <param name="source">The identifier of the stream</param>
+		/// <param name="fill">The fill level (0 - 1) of the stream's buffer</param>
+		/// <param name="underruns">The amount of times the stream ran out of decoded frames</param>
+		/// <returns>True if the stream reports its buffer, false otherwise</returns>
+		virtual bool getStreamState(SourceID source, float& fill, std::size_t& underruns) const;
+		/// <summary>
+		/// Sets the <paramref name="markers"/> of a source, reported by <see cref="pollMarker"/> as the audio side plays past them<para/>
+		///
+		/// The markers are detected on the exact frame where they're mixed, including after a loop, and replace the previous ones.<br/>
+		/// Backends that don't mix in software (i.e. the SFML backend) ignore them.
+		/// </summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="markers">The positions of the markers from the beginning of the source, sorted (empty to remove them)</param>
+		/// <seealso cref="pollMarker"/>
+		virtual void setMarkers(SourceID source, const std::vector<sf::Time>& markers);
+		/// <summary>
+		/// Pops the next marker played by a source, without any lock (the markers of all the sources share a single wait-free queue)<para/>
+		///
+		/// A single thread may poll the markers, those that don't fit in the queue are dropped.
+		/// </summary>
+		/// <param name="source">The identifier of the source that played the marker</param>
+		/// <param name="index">The index of the marker in the source's markers</param>
+		/// <param name="clockTime">The time of the audio clock at which the marker is heard</param>
+		/// <returns>True if a marker was popped, false if none are waiting</returns>
+		/// <seealso cref="setMarkers"/>
+		virtual bool pollMarker(SourceID& source, std::size_t& index, sf::Time& clockTime);
+		/// <summary>
+		/// Retrieves the time taken to render the last block of audio<para/>
+		///
+		/// Backends that don't mix in software (i.e. the SFML backend) return zero.
+		/// </summary>
+		/// <returns>The duration of the last render</returns>
+		virtual sf::Time getRenderTime() const;
+	protected:
+		/// <summary>Default constructor</summary>
+		AudioBackend() = default;
+	};
+}
+#endif
\ No newline at end of file
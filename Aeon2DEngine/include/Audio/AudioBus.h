@@ -0,0 +1,225 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#ifndef Aeon2D_Audio_AudioBus_H_
+#define Aeon2D_Audio_AudioBus_H_
+
+#include <vector>
+
+#include "AudioBackend.h"
+
+namespace ae
+{
+	/// <summary>
+	/// Class grouping sources whose volume is controlled together, in a hierarchy of buses<para/>
+	///
+	/// The gain of a bus is its volume multiplied by the gain of its parent bus, it's cached and only recomputed when a volume of the chain changes.<br/>
+	/// The sources attached to a bus are the real voices of the audio players, a volume change only updates the sources of the bus and of its sub-buses.<br/>
+	/// A bus may duck other buses: their volume is lowered as long as sources are attached to it or to its sub-buses.
+	/// The ducking is ramped over its attack and release times as the audio players playing on the buses are updated.<br/>
+	/// A bus given an <see cref="EffectChain"/> is rendered as a submix by the backends of its sources: the sources of the bus and of its sub-buses
+	/// are processed together by the effects, then added to the submix of the closest parent bus with effects.<para/>
+	///
+	/// The buses must outlive the audio players and sub-buses using them.
+	/// </summary>
+	/// <code>
+	/// ae::AudioBus master;
+	/// ae::AudioBus ui(&amp;master), voice(&amp;master);
+	/// musicPlayer.getBus().setParent(&amp;master);
+	/// soundPlayer.getBus().setParent(&amp;master);
+	/// soundPlayer.setBus(ui, SoundID::Click);
+	/// soundPlayer.setBus(voice, SoundID::Dialogue);
+	/// voice.setDucking(soundPlayer.getBus(), 30.f); // sound effects under dialogue
+	/// </code>
+	class AudioBus
+	{
+	public:
+		/// <summary>
+		/// Constructs the <see cref="AudioBus"/> by providing its <paramref name="parent"/> bus<para/>
+		///
+		/// The volume is set to 100%.
+		/// </summary>
+		/// <param name="parent">The parent bus, nullptr for a root bus (i.e. the master bus)</param>
+		explicit AudioBus(AudioBus* parent = nullptr);
+		/// <summary>Detaches the bus from its parent, its sub-buses and the buses it ducks</summary>
+		~AudioBus();
+		/// <summary>Deleted copy constructor</summary>
+		/// <param name="copy">The <see cref="AudioBus"/> to be copied</param>
+		AudioBus(const AudioBus& copy) = delete;
+	public:
+		/// <summary>Deleted assignment operator</summary>
+		/// <param name="other">The <see cref="AudioBus"/> to be copied</param>
+		/// <returns>The caller <see cref="AudioBus"/></returns>
+		AudioBus& operator=(const AudioBus& other) = delete;
+	public:
+		/// <summary>Sets the <paramref name="parent"/> bus</summary>
+		/// <param name="parent">The new parent bus, nullptr for a root bus</param>
+		/// <seealso cref="getParent"/>
+		void setParent(AudioBus* parent);
+		/// <summary>Retrieves the parent bus</summary>
+		/// <returns>The parent bus, nullptr for a root bus</returns>
+		/// <seealso cref="setParent"/>
+		AudioBus* getParent() const;
+		/// <summary>Sets the bus' <paramref name="volume"/> (0% - 100%)</summary>
+		/// <param name="volume">The bus' new volume</param>
+		/// <code>
+		/// ae::AudioBus master;
+		/// master.setVolume(50.f);
+		/// </code>
+		/// <seealso cref="getVolume"/>
+		void setVolume(float volume);
+		/// <summary>Retrieves the bus' volume</summary>
+		/// <returns>The bus' volume (0% - 100%)</returns>
+		/// <seealso cref="setVolume"/>
+		float getVolume() const;
+		/// <summary>Retrieves the cached gain (0 - 1) of the bus' chain, ducking included</summary>
+		/// <returns>The product of the volumes of the bus and its parents</returns>
+		float getGain() const;
+		/// <summary>
+		/// Ducks the <paramref name="target"/> bus to the <paramref name="volume"/> provided (0% - 100%) while sources are attached to this bus or its sub-buses<para/>
+		///
+		/// When several buses duck the same bus, the lowest volume is applied.<br/>
+		/// The volume of the <paramref name="target"/> bus is ramped down over the <paramref name="attack"/> and back up over the <paramref name="release"/>, see <see cref="update"/>.
+		/// </summary>
+		/// <param name="target">The bus to duck</param>
+		/// <param name="volume">The volume of the <paramref name="target"/> bus while it's ducked</param>
+		/// <param name="attack">The duration of the ramp down once a source is attached (zero to duck straight away)</param>
+		/// <param name="release">The duration of the ramp back up once the last source is detached (zero to restore the volume straight away)</param>
+		/// <code>
+		/// voice.setDucking(musicPlayer.getBus(), 30.f, sf::milliseconds(80), sf::milliseconds(600));
+		/// </code>
+		/// <seealso cref="removeDucking"/>
+		void setDucking(AudioBus& target, float volume, sf::Time attack = sf::milliseconds(50), sf::Time release = sf::milliseconds(300));
+		/// <summary>Stops ducking the <paramref name="target"/> bus</summary>
+		/// <param name="target">The bus ducked</param>
+		/// <seealso cref="setDucking"/>
+		void removeDucking(AudioBus& target);
+		/// <summary>
+		/// Sets the <paramref name="effects"/> processing the sources of the bus and of its sub-buses together (i.e. an environment's reverb)<para/>
+		///
+		/// The effects are only processed by backends mixing in software (i.e. a <see cref="SoftwareAudioBackend"/>), the other backends ignore them.
+		/// </summary>
+		/// <param name="effects">The effect chain (it must outlive the bus), nullptr to remove it</param>
+		/// <code>
+		/// ae::Reverb cave;
+		/// ae::EffectChain chain;
+		/// chain.add(cave);
+		/// soundPlayer.getBus().setEffects(&amp;chain);
+		/// </code>
+		/// <seealso cref="getEffects"/>
+		void setEffects(EffectChain* effects);
+		/// <summary>Retrieves the effects processing the sources of the bus and of its sub-buses</summary>
+		/// <returns>The effect chain, nullptr if there's none</returns>
+		/// <seealso cref="setEffects"/>
+		EffectChain* getEffects() const;
+		/// <summary>
+		/// Attaches a <paramref name="source"/> of the <paramref name="backend"/> to the bus<para/>
+		///
+		/// The volume of the <paramref name="source"/> is set to its <paramref name="volume"/> multiplied by the bus' gain, and kept up to date until it's detached.
+		/// </summary>
+		/// <param name="backend">The audio backend of the source</param>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="volume">The volume of the source itself (0 - 100)</param>
+		/// <seealso cref="detach"/>
+		void attach(AudioBackend& backend, AudioBackend::SourceID source, float volume);
+		/// <summary>Detaches a <paramref name="source"/> of the <paramref name="backend"/> from the bus</summary>
+		/// <param name="backend">The audio backend of the source</param>
+		/// <param name="source">The identifier of the source</param>
+		/// <seealso cref="attach"/>
+		void detach(AudioBackend& backend, AudioBackend::SourceID source);
+		/// <summary>Changes the <paramref name="volume"/> of a <paramref name="source"/> of the <paramref name="backend"/> attached to the bus (i.e. as it gets occluded)</summary>
+		/// <param name="backend">The audio backend of the source</param>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="volume">The new volume of the source itself (0 - 100)</param>
+		/// <seealso cref="attach"/>
+		void setSourceVolume(AudioBackend& backend, AudioBackend::SourceID source, float volume);
+		/// <summary>Retrieves the amount of sources attached to the bus and to its sub-buses</summary>
+		/// <returns>The amount of sources attached</returns>
+		std::size_t getSourceCount() const;
+		/// <summary>
+		/// Advances the ducking ramps of the bus and of its parents up to the time of the audio clock provided<para/>
+		///
+		/// The audio players call it on the buses they play on in their own update, the buses are thus ramped on the audio clock of their backend.<br/>
+		/// Calling it several times with the same time is harmless, the buses shared by several audio players aren't ramped faster.
+		/// </summary>
+		/// <param name="clockTime">The current time of the audio clock</param>
+		void update(sf::Time clockTime);
+
+	private:
+		/// <summary>Struct used to represent a source attached to the bus</summary>
+		struct Source {
+			AudioBackend*          backend; ///< The audio backend of the source
+			AudioBackend::SourceID id;      ///< The identifier of the source
+			float                  volume;  ///< The volume of the source itself
+		};
+		/// <summary>Struct used to represent a bus ducking this bus</summary>
+		struct Ducker {
+			AudioBus* bus;     ///< The bus ducking this bus
+			float     volume;  ///< The volume applied while it's active
+			sf::Time  attack;  ///< The duration of the ramp down once it's active
+			sf::Time  release; ///< The duration of the ramp back up once it's inactive
+		};
+		/// <summary>Struct used to represent the submix of the bus on a backend</summary>
+		struct Submix {
+			AudioBackend*          backend; ///< The audio backend of the submix
+			AudioBackend::SubmixID id;      ///< The identifier of the submix
+		};
+
+	private:
+		/// <summary>Recomputes the cached gain and applies it to the sources and the sub-buses</summary>
+		void updateGain();
+		/// <summary>Recomputes the ducking volume targeted by the active duckers and starts ramping towards it</summary>
+		void updateDucking();
+		/// <summary>Advances the ducking ramp of the bus alone up to the time of the audio clock provided</summary>
+		/// <param name="clockTime">The current time of the audio clock</param>
+		void advanceDucking(sf::Time clockTime);
+		/// <summary>Adds an amount of sources to the source count of the bus and of its parents</summary>
+		/// <param name="count">The amount of sources to add (negative to remove them)</param>
+		void addSourceCount(long count);
+		/// <summary>Retrieves the submix of the <paramref name="backend"/> receiving the sources of the bus, the one of the closest bus with effects</summary>
+		/// <param name="backend">The audio backend</param>
+		/// <returns>The identifier of the submix, 0 for the backend's output</returns>
+		AudioBackend::SubmixID getRoute(AudioBackend& backend);
+		/// <summary>Retrieves the bus' own submix on the <paramref name="backend"/>, creating it if needed (the bus must have effects)</summary>
+		/// <param name="backend">The audio backend</param>
+		/// <returns>The identifier of the submix, 0 if the backend doesn't support submixes</returns>
+		AudioBackend::SubmixID getSubmix(AudioBackend& backend);
+		/// <summary>Reroutes the sources and the submixes of the bus and of its sub-buses after a change of effects or of parent</summary>
+		void updateRouting();
+
+	private:
+		AudioBus*              parent_;      ///< The parent bus
+		std::vector<AudioBus*> children_;    ///< The sub-buses
+		std::vector<Source>    sources_;     ///< The sources attached to the bus
+		std::vector<Ducker>    duckers_;     ///< The buses ducking this bus
+		std::vector<AudioBus*> ducked_;      ///< The buses ducked by this bus
+		std::vector<Submix>    submixes_;    ///< The submixes of the bus on the backends of its sources (only if it has effects)
+		EffectChain*           effects_;     ///< The effects processing the bus' submixes
+		std::size_t            sourceCount_; ///< The amount of sources attached to the bus and its sub-buses
+		float                  volume_;      ///< The volume of the bus
+		float                  duckVolume_;  ///< The volume applied by the active duckers (0 - 1)
+		float                  duckTarget_;  ///< The volume targeted by the ducking ramp (0 - 1)
+		sf::Time               duckLeft_;    ///< The time left to the ducking ramp
+		sf::Time               duckRelease_; ///< The release of the ducker applying the target volume
+		sf::Time               duckClock_;   ///< The audio clock's time of the last advance of the ducking ramp (zero until the ramp has advanced once)
+		float                  gain_;        ///< The cached gain of the bus' chain
+	};
+}
+#endif
\ No newline at end of file
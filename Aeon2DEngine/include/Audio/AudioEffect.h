@@ -0,0 +1,51 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#ifndef Aeon2D_Audio_AudioEffect_H_
+#define Aeon2D_Audio_AudioEffect_H_
+
+#include <cstddef>
+
+namespace ae
+{
+	/// <summary>
+	/// Abstract base class of the effects processing blocks of stereo float frames in place (i.e. filters, reverbs and compressors)<para/>
+	///
+	/// The effects are processed on the audio thread by an <see cref="EffectChain"/>, their parameters may be changed from any thread and are applied on the next block.
+	/// </summary>
+	class AudioEffect
+	{
+	public:
+		/// <summary>Virtual destructor</summary>
+		virtual ~AudioEffect() = default;
+	public:
+		/// <summary>Processes a block of frames in place</summary>
+		/// <param name="frames">The interleaved stereo frames (2 * <paramref name="frameCount"/> floats)</param>
+		/// <param name="frameCount">The amount of frames to process</param>
+		/// <param name="sampleRate">The amount of frames per second</param>
+		virtual void process(float* frames, std::size_t frameCount, unsigned int sampleRate) = 0;
+		/// <summary>Clears the effect's internal state (i.e. the filters' history and the reverb's tail)</summary>
+		virtual void reset() = 0;
+	protected:
+		/// <summary>Default constructor</summary>
+		AudioEffect() = default;
+	};
+}
+#endif
\ No newline at end of file
@@ -22,16 +22,24 @@
 #define Aeon2D_Audio_AudioPlayer_H_
 
 #include <string>
+#include <cmath>
+#include <algorithm>
 
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Audio/Listener.hpp>
+#include <SFML/System/Clock.hpp>
 
 #include "AudioProperties.h"
+#include "AudioBackend.h"
+#include "AudioBus.h"
+#include "AudioStats.h"
+#include "LoudnessCache.h"
+#include "LoudnessMeter.h"
 
 namespace ae
 {
 	/// <summary>
-	/// Abstract base class providing a global volume attribute and listener repositioning<para/>
+	/// Abstract base class providing a global volume attribute, listener repositioning and the <see cref="AudioBackend"/> playing the audio resources<para/>
 	///
 	/// This base class is inherited by the classes <see cref="MusicPlayer"/> and <see cref="SoundPlayer"/> which we recommend using.
 	/// </summary>
@@ -46,7 +54,7 @@ namespace ae
 		/// <summary>
 		/// Sets the position of the listener (i.e. the player position)<para/>
 		///
-		/// The listener's position is the same for both the <see cref="MusicPlayer"/> and the <see cref="SoundPlayer"/>.
+		/// The listener's position is shared by all the audio players using the same <see cref="AudioBackend"/>.
 		/// </summary>
 		/// <param name="pos">The listener's new position</param>
 		/// <seealso cref="getListenerPosition"/>
@@ -62,12 +70,92 @@ namespace ae
 		/// <summary>
 		/// Sets the audio player's global volume (0% - 100%)<para/>
 		///
-		/// A global volume of 50% will reduce the audio player's resources' volume by half of their current volume.
+		/// A global volume of 50% will reduce the audio player's resources' volume by half of their current volume.<br/>
+		/// The global volume is the volume of the audio player's bus, only the real sources attached to it and its sub-buses are updated.
 		/// </summary>
 		/// <param name="globalVolume">The audio player's global volume</param>
 		/// <seealso cref="getGlobalVolume"/>
 		virtual void setGlobalVolume(float globalVolume) = 0;
 		/// <summary>
+		/// Retrieves the audio player's bus<para/>
+		///
+		/// Its volume is the global volume, it can be given a parent bus (i.e. a master bus) or sub-buses.
+		/// </summary>
+		/// <returns>The audio player's bus</returns>
+		/// <code>
+		/// ae::AudioBus master;
+		/// soundPlayer.getBus().setParent(&amp;master);
+		/// </code>
+		AudioBus& getBus();
+		/// <summary>
+		/// Retrieves the audio player's bus<para/>
+		///
+		/// Its volume is the global volume, it can be given a parent bus (i.e. a master bus) or sub-buses.
+		/// </summary>
+		/// <returns>The audio player's bus</returns>
+		const AudioBus& getBus() const;
+		/// <summary>
+		/// Retrieves the time of the audio clock of the <see cref="AudioBackend"/>, cheap enough to be called every frame<para/>
+		///
+		/// The audio clock is monotonic and advances with the audio rendered rather than with the game's frames,
+		/// it's the time base of the sound effects and music tracks scheduled with playAt.
+		/// </summary>
+		/// <returns>The current time of the audio clock</returns>
+		/// <code>
+		/// // Start the next bar exactly 2 seconds from now
+		/// const sf::Time START = soundPlayer.getAudioClock() + sf::seconds(2.f);
+		/// soundPlayer.playAt(sf::Vector2f(0.f, 0.f), SoundID::Drums, false, START);
+		/// musicPlayer.playAt(MusicID::Bass, false, START);
+		/// </code>
+		sf::Time getAudioClock() const;
+		/// <summary>
+		/// Sets the integrated loudness (ITU-R BS.1770) at which the audio resources loaded afterwards are played at their volume<para/>
+		///
+		/// The loudness of each audio resource is measured once when it's loaded and the gain bringing it to the target is folded into its volume, playing it costs nothing more.<br/>
+		/// The volume can't exceed 100%, a target below the loudness of the quietest resources (i.e. -23 LUFS) lets them all be matched.
+		/// </summary>
+		/// <param name="target">The target loudness in LUFS, 0 to disable the normalization (default)</param>
+		/// <code>
+		/// soundPlayer.setLoudnessTarget(-23.f);
+		/// soundPlayer.load("Assets/Sounds/KnightAttack.wav", SoundID::ID1);
+		/// </code>
+		/// <seealso cref="getLoudnessTarget"/>
+		/// <seealso cref="setLoudnessCache"/>
+		void setLoudnessTarget(float target);
+		/// <summary>Retrieves the integrated loudness at which the audio resources loaded are played at their volume</summary>
+		/// <returns>The target loudness in LUFS, 0 if the normalization is disabled</returns>
+		/// <seealso cref="setLoudnessTarget"/>
+		float getLoudnessTarget() const;
+		/// <summary>Sets the sidecar cache keeping the loudness measured, later launches then skip the analysis of the audio resources already measured</summary>
+		/// <param name="cache">The loudness cache (it must outlive the audio player), nullptr to measure the audio resources every time</param>
+		/// <code>
+		/// ae::LoudnessCache cache("Assets/loudness.cache");
+		/// soundPlayer.setLoudnessCache(&amp;cache);
+		/// </code>
+		/// <seealso cref="getLoudnessCache"/>
+		/// <seealso cref="setLoudnessTarget"/>
+		void setLoudnessCache(LoudnessCache* cache);
+		/// <summary>Retrieves the sidecar cache keeping the loudness measured</summary>
+		/// <returns>The loudness cache, nullptr if there's none</returns>
+		/// <seealso cref="setLoudnessCache"/>
+		LoudnessCache* getLoudnessCache() const;
+		/// <summary>
+		/// Retrieves the performance counters of the audio player, cheap enough to be polled every frame (i.e. by a debug overlay)<para/>
+		///
+		/// The voice counts and the state of the streams are those of the call, the other counters are accumulated until <see cref="resetStats"/> is called.<br/>
+		/// The plays per second are measured over windows of at least a second between the calls.
+		/// </summary>
+		/// <returns>The audio player's statistics</returns>
+		/// <code>
+		/// const ae::AudioStats&amp; stats = soundPlayer.getStats();
+		/// overlay.setString("Voices: " + std::to_string(stats.realVoices) + '/' + std::to_string(stats.activeVoices));
+		/// </code>
+		/// <seealso cref="resetStats"/>
+		const AudioStats& getStats();
+		/// <summary>Resets the accumulated performance counters of the audio player (i.e. when a level is loaded)</summary>
+		/// <seealso cref="getStats"/>
+		void resetStats();
+		/// <summary>
 		/// Loads in an audio resource by providng a <paramref name="filepath"/> and an <paramref name="id"/> to associate it with<para/>
 		///
 		/// The <see cref="AudioProperties"/> of the audio resource will be those by default.<para/>
@@ -97,9 +185,17 @@ namespace ae
 		/// Default constructor<para/>
 		///
 		/// The global volume is set to 100% and the listener's position to (0, 0, 300).<br/>
-		/// The listener's position is the same for both the <see cref="MusicPlayer"/> and the <see cref="SoundPlayer"/>.
+		/// The audio resources are played by the default <see cref="AudioBackend"/> (SFML).
 		/// </summary>
 		AudioPlayer();
+		/// <summary>
+		/// Constructs the <see cref="AudioPlayer"/> by providing the <paramref name="backend"/> that will play its audio resources<para/>
+		///
+		/// The global volume is set to 100% and the listener's position to (0, 0, 300).<br/>
+		/// The <paramref name="backend"/> must outlive the <see cref="AudioPlayer"/>.
+		/// </summary>
+		/// <param name="backend">The <see cref="AudioBackend"/> that will play the audio resources</param>
+		explicit AudioPlayer(AudioBackend& backend);
 		/// <summary>Deleted copy constructor</summary>
 		/// <param name="copy">The <see cref="AudioPlayer"/> to be copied</param>
 		AudioPlayer(const AudioPlayer<T>& copy) = delete;
@@ -108,9 +204,29 @@ namespace ae
 		/// <param name="other">The <see cref="AudioPlayer"/> of which its attributes will be copied</param>
 		/// <returns>The caller <see cref="AudioPlayer"/></returns>
 		AudioPlayer<T>& operator=(const AudioPlayer<T>& other) = delete;
+	protected:
+		/// <summary>Retrieves the <see cref="AudioBackend"/> playing the audio resources</summary>
+		/// <returns>The audio backend</returns>
+		AudioBackend& getBackend() const;
+		/// <summary>Computes the gain bringing an audio resource of the <paramref name="loudness"/> provided to the target loudness</summary>
+		/// <param name="loudness">The integrated loudness of the audio resource in LUFS</param>
+		/// <returns>The gain to fold into the audio resource's volume, 1 if the normalization is disabled or if the audio resource is silent</returns>
+		float computeLoudnessGain(float loudness) const;
+		/// <summary>Retrieves the statistics counted by the derived audio player (plays, dropped plays, culled and stolen voices, underruns)</summary>
+		/// <returns>The audio player's statistics</returns>
+		AudioStats& getStatsCounters();
+		/// <summary>Fills in the voice counts and the state of the streams of the derived audio player, and accumulates the underruns of its streams</summary>
+		/// <param name="stats">The audio player's statistics</param>
+		virtual void collectStats(AudioStats& stats) = 0;
 
 	private:
-		float globalVolume_; ///< The audio player's global volume
+		AudioBackend&  backend_;        ///< The audio backend playing the audio resources
+		AudioBus       bus_;            ///< The audio player's bus (its volume is the global volume)
+		float          loudnessTarget_; ///< The target loudness in LUFS (0 if the normalization is disabled)
+		LoudnessCache* loudnessCache_;  ///< The sidecar cache keeping the loudness measured (nullptr if none)
+		AudioStats     stats_;          ///< The performance counters
+		sf::Clock      statsClock_;     ///< The clock measuring the window of the plays per second
+		std::size_t    windowPlays_;    ///< The amount of plays when the window of the plays per second started
 	};
 }
 #include "AudioPlayer.inl"
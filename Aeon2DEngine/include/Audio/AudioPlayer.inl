@@ -29,14 +29,14 @@ namespace ae
 	/// <summary>
 	/// Sets the position of the listener (i.e. the player position)<para/>
 	///
-	/// The listener's position is the same for both the <see cref="MusicPlayer"/> and the <see cref="SoundPlayer"/>.
+	/// The listener's position is shared by all the audio players using the same <see cref="AudioBackend"/>.
 	/// </summary>
 	/// <param name="pos">The listener's new position</param>
 	/// <seealso cref="getListenerPosition"/>
 	template <typename T>
 	void AudioPlayer<T>::setListenerPosition(const sf::Vector2f& pos)
 	{
-		sf::Listener::setPosition(pos.x, -pos.y, sf::Listener::getPosition().z);
+		backend_.setListenerPosition(sf::Vector3f(pos.x, -pos.y, backend_.getListenerPosition().z));
 	}
 
 	/// <summary>Retrieves the listener's position</summary>
@@ -45,7 +45,7 @@ namespace ae
 	template <typename T>
 	sf::Vector2f AudioPlayer<T>::getListenerPosition() const
 	{
-		sf::Vector3f pos = sf::Listener::getPosition();
+		sf::Vector3f pos = backend_.getListenerPosition();
 		return sf::Vector2f(pos.x, -pos.y);
 	}
 
@@ -55,33 +55,213 @@ namespace ae
 	template <typename T>
 	float AudioPlayer<T>::getGlobalVolume() const
 	{
-		return globalVolume_;
+		return bus_.getVolume();
 	}
 
 	/// <summary>
 	/// Sets the audio player's global volume (0% - 100%)<para/>
 	///
-	/// A global volume of 50% will reduce the audio player's resources' volume by half of their current volume.
+	/// A global volume of 50% will reduce the audio player's resources' volume by half of their current volume.<br/>
+	/// The global volume is the volume of the audio player's bus, only the real sources attached to it and its sub-buses are updated.
 	/// </summary>
 	/// <param name="globalVolume">The audio player's global volume</param>
 	/// <seealso cref="getGlobalVolume"/>
 	template <typename T>
 	void AudioPlayer<T>::setGlobalVolume(float globalVolume)
 	{
-		// Verifies that the global volume is within the range [0, 100]
-		globalVolume_ = fmaxf(fminf(globalVolume, 100.f), 0.f);
+		bus_.setVolume(globalVolume);
+	}
+
+	/// <summary>
+	/// Retrieves the audio player's bus<para/>
+	///
+	/// Its volume is the global volume, it can be given a parent bus (i.e. a master bus) or sub-buses.
+	/// </summary>
+	/// <returns>The audio player's bus</returns>
+	template <typename T>
+	AudioBus& AudioPlayer<T>::getBus()
+	{
+		return bus_;
+	}
+
+	/// <summary>
+	/// Retrieves the audio player's bus<para/>
+	///
+	/// Its volume is the global volume, it can be given a parent bus (i.e. a master bus) or sub-buses.
+	/// </summary>
+	/// <returns>The audio player's bus</returns>
+	template <typename T>
+	const AudioBus& AudioPlayer<T>::getBus() const
+	{
+		return bus_;
+	}
+
+	/// <summary>
+	/// Retrieves the time of the audio clock of the <see cref="AudioBackend"/>, cheap enough to be called every frame<para/>
+	///
+	/// The audio clock is monotonic and advances with the audio rendered rather than with the game's frames,
+	/// it's the time base of the sound effects and music tracks scheduled with playAt.
+	/// </summary>
+	/// <returns>The current time of the audio clock</returns>
+	/// <code>
+	/// // Start the next bar exactly 2 seconds from now
+	/// const sf::Time START = soundPlayer.getAudioClock() + sf::seconds(2.f);
+	/// soundPlayer.playAt(sf::Vector2f(0.f, 0.f), SoundID::Drums, false, START);
+	/// musicPlayer.playAt(MusicID::Bass, false, START);
+	/// </code>
+	template <typename T>
+	sf::Time AudioPlayer<T>::getAudioClock() const
+	{
+		return backend_.getAudioClock();
+	}
+
+	/// <summary>
+	/// Sets the integrated loudness (ITU-R BS.1770) at which the audio resources loaded afterwards are played at their volume<para/>
+	///
+	/// The loudness of each audio resource is measured once when it's loaded and the gain bringing it to the target is folded into its volume, playing it costs nothing more.<br/>
+	/// The volume can't exceed 100%, a target below the loudness of the quietest resources (i.e. -23 LUFS) lets them all be matched.
+	/// </summary>
+	/// <param name="target">The target loudness in LUFS, 0 to disable the normalization (default)</param>
+	/// <code>
+	/// soundPlayer.setLoudnessTarget(-23.f);
+	/// soundPlayer.load("Assets/Sounds/KnightAttack.wav", SoundID::ID1);
+	/// </code>
+	/// <seealso cref="getLoudnessTarget"/>
+	/// <seealso cref="setLoudnessCache"/>
+	template <typename T>
+	void AudioPlayer<T>::setLoudnessTarget(float target)
+	{
+		loudnessTarget_ = target;
+	}
+
+	/// <summary>Retrieves the integrated loudness at which the audio resources loaded are played at their volume</summary>
+	/// <returns>The target loudness in LUFS, 0 if the normalization is disabled</returns>
+	/// <seealso cref="setLoudnessTarget"/>
+	template <typename T>
+	float AudioPlayer<T>::getLoudnessTarget() const
+	{
+		return loudnessTarget_;
+	}
+
+	/// <summary>Sets the sidecar cache keeping the loudness measured, later launches then skip the analysis of the audio resources already measured</summary>
+	/// <param name="cache">The loudness cache (it must outlive the audio player), nullptr to measure the audio resources every time</param>
+	/// <code>
+	/// ae::LoudnessCache cache("Assets/loudness.cache");
+	/// soundPlayer.setLoudnessCache(&amp;cache);
+	/// </code>
+	/// <seealso cref="getLoudnessCache"/>
+	/// <seealso cref="setLoudnessTarget"/>
+	template <typename T>
+	void AudioPlayer<T>::setLoudnessCache(LoudnessCache* cache)
+	{
+		loudnessCache_ = cache;
+	}
+
+	/// <summary>Retrieves the sidecar cache keeping the loudness measured</summary>
+	/// <returns>The loudness cache, nullptr if there's none</returns>
+	/// <seealso cref="setLoudnessCache"/>
+	template <typename T>
+	LoudnessCache* AudioPlayer<T>::getLoudnessCache() const
+	{
+		return loudnessCache_;
+	}
+
+	/// <summary>
+	/// Retrieves the performance counters of the audio player, cheap enough to be polled every frame (i.e. by a debug overlay)<para/>
+	///
+	/// The voice counts and the state of the streams are those of the call, the other counters are accumulated until <see cref="resetStats"/> is called.<br/>
+	/// The plays per second are measured over windows of at least a second between the calls.
+	/// </summary>
+	/// <returns>The audio player's statistics</returns>
+	/// <code>
+	/// const ae::AudioStats&amp; stats = soundPlayer.getStats();
+	/// overlay.setString("Voices: " + std::to_string(stats.realVoices) + '/' + std::to_string(stats.activeVoices));
+	/// </code>
+	/// <seealso cref="resetStats"/>
+	template <typename T>
+	const AudioStats& AudioPlayer<T>::getStats()
+	{
+		collectStats(stats_);
+		stats_.peakVoices = std::max(stats_.peakVoices, stats_.activeVoices);
+		stats_.renderTime = backend_.getRenderTime();
+
+		const sf::Time ELAPSED = statsClock_.getElapsedTime();
+		if (ELAPSED >= sf::seconds(1.f)) {
+			stats_.playsPerSecond = (stats_.plays - windowPlays_) / ELAPSED.asSeconds();
+			windowPlays_ = stats_.plays;
+			statsClock_.restart();
+		}
+		return stats_;
+	}
+
+	/// <summary>Resets the accumulated performance counters of the audio player (i.e. when a level is loaded)</summary>
+	/// <seealso cref="getStats"/>
+	template <typename T>
+	void AudioPlayer<T>::resetStats()
+	{
+		stats_ = AudioStats();
+		windowPlays_ = 0;
+		statsClock_.restart();
 	}
 
 	/// <summary>
 	/// Default constructor<para/>
 	///
 	/// The global volume is set to 100% and the listener's position to (0, 0, 300).<br/>
-	/// The listener's position is the same for both the <see cref="MusicPlayer"/> and the <see cref="SoundPlayer"/>.
+	/// The audio resources are played by the default <see cref="AudioBackend"/> (SFML).
 	/// </summary>
 	template <typename T>
 	AudioPlayer<T>::AudioPlayer()
-		: globalVolume_(100.f)
+		: AudioPlayer(AudioBackend::getDefault())
+	{
+	}
+
+	/// <summary>
+	/// Constructs the <see cref="AudioPlayer"/> by providing the <paramref name="backend"/> that will play its audio resources<para/>
+	///
+	/// The global volume is set to 100% and the listener's position to (0, 0, 300).<br/>
+	/// The <paramref name="backend"/> must outlive the <see cref="AudioPlayer"/>.
+	/// </summary>
+	/// <param name="backend">The <see cref="AudioBackend"/> that will play the audio resources</param>
+	template <typename T>
+	AudioPlayer<T>::AudioPlayer(AudioBackend& backend)
+		: backend_(backend)
+		, bus_()
+		, loudnessTarget_(0.f)
+		, loudnessCache_(nullptr)
+		, stats_()
+		, statsClock_()
+		, windowPlays_(0)
+	{
+		backend_.setListenerPosition(sf::Vector3f(0.f, 0.f, 300.f));
+	}
+
+	/// <summary>Retrieves the <see cref="AudioBackend"/> playing the audio resources</summary>
+	/// <returns>The audio backend</returns>
+	template <typename T>
+	AudioBackend& AudioPlayer<T>::getBackend() const
+	{
+		return backend_;
+	}
+
+	/// <summary>Computes the gain bringing an audio resource of the <paramref name="loudness"/> provided to the target loudness</summary>
+	/// <param name="loudness">The integrated loudness of the audio resource in LUFS</param>
+	/// <returns>The gain to fold into the audio resource's volume, 1 if the normalization is disabled or if the audio resource is silent</returns>
+	template <typename T>
+	float AudioPlayer<T>::computeLoudnessGain(float loudness) const
+	{
+		// Silent audio resources (under the absolute gate) are left untouched
+		if (loudnessTarget_ == 0.f || !(loudness > -70.f))
+			return 1.f;
+
+		return powf(10.f, (loudnessTarget_ - loudness) / 20.f);
+	}
+
+	/// <summary>Retrieves the statistics counted by the derived audio player (plays, dropped plays, culled and stolen voices, underruns)</summary>
+	/// <returns>The audio player's statistics</returns>
+	template <typename T>
+	AudioStats& AudioPlayer<T>::getStatsCounters()
 	{
-		sf::Listener::setPosition(0.f, 0.f, 300.f);
+		return stats_;
 	}
 }
\ No newline at end of file
@@ -26,7 +26,7 @@ namespace ae
 	/// <summary>
 	/// A container class for a specific audio's (sound or music) properties<para/>
 	///
-	/// Audio properties include volume, attenuation, pitch, minimum 2D distance and listener relativity.
+	/// Audio properties include volume, attenuation, pitch, minimum 2D distance, listener relativity and priority.
 	/// </summary>
 	class AudioProperties
 	{
@@ -226,6 +226,21 @@ namespace ae
 		/// </code>
 		/// <seealso cref="isRelativeToListener"/>
 		inline void setRelativeToListener(bool flag) { relativeToListener_ = flag; }
+		/// <summary>
+		/// Sets the priority of the audio<para/>
+		///
+		/// When more sounds are active than there are sound sources available, the ones with the highest priority are the first to be given a source.<br/>
+		/// Sounds sharing the same priority are ranked by how loud they are heard by the listener.<para/>
+		///
+		/// The default value for the priority is 0.
+		/// </summary>
+		/// <param name="priority">The new priority</param>
+		/// <code>
+		/// ae::AudioProperties props;
+		/// props.setPriority(10); // the audio will be heard before the audios with a lower priority
+		/// </code>
+		/// <seealso cref="getPriority"/>
+		inline void setPriority(int priority) { priority_ = priority; }
 		/// <summary>Retrieves the volume value</summary>
 		/// <returns>The volume value</returns>
 		/// <code>
@@ -280,6 +295,15 @@ namespace ae
 		/// </code>
 		/// <seealso cref="setRelativeToListener"/>
 		inline bool isRelativeToListener() const { return relativeToListener_; }
+		/// <summary>Retrieves the priority</summary>
+		/// <returns>The priority</returns>
+		/// <code>
+		/// ae::AudioProperties props;
+		/// props.setPriority(10);
+		/// int priority = props.getPriority();
+		/// </code>
+		/// <seealso cref="setPriority"/>
+		inline int getPriority() const { return priority_; }
 
 	private:
 		float volume_;             ///< The volume
@@ -288,6 +312,7 @@ namespace ae
 		float minDistance2d_;      ///< The minimum 2d distance where the audio is heard at full volume
 		float minDistance3d_;      ///< The minimum 3d distance where the audio is heard at full volume
 		bool  relativeToListener_; ///< Is the audio source relative to the listener?
+		int   priority_;           ///< The priority used when sound sources are scarce
 	};
 }
 #endif
\ No newline at end of file
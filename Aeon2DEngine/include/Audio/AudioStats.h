@@ -0,0 +1,55 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+
+#ifndef Aeon2D_Audio_AudioStats_H_
+#define Aeon2D_Audio_AudioStats_H_
+
+#include <cstddef>
+
+#include <SFML/System/Time.hpp>
+
+namespace ae
+{
+	/// <summary>
+	/// Struct holding the performance counters of an audio player, cheap enough to be polled every frame (i.e. by a debug overlay)<para/>
+	///
+	/// The counters are kept in release builds, they're accumulated until the player's statistics are reset.
+	/// </summary>
+	/// <seealso cref="AudioPlayer::getStats"/>
+	struct AudioStats {
+		std::size_t activeVoices;   ///< The amount of active sound effects or of music tracks playing (or paused)
+		std::size_t realVoices;     ///< The amount of active voices owning a source of the audio backend
+		std::size_t peakVoices;     ///< The highest amount of active voices reached
+		std::size_t plays;          ///< The amount of sound effects or music tracks played
+		float       playsPerSecond; ///< The rate of plays measured over the last second
+		std::size_t droppedPlays;   ///< The amount of plays that failed (unknown ID, decoding or streaming failure)
+		std::size_t culledVoices;   ///< The amount of real voices made virtual for being inaudible
+		std::size_t stolenVoices;   ///< The amount of real voices made virtual to give their source to more important voices
+		std::size_t streams;        ///< The amount of real voices streamed from their file
+		float       minStreamFill;  ///< The lowest fill level (0 - 1) of the buffers of the streams, 1 if none report it
+		std::size_t underruns;      ///< The amount of times the streams ran out of decoded frames
+		sf::Time    renderTime;     ///< The time the audio backend took to render its last block (zero if it doesn't mix in software)
+
+		/// <summary>Default constructor, all counters are set to zero and the stream fill level to 1</summary>
+		AudioStats();
+	};
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,106 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#ifndef Aeon2D_Audio_BiquadFilter_H_
+#define Aeon2D_Audio_BiquadFilter_H_
+
+#include <atomic>
+
+#include "AudioEffect.h"
+
+namespace ae
+{
+	/// <summary>
+	/// Second-order IIR filter (RBJ cookbook biquad) applied to both channels<para/>
+	///
+	/// The left and right channels are filtered together in the lanes of an SSE register, the coefficients are only recomputed when a parameter changes.<br/>
+	/// A low-pass filter with a low cutoff frequency muffles the sources behind walls (occlusion), a high-pass filter thins them out (i.e. radios and telephones).
+	/// </summary>
+	/// <code>
+	/// ae::BiquadFilter occlusion(ae::BiquadFilter::Type::LowPass, 800.f);
+	/// ae::EffectChain chain;
+	/// chain.add(occlusion);
+	/// </code>
+	class BiquadFilter : public AudioEffect
+	{
+	public:
+		/// <summary>The response of the filter</summary>
+		enum class Type { LowPass, HighPass, BandPass };
+
+	public:
+		/// <summary>Constructs the <see cref="BiquadFilter"/> by providing its <paramref name="type"/>, its <paramref name="cutoff"/> frequency and its <paramref name="q"/> factor</summary>
+		/// <param name="type">The response of the filter</param>
+		/// <param name="cutoff">The cutoff (or center) frequency in Hz</param>
+		/// <param name="q">The quality factor (0.7071 gives a flat passband)</param>
+		explicit BiquadFilter(Type type = Type::LowPass, float cutoff = 1000.f, float q = 0.7071f);
+	public:
+		/// <summary>Filters a block of frames in place</summary>
+		/// <param name="frames">The interleaved stereo frames (2 * <paramref name="frameCount"/> floats)</param>
+		/// <param name="frameCount">The amount of frames to process</param>
+		/// <param name="sampleRate">The amount of frames per second</param>
+		virtual void process(float* frames, std::size_t frameCount, unsigned int sampleRate) override;
+		/// <summary>Clears the filter's history</summary>
+		virtual void reset() override;
+		/// <summary>Sets the response of the filter</summary>
+		/// <param name="type">The new response</param>
+		/// <seealso cref="getType"/>
+		void setType(Type type);
+		/// <summary>Retrieves the response of the filter</summary>
+		/// <returns>The response</returns>
+		/// <seealso cref="setType"/>
+		Type getType() const;
+		/// <summary>Sets the cutoff (or center) frequency, clamped below the Nyquist frequency when processed</summary>
+		/// <param name="cutoff">The new cutoff frequency in Hz</param>
+		/// <seealso cref="getCutoff"/>
+		void setCutoff(float cutoff);
+		/// <summary>Retrieves the cutoff (or center) frequency</summary>
+		/// <returns>The cutoff frequency in Hz</returns>
+		/// <seealso cref="setCutoff"/>
+		float getCutoff() const;
+		/// <summary>Sets the quality factor (the resonance around the cutoff frequency)</summary>
+		/// <param name="q">The new quality factor</param>
+		/// <seealso cref="getQ"/>
+		void setQ(float q);
+		/// <summary>Retrieves the quality factor</summary>
+		/// <returns>The quality factor</returns>
+		/// <seealso cref="setQ"/>
+		float getQ() const;
+
+	private:
+		/// <summary>Recomputes the coefficients if a parameter or the <paramref name="sampleRate"/> changed since the last block</summary>
+		/// <param name="sampleRate">The amount of frames per second</param>
+		void updateCoefficients(unsigned int sampleRate);
+
+	private:
+		std::atomic<Type>  type_;       ///< The response of the filter
+		std::atomic<float> cutoff_;     ///< The cutoff frequency
+		std::atomic<float> q_;          ///< The quality factor
+		std::atomic<bool>  dirty_;      ///< Has a parameter changed since the coefficients were computed?
+		unsigned int       sampleRate_; ///< The sample rate of the coefficients
+		float              b0_;         ///< The coefficient of the current input
+		float              b1_;         ///< The coefficient of the previous input
+		float              b2_;         ///< The coefficient of the input before the previous one
+		float              a1_;         ///< The coefficient of the previous output
+		float              a2_;         ///< The coefficient of the output before the previous one
+		float              z1_[2];      ///< The first state of each channel (transposed direct form II)
+		float              z2_[2];      ///< The second state of each channel (transposed direct form II)
+	};
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,115 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#ifndef Aeon2D_Audio_CompressedSoundBuffer_H_
+#define Aeon2D_Audio_CompressedSoundBuffer_H_
+
+#include <string>
+#include <vector>
+
+#include <SFML/Config.hpp>
+#include <SFML/System/Time.hpp>
+
+// Forward Declaration(s)
+namespace sf {
+	class SoundBuffer;
+}
+
+namespace ae
+{
+	/// <summary>
+	/// Sound kept in memory compressed with IMA-ADPCM (4 bits per sample, a quarter of the 16-bit PCM size) and decoded on demand<para/>
+	///
+	/// The samples are split into blocks of 1024 frames, each block keeps the decoder's state at its start so that any frame can be decoded without decoding the whole sound.<br/>
+	/// The encoder's state runs through the whole sound, decoding the blocks one after the other gives the same samples as decoding them separately.
+	/// </summary>
+	/// <code>
+	/// ae::CompressedSoundBuffer compressed;
+	/// compressed.loadFromFile("Assets/Sounds/Explosion.wav");
+	/// sf::SoundBuffer decoded;
+	/// compressed.decode(decoded);
+	/// </code>
+	class CompressedSoundBuffer
+	{
+	public:
+		/// <summary>Default constructor, the buffer is empty</summary>
+		CompressedSoundBuffer();
+	public:
+		/// <summary>Loads and compresses a sound from an audio file</summary>
+		/// <param name="filepath">The path to the audio file</param>
+		/// <returns>True if the file was opened and contains samples, false otherwise</returns>
+		bool loadFromFile(const std::string& filepath);
+		/// <summary>Compresses interleaved 16-bit samples</summary>
+		/// <param name="samples">The interleaved samples (<paramref name="sampleCount"/> samples)</param>
+		/// <param name="sampleCount">The amount of samples of all channels</param>
+		/// <param name="channelCount">The amount of channels</param>
+		/// <param name="sampleRate">The amount of frames per second</param>
+		/// <returns>True if there were samples to compress, false otherwise</returns>
+		bool loadFromSamples(const sf::Int16* samples, sf::Uint64 sampleCount, unsigned int channelCount, unsigned int sampleRate);
+		/// <summary>Decodes interleaved 16-bit samples from any frame</summary>
+		/// <param name="samples">The interleaved samples decoded (<paramref name="frameCount"/> frames)</param>
+		/// <param name="firstFrame">The first frame to decode</param>
+		/// <param name="frameCount">The amount of frames to decode</param>
+		/// <returns>The amount of frames decoded (fewer at the end of the sound)</returns>
+		std::size_t read(sf::Int16* samples, sf::Uint64 firstFrame, std::size_t frameCount) const;
+		/// <summary>Decodes the whole sound into a sound buffer</summary>
+		/// <param name="buffer">The sound buffer receiving the decoded sound</param>
+		/// <returns>True if the sound buffer could be loaded, false otherwise</returns>
+		bool decode(sf::SoundBuffer& buffer) const;
+		/// <summary>Retrieves the length of the sound</summary>
+		/// <returns>The amount of frames</returns>
+		sf::Uint64 getFrameCount() const;
+		/// <summary>Retrieves the amount of channels</summary>
+		/// <returns>The amount of channels</returns>
+		unsigned int getChannelCount() const;
+		/// <summary>Retrieves the amount of frames per second</summary>
+		/// <returns>The sample rate</returns>
+		unsigned int getSampleRate() const;
+		/// <summary>Retrieves the duration of the sound</summary>
+		/// <returns>The duration</returns>
+		sf::Time getDuration() const;
+		/// <summary>Retrieves the memory taken by the compressed sound</summary>
+		/// <returns>The size in bytes</returns>
+		/// <seealso cref="getDecodedSize"/>
+		std::size_t getSize() const;
+		/// <summary>Retrieves the memory taken by the sound once decoded to 16-bit PCM</summary>
+		/// <returns>The size in bytes</returns>
+		/// <seealso cref="getSize"/>
+		std::size_t getDecodedSize() const;
+
+	private:
+		/// <summary>Struct used to represent the state of a channel's decoder at the start of a block</summary>
+		struct BlockState {
+			sf::Int16 predictor; ///< The last sample decoded
+			sf::Uint8 stepIndex; ///< The index of the quantizer's step
+		};
+
+	private:
+		/// <summary>The amount of frames of a block</summary>
+		static const std::size_t BLOCK_FRAMES = 1024;
+
+		std::vector<sf::Uint8>  data_;         ///< The 4-bit codes of the interleaved samples, two per byte
+		std::vector<BlockState> states_;       ///< The state of each channel's decoder at the start of each block
+		sf::Uint64              frameCount_;   ///< The amount of frames
+		unsigned int            channelCount_; ///< The amount of channels
+		unsigned int            sampleRate_;   ///< The amount of frames per second
+	};
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,117 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#ifndef Aeon2D_Audio_Compressor_H_
+#define Aeon2D_Audio_Compressor_H_
+
+#include <atomic>
+
+#include <SFML/System/Time.hpp>
+
+#include "AudioEffect.h"
+
+namespace ae
+{
+	/// <summary>
+	/// Peak compressor reducing the dynamic range of the signal above a threshold, both channels being linked<para/>
+	///
+	/// The envelope and the gain are computed once per run of 16 frames, whose peak is detected with SSE/AVX instructions,
+	/// and the gain is ramped linearly over the run.<br/>
+	/// A high ratio (i.e. 100) with a short attack turns it into a limiter, which keeps a loud bus from clipping.
+	/// </summary>
+	/// <code>
+	/// ae::Compressor limiter(-1.f, 100.f);
+	/// limiter.setAttack(sf::milliseconds(1));
+	/// </code>
+	class Compressor : public AudioEffect
+	{
+	public:
+		/// <summary>
+		/// Constructs the <see cref="Compressor"/> by providing its <paramref name="threshold"/> and its <paramref name="ratio"/><para/>
+		///
+		/// The attack is set to 10 milliseconds, the release to 100 milliseconds and the makeup gain to 0dB.
+		/// </summary>
+		/// <param name="threshold">The level above which the signal is compressed in dBFS</param>
+		/// <param name="ratio">The ratio of the compression (at least 1)</param>
+		explicit Compressor(float threshold = -12.f, float ratio = 4.f);
+	public:
+		/// <summary>Compresses a block of frames in place</summary>
+		/// <param name="frames">The interleaved stereo frames (2 * <paramref name="frameCount"/> floats)</param>
+		/// <param name="frameCount">The amount of frames to process</param>
+		/// <param name="sampleRate">The amount of frames per second</param>
+		virtual void process(float* frames, std::size_t frameCount, unsigned int sampleRate) override;
+		/// <summary>Clears the envelope</summary>
+		virtual void reset() override;
+		/// <summary>Sets the level above which the signal is compressed</summary>
+		/// <param name="threshold">The new threshold in dBFS</param>
+		/// <seealso cref="getThreshold"/>
+		void setThreshold(float threshold);
+		/// <summary>Retrieves the level above which the signal is compressed</summary>
+		/// <returns>The threshold in dBFS</returns>
+		/// <seealso cref="setThreshold"/>
+		float getThreshold() const;
+		/// <summary>Sets the ratio of the compression (i.e. 4 for 4:1), clamped to at least 1</summary>
+		/// <param name="ratio">The new ratio</param>
+		/// <seealso cref="getRatio"/>
+		void setRatio(float ratio);
+		/// <summary>Retrieves the ratio of the compression</summary>
+		/// <returns>The ratio</returns>
+		/// <seealso cref="setRatio"/>
+		float getRatio() const;
+		/// <summary>Sets the time taken by the envelope to follow a rising level</summary>
+		/// <param name="attack">The new attack time</param>
+		/// <seealso cref="getAttack"/>
+		void setAttack(sf::Time attack);
+		/// <summary>Retrieves the time taken by the envelope to follow a rising level</summary>
+		/// <returns>The attack time</returns>
+		/// <seealso cref="setAttack"/>
+		sf::Time getAttack() const;
+		/// <summary>Sets the time taken by the envelope to follow a falling level</summary>
+		/// <param name="release">The new release time</param>
+		/// <seealso cref="getRelease"/>
+		void setRelease(sf::Time release);
+		/// <summary>Retrieves the time taken by the envelope to follow a falling level</summary>
+		/// <returns>The release time</returns>
+		/// <seealso cref="setRelease"/>
+		sf::Time getRelease() const;
+		/// <summary>Sets the gain applied after the compression</summary>
+		/// <param name="makeupGain">The new makeup gain in dB</param>
+		/// <seealso cref="getMakeupGain"/>
+		void setMakeupGain(float makeupGain);
+		/// <summary>Retrieves the gain applied after the compression</summary>
+		/// <returns>The makeup gain in dB</returns>
+		/// <seealso cref="setMakeupGain"/>
+		float getMakeupGain() const;
+		/// <summary>Retrieves the gain reduction applied at the end of the last block (i.e. for a meter)</summary>
+		/// <returns>The gain reduction in dB (0 or positive)</returns>
+		float getGainReduction() const;
+
+	private:
+		std::atomic<float>     threshold_;  ///< The threshold in dBFS
+		std::atomic<float>     ratio_;      ///< The ratio of the compression
+		std::atomic<sf::Int64> attack_;     ///< The attack time in microseconds
+		std::atomic<sf::Int64> release_;    ///< The release time in microseconds
+		std::atomic<float>     makeupGain_; ///< The makeup gain in dB
+		std::atomic<float>     reduction_;  ///< The gain reduction of the last block in dB
+		float                  envelope_;   ///< The peak envelope followed
+		float                  gain_;       ///< The linear gain applied at the end of the last run
+	};
+}
+#endif
\ No newline at end of file
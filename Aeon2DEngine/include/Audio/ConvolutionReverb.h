@@ -0,0 +1,156 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#ifndef Aeon2D_Audio_ConvolutionReverb_H_
+#define Aeon2D_Audio_ConvolutionReverb_H_
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <mutex>
+
+#include "AudioEffect.h"
+#include "FFT.h"
+
+namespace ae
+{
+	/// <summary>
+	/// Reverb convolving the signal with the recorded impulse response of a real room (partitioned FFT convolution)<para/>
+	///
+	/// The impulse response is split into stages of uniform partitions that grow along the response: 128 frames for the head, then 1024 and 8192 frames for the tail.<br/>
+	/// Each stage convolves its partitions in the frequency domain through a delay line of past input spectra, so the latency of the reverberated signal is only the first partition's (128 frames, 2.7 ms at 48 kHz).<br/>
+	/// The stages are prepared by the next block processed after an impulse response is provided (and again if the sample rate changes), the response is resampled to the mixer's rate and normalized to unit energy.<br/>
+	/// A mono response is applied to both channels, a stereo response convolves each channel with its own.
+	/// </summary>
+	/// <code>
+	/// ae::ConvolutionReverb cathedral;
+	/// cathedral.loadFromFile("Assets/IR/cathedral.wav");
+	/// cathedral.setWet(0.5f);
+	/// ae::EffectChain chain;
+	/// chain.add(cathedral);
+	/// ae::AudioBus sfx;
+	/// sfx.setEffects(&amp;chain);
+	/// soundPlayer.setBus(sfx, SoundID::ID1);
+	/// </code>
+	class ConvolutionReverb : public AudioEffect
+	{
+	public:
+		/// <summary>
+		/// Default constructor<para/>
+		///
+		/// The wet level is set to 0.3 and the dry level to 1, the signal passes through untouched until an impulse response is provided.
+		/// </summary>
+		ConvolutionReverb();
+	public:
+		/// <summary>Loads the impulse response from an audio file (only its first two channels are used)</summary>
+		/// <param name="filepath">The path to the audio file</param>
+		/// <returns>True if the file was opened and contains samples, false otherwise</returns>
+		/// <seealso cref="setImpulseResponse"/>
+		bool loadFromFile(const std::string& filepath);
+		/// <summary>Sets the impulse response from interleaved float samples (only its first two channels are used)</summary>
+		/// <param name="samples">The interleaved samples (<paramref name="frameCount"/> * <paramref name="channelCount"/> floats)</param>
+		/// <param name="frameCount">The length of the impulse response in frames</param>
+		/// <param name="channelCount">The amount of channels</param>
+		/// <param name="sampleRate">The amount of frames per second</param>
+		/// <seealso cref="loadFromFile"/>
+		void setImpulseResponse(const float* samples, std::size_t frameCount, unsigned int channelCount, unsigned int sampleRate);
+		/// <summary>Adds the convolved signal to a block of frames in place</summary>
+		/// <param name="frames">The interleaved stereo frames (2 * <paramref name="frameCount"/> floats)</param>
+		/// <param name="frameCount">The amount of frames to process</param>
+		/// <param name="sampleRate">The amount of frames per second</param>
+		virtual void process(float* frames, std::size_t frameCount, unsigned int sampleRate) override;
+		/// <summary>Clears the reverb's tail</summary>
+		virtual void reset() override;
+		/// <summary>Sets the level of the reverberated signal (0 - 1)</summary>
+		/// <param name="wet">The new wet level</param>
+		/// <seealso cref="getWet"/>
+		void setWet(float wet);
+		/// <summary>Retrieves the level of the reverberated signal (0 - 1)</summary>
+		/// <returns>The wet level</returns>
+		/// <seealso cref="setWet"/>
+		float getWet() const;
+		/// <summary>Sets the level of the original signal (0 - 1)</summary>
+		/// <param name="dry">The new dry level</param>
+		/// <seealso cref="getDry"/>
+		void setDry(float dry);
+		/// <summary>Retrieves the level of the original signal (0 - 1)</summary>
+		/// <returns>The dry level</returns>
+		/// <seealso cref="setDry"/>
+		float getDry() const;
+		/// <summary>Retrieves the delay of the reverberated signal behind the original signal</summary>
+		/// <returns>The latency in frames</returns>
+		std::size_t getLatency() const;
+
+	private:
+		/// <summary>Partitions of a uniform size convolving a segment of the impulse response</summary>
+		struct Stage
+		{
+			/// <summary>Constructs the stage by providing the size of its partitions and the position of its segment in the impulse response</summary>
+			/// <param name="blockSize">The amount of frames of each partition</param>
+			/// <param name="offset">The first frame of the segment</param>
+			Stage(std::size_t blockSize, std::size_t offset);
+
+			std::size_t        blockSize;      ///< The amount of frames of each partition
+			std::size_t        offset;         ///< The first frame of the impulse response's segment
+			std::size_t        partitionCount; ///< The amount of partitions of the segment
+			std::size_t        cursor;         ///< The slot of the most recent input spectrum
+			FFT                fft;            ///< The transform of twice the partition's size
+			std::vector<float> filterRe;       ///< The real parts of the partitions' spectra, per channel then per partition
+			std::vector<float> filterIm;       ///< The imaginary parts of the partitions' spectra, per channel then per partition
+			std::vector<float> historyRe;      ///< The real parts of the past input blocks' spectra, per channel then per slot
+			std::vector<float> historyIm;      ///< The imaginary parts of the past input blocks' spectra, per channel then per slot
+			std::vector<float> input;          ///< The previous and current input blocks of each channel
+		};
+
+	private:
+		/// <summary>Builds the stages from the impulse response provided for the <paramref name="sampleRate"/> provided</summary>
+		/// <param name="sampleRate">The amount of frames per second</param>
+		void prepare(unsigned int sampleRate);
+		/// <summary>Convolves the input block that was just completed and adds the result to the output</summary>
+		/// <param name="stage">The stage whose input block is complete</param>
+		void convolve(Stage& stage);
+
+	private:
+		/// <summary>The amount of frames of the first stage's partitions (the latency)</summary>
+		static const std::size_t FIRST_BLOCK_SIZE = 128;
+		/// <summary>The amount of frames of the last stage's partitions</summary>
+		static const std::size_t LAST_BLOCK_SIZE = 8192;
+		/// <summary>The growth of the partitions' size from one stage to the next</summary>
+		static const std::size_t GROWTH = 8;
+
+		std::atomic<float> wet_;              ///< The level of the reverberated signal
+		std::atomic<float> dry_;              ///< The level of the original signal
+		std::atomic<bool>  dirty_;            ///< Has an impulse response been provided since the stages were built?
+		std::mutex         mutex_;            ///< The mutex protecting the impulse response provided
+		std::vector<float> response_;         ///< The impulse response provided (interleaved)
+		unsigned int       responseChannels_; ///< The amount of channels of the impulse response provided
+		unsigned int       responseRate_;     ///< The sample rate of the impulse response provided
+		unsigned int       sampleRate_;       ///< The sample rate of the stages
+		unsigned int       filterChannels_;   ///< The amount of channels of the stages' spectra
+		std::vector<Stage> stages_;           ///< The stages, from the head of the impulse response to its tail
+		std::vector<float> output_;           ///< The ring buffer of the upcoming reverberated frames (interleaved)
+		std::size_t        outputMask_;       ///< The amount of frames of the ring buffer minus one
+		std::size_t        position_;         ///< The amount of frames processed since the stages were built
+		std::vector<float> sumRe_;            ///< The real parts of the accumulated spectrum
+		std::vector<float> sumIm_;            ///< The imaginary parts of the accumulated spectrum
+		std::vector<float> block_;            ///< The convolved block in the time domain
+	};
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,90 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+
+#ifndef Aeon2D_Audio_DecodePool_H_
+#define Aeon2D_Audio_DecodePool_H_
+
+#include <vector>
+#include <utility>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace ae
+{
+	// Forward Declaration(s)
+	class PooledSampleSource;
+
+	/// <summary>
+	/// Pool of decode threads shared by the <see cref="PooledSampleSource"/>s, decoding their frames ahead of the audio thread<para/>
+	///
+	/// Each thread refills the buffers of the attached sources, those closest to running out of decoded frames first, and sleeps for a few milliseconds once all of them are full.<br/>
+	/// The buffers are refilled in large reads once a fourth of them has been played, a fixed amount of threads serves dozens of streams.<br/>
+	/// A pool without any thread leaves the decoding to the audio thread (i.e. when rendering offline, where the output must be deterministic).
+	/// </summary>
+	/// <code>
+	/// ae::DecodePool pool(1);
+	/// auto source = std::make_unique&lt;ae::FileSampleSource&gt;();
+	/// if (source->openFromFile("Assets/Sounds/Forest.ogg"))
+	///		mixer.createVoice(std::make_unique&lt;ae::PooledSampleSource&gt;(std::move(source), pool));
+	/// </code>
+	class DecodePool
+	{
+	public:
+		/// <summary>Constructs the <see cref="DecodePool"/> by providing its amount of threads and starts them</summary>
+		/// <param name="threadCount">The amount of decode threads (0 to decode on the audio thread)</param>
+		explicit DecodePool(std::size_t threadCount = 1);
+		/// <summary>Deleted copy constructor</summary>
+		/// <param name="copy">The <see cref="DecodePool"/> to be copied</param>
+		DecodePool(const DecodePool& copy) = delete;
+		/// <summary>Stops the decode threads, the sources attached must have been destroyed beforehand</summary>
+		~DecodePool();
+	public:
+		/// <summary>Deleted assignment operator</summary>
+		/// <param name="other">The <see cref="DecodePool"/> to be copied</param>
+		/// <returns>The caller <see cref="DecodePool"/></returns>
+		DecodePool& operator=(const DecodePool& other) = delete;
+	public:
+		/// <summary>Retrieves the amount of decode threads</summary>
+		/// <returns>The amount of threads, 0 if the sources are decoded on the audio thread</returns>
+		std::size_t getThreadCount() const;
+
+	private:
+		friend class PooledSampleSource;
+
+		/// <summary>Adds a <paramref name="source"/> to the sources refilled by the decode threads</summary>
+		/// <param name="source">The source to refill</param>
+		void attach(PooledSampleSource& source);
+		/// <summary>Removes a <paramref name="source"/> from the sources refilled, waiting for a decode thread that's still refilling it</summary>
+		/// <param name="source">The source to remove</param>
+		void detach(PooledSampleSource& source);
+		/// <summary>Body of the decode threads</summary>
+		void run();
+
+	private:
+		std::vector<std::thread>         threads_;   ///< The decode threads
+		std::vector<PooledSampleSource*> sources_;   ///< The sources refilled by the decode threads
+		std::mutex                       mutex_;     ///< The mutex protecting the list of sources
+		std::condition_variable          condition_; ///< The condition waking up the decode threads
+		bool                             running_;   ///< Are the decode threads running?
+	};
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,117 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#ifndef Aeon2D_Audio_DecodedSoundCache_H_
+#define Aeon2D_Audio_DecodedSoundCache_H_
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+#include <SFML/Audio/SoundBuffer.hpp>
+
+#include "CompressedSoundBuffer.h"
+
+namespace ae
+{
+	/// <summary>
+	/// Least recently used cache of the decoded copies of compressed sounds<para/>
+	///
+	/// A decoded copy is pinned while it's acquired (i.e. by an active sound effect) and is never evicted before it's released.<br/>
+	/// Once the decoded copies exceed the capacity, the least recently used ones that aren't pinned are evicted.
+	/// </summary>
+	/// <code>
+	/// ae::DecodedSoundCache cache(16 * 1024 * 1024);
+	/// const sf::SoundBuffer* buffer = cache.acquire(compressed);
+	/// ...
+	/// cache.release(compressed);
+	/// </code>
+	class DecodedSoundCache
+	{
+	public:
+		/// <summary>Constructs the <see cref="DecodedSoundCache"/> by providing its capacity</summary>
+		/// <param name="capacity">The memory that the decoded copies may take, in bytes</param>
+		explicit DecodedSoundCache(std::size_t capacity = 32 * 1024 * 1024);
+		/// <summary>Deleted copy constructor</summary>
+		/// <param name="copy">The <see cref="DecodedSoundCache"/> to be copied</param>
+		DecodedSoundCache(const DecodedSoundCache& copy) = delete;
+	public:
+		/// <summary>Deleted assignment operator</summary>
+		/// <param name="other">The <see cref="DecodedSoundCache"/> to be copied</param>
+		/// <returns>The caller <see cref="DecodedSoundCache"/></returns>
+		DecodedSoundCache& operator=(const DecodedSoundCache& other) = delete;
+	public:
+		/// <summary>Retrieves the decoded copy of a compressed sound, decoding it if it isn't cached, and pins it</summary>
+		/// <param name="sound">The compressed sound (it must outlive its decoded copy)</param>
+		/// <returns>The decoded copy, nullptr if it couldn't be decoded</returns>
+		/// <seealso cref="release"/>
+		const sf::SoundBuffer* acquire(const CompressedSoundBuffer& sound);
+		/// <summary>Unpins the decoded copy of a compressed sound acquired before, it may be evicted once it isn't pinned anymore</summary>
+		/// <param name="sound">The compressed sound</param>
+		/// <seealso cref="acquire"/>
+		void release(const CompressedSoundBuffer& sound);
+		/// <summary>Removes the decoded copy of a compressed sound (i.e. before destroying the compressed sound), it must not be pinned</summary>
+		/// <param name="sound">The compressed sound</param>
+		void remove(const CompressedSoundBuffer& sound);
+		/// <summary>Sets the memory that the decoded copies may take, evicting the least recently used ones that exceed it</summary>
+		/// <param name="capacity">The new capacity in bytes</param>
+		/// <seealso cref="getCapacity"/>
+		void setCapacity(std::size_t capacity);
+		/// <summary>Retrieves the memory that the decoded copies may take</summary>
+		/// <returns>The capacity in bytes</returns>
+		/// <seealso cref="setCapacity"/>
+		std::size_t getCapacity() const;
+		/// <summary>Retrieves the memory taken by the decoded copies (more than the capacity if too many of them are pinned)</summary>
+		/// <returns>The size in bytes</returns>
+		std::size_t getSize() const;
+		/// <summary>Retrieves the amount of acquisitions that found their decoded copy in the cache</summary>
+		/// <returns>The amount of hits</returns>
+		/// <seealso cref="getMissCount"/>
+		std::size_t getHitCount() const;
+		/// <summary>Retrieves the amount of acquisitions that had to decode their sound</summary>
+		/// <returns>The amount of misses</returns>
+		/// <seealso cref="getHitCount"/>
+		std::size_t getMissCount() const;
+
+	private:
+		/// <summary>Struct used to represent a decoded copy</summary>
+		struct Entry {
+			const CompressedSoundBuffer*     sound;  ///< The compressed sound
+			std::unique_ptr<sf::SoundBuffer> buffer; ///< The decoded copy
+			std::size_t                      size;   ///< The memory taken by the decoded copy
+			std::size_t                      pins;   ///< The amount of acquisitions not released yet
+		};
+		/// <summary>The position of a decoded copy in the list of the decoded copies</summary>
+		using EntryIterator = std::list<Entry>::iterator;
+
+	private:
+		/// <summary>Evicts the least recently used decoded copies that aren't pinned until the capacity is respected</summary>
+		void evict();
+
+	private:
+		std::list<Entry>                                                entries_;  ///< The decoded copies, from the most recently used to the least
+		std::unordered_map<const CompressedSoundBuffer*, EntryIterator> index_;    ///< The decoded copy of each compressed sound
+		std::size_t                                                     capacity_; ///< The memory that the decoded copies may take
+		std::size_t                                                     size_;     ///< The memory taken by the decoded copies
+		std::size_t                                                     hits_;     ///< The amount of acquisitions served by the cache
+		std::size_t                                                     misses_;   ///< The amount of acquisitions that decoded their sound
+	};
+}
+#endif
\ No newline at end of file
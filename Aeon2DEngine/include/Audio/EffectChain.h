@@ -0,0 +1,112 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#ifndef Aeon2D_Audio_EffectChain_H_
+#define Aeon2D_Audio_EffectChain_H_
+
+#include <vector>
+#include <mutex>
+#include <atomic>
+
+#include <SFML/System/Time.hpp>
+
+#include "AudioEffect.h"
+
+namespace ae
+{
+	/// <summary>
+	/// Ordered list of <see cref="AudioEffect"/> processing a block of stereo frames one after the other<para/>
+	///
+	/// An effect chain is given to an <see cref="AudioBus"/> (the effects then process the submix of the bus) or to a single sound effect or music track.<br/>
+	/// It's processed on the audio thread by backends mixing in software (i.e. a <see cref="SoftwareAudioBackend"/>), the other backends ignore it.<br/>
+	/// The effects are owned by the caller and must outlive the chain, the chain must outlive the buses and sources using it.
+	/// </summary>
+	/// <code>
+	/// ae::BiquadFilter occlusion(ae::BiquadFilter::Type::LowPass, 800.f);
+	/// ae::Reverb cave;
+	/// ae::EffectChain chain;
+	/// chain.add(occlusion);
+	/// chain.add(cave);
+	/// soundPlayer.getBus().setEffects(&amp;chain);
+	/// </code>
+	class EffectChain
+	{
+	public:
+		/// <summary>Default constructor</summary>
+		EffectChain();
+		/// <summary>Deleted copy constructor</summary>
+		/// <param name="copy">The <see cref="EffectChain"/> to be copied</param>
+		EffectChain(const EffectChain& copy) = delete;
+	public:
+		/// <summary>Deleted assignment operator</summary>
+		/// <param name="other">The <see cref="EffectChain"/> to be copied</param>
+		/// <returns>The caller <see cref="EffectChain"/></returns>
+		EffectChain& operator=(const EffectChain& other) = delete;
+	public:
+		/// <summary>Appends an <paramref name="effect"/> at the end of the chain</summary>
+		/// <param name="effect">The effect to append</param>
+		/// <seealso cref="remove"/>
+		void add(AudioEffect& effect);
+		/// <summary>Removes an <paramref name="effect"/> from the chain</summary>
+		/// <param name="effect">The effect to remove</param>
+		/// <seealso cref="add"/>
+		void remove(AudioEffect& effect);
+		/// <summary>Removes all the effects from the chain</summary>
+		void clear();
+		/// <summary>Retrieves the amount of effects in the chain</summary>
+		/// <returns>The amount of effects</returns>
+		std::size_t getEffectCount() const;
+		/// <summary>Sets whether the chain lets the frames through unprocessed</summary>
+		/// <param name="flag">True to bypass the effects, false otherwise</param>
+		/// <seealso cref="isBypassed"/>
+		void setBypassed(bool flag);
+		/// <summary>Checks whether the chain lets the frames through unprocessed</summary>
+		/// <returns>True if the effects are bypassed, false otherwise</returns>
+		/// <seealso cref="setBypassed"/>
+		bool isBypassed() const;
+		/// <summary>Processes a block of frames in place with each effect, in order (audio thread)</summary>
+		/// <param name="frames">The interleaved stereo frames (2 * <paramref name="frameCount"/> floats)</param>
+		/// <param name="frameCount">The amount of frames to process</param>
+		/// <param name="sampleRate">The amount of frames per second</param>
+		void process(float* frames, std::size_t frameCount, unsigned int sampleRate);
+		/// <summary>Clears the internal state of each effect</summary>
+		void reset();
+		/// <summary>
+		/// Retrieves the time taken by the last call to <see cref="process"/><para/>
+		///
+		/// Dividing <see cref="getLastFrameCount"/> by it gives the throughput of the chain in frames per second on one core.
+		/// </summary>
+		/// <returns>The duration of the last process</returns>
+		/// <seealso cref="getLastFrameCount"/>
+		sf::Time getLastProcessTime() const;
+		/// <summary>Retrieves the amount of frames processed by the last call to <see cref="process"/></summary>
+		/// <returns>The amount of frames of the last process</returns>
+		/// <seealso cref="getLastProcessTime"/>
+		std::size_t getLastFrameCount() const;
+
+	private:
+		std::vector<AudioEffect*> effects_;         ///< The effects, in processing order
+		std::atomic<bool>         bypassed_;        ///< Are the effects bypassed?
+		std::atomic<sf::Int64>    lastProcessTime_; ///< The duration of the last process in microseconds
+		std::atomic<std::size_t>  lastFrameCount_;  ///< The amount of frames of the last process
+		mutable std::mutex        mutex_;           ///< Mutex protecting the effects between the game and the audio thread
+	};
+}
+#endif
\ No newline at end of file
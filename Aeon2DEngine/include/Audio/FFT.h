@@ -0,0 +1,81 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#ifndef Aeon2D_Audio_FFT_H_
+#define Aeon2D_Audio_FFT_H_
+
+#include <vector>
+
+namespace ae
+{
+	/// <summary>
+	/// Fast Fourier transform of real signals of a fixed power-of-two size<para/>
+	///
+	/// The spectra are stored in split format (the real parts and the imaginary parts in separate arrays) so they can be multiplied four bins at a time.<br/>
+	/// A real signal of N samples is transformed through a complex transform of N / 2 points (radix-2, iterative, precomputed twiddle factors).
+	/// </summary>
+	/// <code>
+	/// ae::FFT fft(256);
+	/// std::vector&lt;float&gt; real(fft.getBinCount()), imag(fft.getBinCount());
+	/// fft.forward(signal.data(), real.data(), imag.data());
+	/// fft.inverse(real.data(), imag.data(), signal.data());
+	/// </code>
+	class FFT
+	{
+	public:
+		/// <summary>Constructs the <see cref="FFT"/> by providing the amount of samples of the real signals</summary>
+		/// <param name="size">The amount of samples, a power of two (rounded up otherwise, 4 minimum)</param>
+		explicit FFT(std::size_t size);
+	public:
+		/// <summary>Computes the spectrum of a real signal</summary>
+		/// <param name="input">The signal's samples (<see cref="getSize"/> floats)</param>
+		/// <param name="real">The real parts of the bins (<see cref="getBinCount"/> floats)</param>
+		/// <param name="imag">The imaginary parts of the bins (<see cref="getBinCount"/> floats)</param>
+		/// <seealso cref="inverse"/>
+		void forward(const float* input, float* real, float* imag);
+		/// <summary>Computes the real signal of a spectrum, scaled so that the inverse of the forward transform gives back the original signal</summary>
+		/// <param name="real">The real parts of the bins (<see cref="getBinCount"/> floats)</param>
+		/// <param name="imag">The imaginary parts of the bins (<see cref="getBinCount"/> floats)</param>
+		/// <param name="output">The signal's samples (<see cref="getSize"/> floats)</param>
+		/// <seealso cref="forward"/>
+		void inverse(const float* real, const float* imag, float* output);
+		/// <summary>Retrieves the amount of samples of the real signals</summary>
+		/// <returns>The amount of samples</returns>
+		std::size_t getSize() const;
+		/// <summary>Retrieves the amount of bins of the spectra (half the size plus one, up to the Nyquist frequency)</summary>
+		/// <returns>The amount of bins</returns>
+		std::size_t getBinCount() const;
+
+	private:
+		/// <summary>Computes the forward complex transform of the working buffers in place</summary>
+		void transform();
+
+	private:
+		std::size_t              size_;     ///< The amount of samples of the real signals
+		std::vector<std::size_t> reversal_; ///< The bit-reversed index of each point of the complex transform
+		std::vector<float>       stageRe_;  ///< The real parts of the twiddle factors of each stage, one stage after the other
+		std::vector<float>       stageIm_;  ///< The imaginary parts of the twiddle factors of each stage, one stage after the other
+		std::vector<float>       splitRe_;  ///< The real parts of the twiddle factors separating the even and odd samples
+		std::vector<float>       splitIm_;  ///< The imaginary parts of the twiddle factors separating the even and odd samples
+		std::vector<float>       workRe_;   ///< The real parts of the complex transform's points
+		std::vector<float>       workIm_;   ///< The imaginary parts of the complex transform's points
+	};
+}
+#endif
\ No newline at end of file
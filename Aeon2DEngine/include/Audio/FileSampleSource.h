@@ -0,0 +1,109 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#ifndef Aeon2D_Audio_FileSampleSource_H_
+#define Aeon2D_Audio_FileSampleSource_H_
+
+#include <string>
+#include <memory>
+
+#include <SFML/Audio/InputSoundFile.hpp>
+#include <SFML/System/InputStream.hpp>
+
+#include "SampleSource.h"
+
+namespace ae
+{
+	/// <summary>
+	/// Sample source decoding the frames of an audio file (.wav, .ogg, .flac) as they're read<para/>
+	///
+	/// The file may be read from the disk, from a region of memory (i.e. a memory-mapped archive) or from a custom sf::InputStream (i.e. an archive entry).
+	/// </summary>
+	class FileSampleSource : public SampleSource
+	{
+	public:
+		/// <summary>Default constructor</summary>
+		FileSampleSource();
+	public:
+		/// <summary>Opens the audio file located at the <paramref name="filepath"/> provided</summary>
+		/// <param name="filepath">The audio file's filepath</param>
+		/// <returns>True if the file could be opened, false otherwise</returns>
+		/// <code>
+		/// auto source = std::make_unique&lt;ae::FileSampleSource&gt;();
+		/// if (source->openFromFile("Assets/Music/Theme.ogg"))
+		///		...
+		/// </code>
+		bool openFromFile(const std::string& filepath);
+		/// <summary>
+		/// Opens the audio file held by a region of memory<para/>
+		///
+		/// The <paramref name="data"/> isn't copied, it's decoded in place and must remain alive as long as the <see cref="FileSampleSource"/> exists.<br/>
+		/// The reads of a memory-mapped region are served by the OS page cache, so several sources may stream the same region at once.
+		/// </summary>
+		/// <param name="data">The first byte of the audio file</param>
+		/// <param name="size">The size of the audio file in bytes</param>
+		/// <returns>True if the file could be opened, false otherwise</returns>
+		/// <code>
+		/// auto source = std::make_unique&lt;ae::FileSampleSource&gt;();
+		/// if (source->openFromMemory(archive.getData() + entry.offset, entry.size))
+		///		...
+		/// </code>
+		bool openFromMemory(const void* data, std::size_t size);
+		/// <summary>
+		/// Opens the audio file read by a custom <paramref name="stream"/><para/>
+		///
+		/// The <see cref="FileSampleSource"/> takes ownership of the <paramref name="stream"/>, it's only read by the thread decoding the source.
+		/// </summary>
+		/// <param name="stream">The stream reading the audio file (i.e. over an archive entry)</param>
+		/// <returns>True if the file could be opened, false otherwise</returns>
+		/// <code>
+		/// auto source = std::make_unique&lt;ae::FileSampleSource&gt;();
+		/// if (source->openFromStream(std::make_unique&lt;ArchiveEntryStream&gt;(archive, "Music/Theme.ogg")))
+		///		...
+		/// </code>
+		bool openFromStream(std::unique_ptr<sf::InputStream> stream);
+		/// <summary>
+		/// Reads the next frames of the file<para/>
+		///
+		/// Less frames than requested are only read once the end of the file has been reached.
+		/// </summary>
+		/// <param name="samples">The interleaved samples read (at least <paramref name="frameCount"/> * channel count)</param>
+		/// <param name="frameCount">The maximum amount of frames to read</param>
+		/// <returns>The amount of frames read</returns>
+		virtual std::size_t read(sf::Int16* samples, std::size_t frameCount) override;
+		/// <summary>Changes the position of the next frame to read</summary>
+		/// <param name="frame">The index of the next frame to read</param>
+		virtual void seek(sf::Uint64 frame) override;
+		/// <summary>Retrieves the total amount of frames of the file</summary>
+		/// <returns>The amount of frames</returns>
+		virtual sf::Uint64 getFrameCount() const override;
+		/// <summary>Retrieves the amount of channels of the file</summary>
+		/// <returns>The amount of channels</returns>
+		virtual unsigned int getChannelCount() const override;
+		/// <summary>Retrieves the amount of frames per second of the file</summary>
+		/// <returns>The sample rate</returns>
+		virtual unsigned int getSampleRate() const override;
+
+	private:
+		std::unique_ptr<sf::InputStream> stream_; ///< The custom stream read by the audio file (nullptr if there's none)
+		sf::InputSoundFile               file_;   ///< The audio file decoded
+	};
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,132 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+
+#ifndef Aeon2D_Audio_LayeredSampleSource_H_
+#define Aeon2D_Audio_LayeredSampleSource_H_
+
+#include <vector>
+#include <memory>
+#include <mutex>
+
+#include "SampleSource.h"
+
+namespace ae
+{
+	/// <summary>
+	/// Sample source mixing down the stems read side by side from another sample source (i.e. a <see cref="StemSampleSource"/> decoded ahead), each layer with its own gain<para/>
+	///
+	/// The stems are read together, so they stay sample-locked whatever their gains, and are mixed into the channels of a single stem.<br/>
+	/// The gains are ramped as the frames are read (audio side), a gain change isn't delayed by the frames of the stems already decoded ahead.
+	/// </summary>
+	class LayeredSampleSource : public SampleSource
+	{
+	public:
+		/// <summary>Constructs the <see cref="LayeredSampleSource"/> by providing the sample source of the <paramref name="stems"/> and their amount, the layers start at full gain</summary>
+		/// <param name="stems">The sample source reading the frames of all the stems side by side</param>
+		/// <param name="layerCount">The amount of stems, the amount of channels of the <paramref name="stems"/> must be a multiple of it</param>
+		/// <code>
+		/// auto stems = std::make_unique&lt;ae::StemSampleSource&gt;();
+		/// if (stems->openFromFiles({ "Assets/Music/Drums.ogg", "Assets/Music/Bass.ogg" }))
+		///		source = std::make_unique&lt;ae::LayeredSampleSource&gt;(std::move(stems), 2);
+		/// </code>
+		LayeredSampleSource(std::unique_ptr<SampleSource> stems, std::size_t layerCount);
+		/// <summary>Deleted copy constructor</summary>
+		/// <param name="copy">The <see cref="LayeredSampleSource"/> to be copied</param>
+		LayeredSampleSource(const LayeredSampleSource& copy) = delete;
+	public:
+		/// <summary>Deleted assignment operator</summary>
+		/// <param name="other">The <see cref="LayeredSampleSource"/> to be copied</param>
+		/// <returns>The caller <see cref="LayeredSampleSource"/></returns>
+		LayeredSampleSource& operator=(const LayeredSampleSource& other) = delete;
+	public:
+		/// <summary>
+		/// Ramps the gain (0 - 1) of a <paramref name="layer"/> to the <paramref name="gain"/> provided over a number of frames<para/>
+		///
+		/// It may be called from any thread, the ramp starts with the next frames read.
+		/// </summary>
+		/// <param name="layer">The index of the layer (the index of its stem)</param>
+		/// <param name="gain">The gain reached at the end of the ramp</param>
+		/// <param name="rampFrames">The duration of the ramp in frames (0 to apply the <paramref name="gain"/> straight away)</param>
+		void setLayerGain(std::size_t layer, float gain, std::size_t rampFrames);
+		/// <summary>Retrieves the amount of layers</summary>
+		/// <returns>The amount of layers</returns>
+		std::size_t getLayerCount() const;
+		/// <summary>
+		/// Reads the next frames of the stems and mixes them down<para/>
+		///
+		/// Less frames than requested are read once the end of the stems has been reached or if the source of the stems fell behind.
+		/// </summary>
+		/// <param name="samples">The interleaved samples read (at least <paramref name="frameCount"/> * channel count)</param>
+		/// <param name="frameCount">The maximum amount of frames to read</param>
+		/// <returns>The amount of frames read</returns>
+		virtual std::size_t read(sf::Int16* samples, std::size_t frameCount) override;
+		/// <summary>Changes the position of the next frame to read, for all the stems</summary>
+		/// <param name="frame">The index of the next frame to read</param>
+		virtual void seek(sf::Uint64 frame) override;
+		/// <summary>Retrieves the total amount of frames of the stems</summary>
+		/// <returns>The amount of frames</returns>
+		virtual sf::Uint64 getFrameCount() const override;
+		/// <summary>Retrieves the amount of channels of the mix, those of a single stem</summary>
+		/// <returns>The amount of channels</returns>
+		virtual unsigned int getChannelCount() const override;
+		/// <summary>Retrieves the amount of frames per second of the stems</summary>
+		/// <returns>The sample rate</returns>
+		virtual unsigned int getSampleRate() const override;
+		/// <summary>Retrieves the state of the buffer of the source of the stems</summary>
+		/// <param name="fill">The fill level (0 - 1) of the buffer</param>
+		/// <param name="underruns">The amount of reads that lacked decoded frames</param>
+		/// <returns>True if the source of the stems has a buffer, false otherwise</returns>
+		virtual bool getBufferState(float& fill, std::size_t& underruns) const override;
+		/// <summary>Changes the size of the buffer of the source of the stems and of the chunks it decodes at once</summary>
+		/// <param name="bufferFrames">The amount of frames decoded ahead</param>
+		/// <param name="chunkFrames">The minimum amount of frames decoded at once, 0 for the source's default</param>
+		/// <returns>True if the source of the stems has a buffer, false otherwise</returns>
+		virtual bool setBuffering(std::size_t bufferFrames, std::size_t chunkFrames) override;
+
+	private:
+		/// <summary>Struct used to represent the gain of a layer</summary>
+		struct Layer {
+			float       gain;     ///< The current gain of the layer
+			float       target;   ///< The gain reached at the end of the ramp
+			float       step;     ///< The gain added per frame while ramping
+			std::size_t rampLeft; ///< The amount of frames left in the ramp
+		};
+		/// <summary>Struct used to represent a gain change requested and not yet applied by the audio side</summary>
+		struct GainChange {
+			std::size_t layer;      ///< The index of the layer
+			float       gain;       ///< The gain reached at the end of the ramp
+			std::size_t rampFrames; ///< The duration of the ramp in frames
+		};
+
+	private:
+		/// <summary>Applies the gain changes requested since the last read</summary>
+		void applyGainChanges();
+
+	private:
+		std::unique_ptr<SampleSource> stems_;        ///< The sample source reading the stems side by side
+		const unsigned int            CHANNEL_COUNT; ///< The amount of channels of a stem
+		std::vector<Layer>            layers_;       ///< The gains of the layers, in the order of their stems
+		std::vector<GainChange>       changes_;      ///< The gain changes requested (protected by the mutex)
+		std::vector<sf::Int16>        stemSamples_;  ///< The samples of the stems read side by side
+		std::mutex                    mutex_;        ///< The mutex protecting the gain changes requested
+	};
+}
+#endif
\ No newline at end of file
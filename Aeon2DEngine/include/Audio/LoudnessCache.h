@@ -0,0 +1,82 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+
+#ifndef Aeon2D_Audio_LoudnessCache_H_
+#define Aeon2D_Audio_LoudnessCache_H_
+
+#include <string>
+#include <unordered_map>
+#include <mutex>
+
+#include <SFML/Config.hpp>
+
+namespace ae
+{
+	/// <summary>
+	/// Sidecar file keeping the integrated loudness measured for the audio files so that later launches skip the analysis<para/>
+	///
+	/// Each entry records the size of the audio file measured, an entry whose file changed size is measured again.<br/>
+	/// The entries are appended to the sidecar file as they're stored, the cache can be used from several threads at once.
+	/// </summary>
+	/// <code>
+	/// ae::LoudnessCache cache("Assets/loudness.cache");
+	/// soundPlayer.setLoudnessCache(&amp;cache);
+	/// soundPlayer.setLoudnessTarget(-18.f);
+	/// </code>
+	class LoudnessCache
+	{
+	public:
+		/// <summary>Constructs the <see cref="LoudnessCache"/> by providing the <paramref name="filepath"/> of its sidecar file, reading its entries if it exists</summary>
+		/// <param name="filepath">The sidecar file's filepath</param>
+		explicit LoudnessCache(const std::string& filepath);
+		/// <summary>Deleted copy constructor</summary>
+		/// <param name="copy">The <see cref="LoudnessCache"/> to be copied</param>
+		LoudnessCache(const LoudnessCache& copy) = delete;
+	public:
+		/// <summary>Deleted assignment operator</summary>
+		/// <param name="other">The <see cref="LoudnessCache"/> to be copied</param>
+		/// <returns>The caller <see cref="LoudnessCache"/></returns>
+		LoudnessCache& operator=(const LoudnessCache& other) = delete;
+	public:
+		/// <summary>Retrieves the loudness stored for the audio file located at the <paramref name="filepath"/> provided</summary>
+		/// <param name="filepath">The audio file's filepath</param>
+		/// <param name="loudness">The integrated loudness in LUFS (unchanged if there's no valid entry)</param>
+		/// <returns>True if an entry was found for the current version of the file, false otherwise</returns>
+		bool find(const std::string& filepath, float& loudness) const;
+		/// <summary>Stores the loudness measured for the audio file located at the <paramref name="filepath"/> provided and appends it to the sidecar file</summary>
+		/// <param name="filepath">The audio file's filepath</param>
+		/// <param name="loudness">The integrated loudness in LUFS</param>
+		void store(const std::string& filepath, float loudness);
+
+	private:
+		/// <summary>Struct used to represent the loudness of an audio file</summary>
+		struct Entry {
+			sf::Uint64 size;     ///< The size of the audio file measured
+			float      loudness; ///< The integrated loudness in LUFS
+		};
+
+	private:
+		const std::string                      FILEPATH; ///< The sidecar file's filepath
+		std::unordered_map<std::string, Entry> entries_; ///< The loudness of each audio file
+		mutable std::mutex                     mutex_;   ///< The mutex protecting the entries and the sidecar file
+	};
+}
+#endif
\ No newline at end of file
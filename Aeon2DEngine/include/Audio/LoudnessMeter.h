@@ -0,0 +1,90 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+
+#ifndef Aeon2D_Audio_LoudnessMeter_H_
+#define Aeon2D_Audio_LoudnessMeter_H_
+
+#include <vector>
+
+#include <SFML/Audio/SoundBuffer.hpp>
+
+#include "SampleSource.h"
+
+namespace ae
+{
+	/// <summary>
+	/// Meter measuring the integrated loudness of a sound (ITU-R BS.1770) in LUFS<para/>
+	///
+	/// The frames are K-weighted, their energy is measured over 400ms blocks overlapping by 75% and the blocks are gated
+	/// (absolute gate at -70 LUFS, relative gate 10 LU below the loudness of the blocks above the absolute gate).<br/>
+	/// Sounds shorter than a block are measured as a single block.
+	/// </summary>
+	/// <code>
+	/// const float LOUDNESS = ae::LoudnessMeter::measure(buffer);
+	/// const float GAIN = std::pow(10.f, (-23.f - LOUDNESS) / 20.f);
+	/// </code>
+	class LoudnessMeter
+	{
+	public:
+		/// <summary>Constructs the <see cref="LoudnessMeter"/> by providing the format of the frames measured</summary>
+		/// <param name="channelCount">The amount of channels (all channels are weighted equally)</param>
+		/// <param name="sampleRate">The amount of frames per second</param>
+		LoudnessMeter(unsigned int channelCount, unsigned int sampleRate);
+	public:
+		/// <summary>Measures the integrated loudness of a sound <paramref name="buffer"/></summary>
+		/// <param name="buffer">The sound buffer to measure</param>
+		/// <returns>The integrated loudness in LUFS, -infinity if the sound is silent</returns>
+		static float measure(const sf::SoundBuffer& buffer);
+		/// <summary>Measures the integrated loudness of a sample <paramref name="source"/> by reading it from its current position to its end</summary>
+		/// <param name="source">The sample source to measure</param>
+		/// <returns>The integrated loudness in LUFS, -infinity if the sound is silent</returns>
+		static float measure(SampleSource& source);
+		/// <summary>Measures the next frames of the sound</summary>
+		/// <param name="samples">The interleaved samples (<paramref name="frameCount"/> * channel count)</param>
+		/// <param name="frameCount">The amount of frames</param>
+		void process(const sf::Int16* samples, std::size_t frameCount);
+		/// <summary>Retrieves the integrated loudness of the frames measured so far</summary>
+		/// <returns>The integrated loudness in LUFS, -infinity if the frames are silent</returns>
+		float getIntegratedLoudness() const;
+		/// <summary>Forgets the frames measured so far</summary>
+		void reset();
+
+	private:
+		/// <summary>Struct used to represent the state of the K-weighting filter of a channel</summary>
+		struct ChannelState {
+			double shelf[2]; ///< The last two outputs of the high-shelf stage (transposed direct form II)
+			double pass[2];  ///< The last two outputs of the high-pass stage (transposed direct form II)
+		};
+
+	private:
+		const unsigned int        CHANNEL_COUNT; ///< The amount of channels
+		const std::size_t         STEP_FRAMES;   ///< The amount of frames of a step (100ms, a quarter of a block)
+		double                    shelfB_[3];    ///< The feed-forward coefficients of the high-shelf stage
+		double                    shelfA_[2];    ///< The feedback coefficients of the high-shelf stage
+		double                    passB_[3];     ///< The feed-forward coefficients of the high-pass stage
+		double                    passA_[2];     ///< The feedback coefficients of the high-pass stage
+		std::vector<ChannelState> channels_;     ///< The state of the filter of each channel
+		std::vector<double>       steps_;        ///< The energy of each complete step
+		double                    stepEnergy_;   ///< The energy of the current step
+		std::size_t               stepFrames_;   ///< The amount of frames of the current step
+	};
+}
+#endif
\ No newline at end of file
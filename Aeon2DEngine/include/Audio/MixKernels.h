@@ -0,0 +1,103 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#ifndef Aeon2D_Audio_MixKernels_H_
+#define Aeon2D_Audio_MixKernels_H_
+
+#include <cstddef>
+
+#include <SFML/Config.hpp>
+
+namespace ae
+{
+	/// <summary>
+	/// Static class providing the vectorized kernels used to mix audio in software<para/>
+	///
+	/// The kernels use AVX or SSE instructions when they're enabled at compile time and fall back to scalar code otherwise.<br/>
+	/// All the float samples are normalized to the range [-1, 1] and multichannel samples are interleaved.
+	/// </summary>
+	class MixKernels
+	{
+	public:
+		/// <summary>
+		/// Deleted default constructor<para/>
+		///
+		/// No instance of this class may be created.
+		/// </summary>
+		MixKernels() = delete;
+	public:
+		/// <summary>Converts 16-bit integer samples to float samples</summary>
+		/// <param name="input">The 16-bit integer samples</param>
+		/// <param name="output">The float samples (at least <paramref name="count"/> of them)</param>
+		/// <param name="count">The amount of samples to convert</param>
+		/// <seealso cref="convertToInt16"/>
+		static void convertToFloat(const sf::Int16* input, float* output, std::size_t count);
+		/// <summary>Converts float samples to 16-bit integer samples, clipping the values outside of the range [-1, 1]</summary>
+		/// <param name="input">The float samples</param>
+		/// <param name="output">The 16-bit integer samples (at least <paramref name="count"/> of them)</param>
+		/// <param name="count">The amount of samples to convert</param>
+		/// <seealso cref="convertToFloat"/>
+		static void convertToInt16(const float* input, sf::Int16* output, std::size_t count);
+		/// <summary>
+		/// Resamples float frames with linear interpolation<para/>
+		///
+		/// The output frame i is interpolated at the input frame <paramref name="position"/> + i * <paramref name="step"/>.<br/>
+		/// The <paramref name="input"/> must therefore hold at least floor(<paramref name="position"/> + (<paramref name="frameCount"/> - 1) * <paramref name="step"/>) + 2 frames.
+		/// </summary>
+		/// <param name="input">The input frames</param>
+		/// <param name="channelCount">The amount of channels of the frames (1 or 2)</param>
+		/// <param name="position">The fractional position of the first output frame in the input frames</param>
+		/// <param name="step">The distance between two output frames in the input frames (i.e. the pitch)</param>
+		/// <param name="output">The output frames</param>
+		/// <param name="frameCount">The amount of frames to output</param>
+		static void resample(const float* input, unsigned int channelCount, float position, float step, float* output, std::size_t frameCount);
+		/// <summary>
+		/// Adds mono frames to stereo frames with a left and a right gain<para/>
+		///
+		/// The gains are ramped linearly from their start values to their end values over the frames to avoid zipper noise.
+		/// </summary>
+		/// <param name="input">The mono frames</param>
+		/// <param name="output">The stereo frames accumulating the result</param>
+		/// <param name="frameCount">The amount of frames to mix</param>
+		/// <param name="startGainLeft">The left gain of the first frame</param>
+		/// <param name="startGainRight">The right gain of the first frame</param>
+		/// <param name="endGainLeft">The left gain reached after the last frame</param>
+		/// <param name="endGainRight">The right gain reached after the last frame</param>
+		/// <seealso cref="mixStereo"/>
+		static void mixMono(const float* input, float* output, std::size_t frameCount,
+		                    float startGainLeft, float startGainRight, float endGainLeft, float endGainRight);
+		/// <summary>
+		/// Adds stereo frames to stereo frames with a left and a right gain<para/>
+		///
+		/// The gains are ramped linearly from their start values to their end values over the frames to avoid zipper noise.
+		/// </summary>
+		/// <param name="input">The stereo frames</param>
+		/// <param name="output">The stereo frames accumulating the result</param>
+		/// <param name="frameCount">The amount of frames to mix</param>
+		/// <param name="startGainLeft">The left gain of the first frame</param>
+		/// <param name="startGainRight">The right gain of the first frame</param>
+		/// <param name="endGainLeft">The left gain reached after the last frame</param>
+		/// <param name="endGainRight">The right gain reached after the last frame</param>
+		/// <seealso cref="mixMono"/>
+		static void mixStereo(const float* input, float* output, std::size_t frameCount,
+		                      float startGainLeft, float startGainRight, float endGainLeft, float endGainRight);
+	};
+}
+#endif
\ No newline at end of file
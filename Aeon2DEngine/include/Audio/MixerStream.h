@@ -0,0 +1,69 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#ifndef Aeon2D_Audio_MixerStream_H_
+#define Aeon2D_Audio_MixerStream_H_
+
+#include <vector>
+
+#include <SFML/Audio/SoundStream.hpp>
+
+namespace ae
+{
+	// Forward Declaration(s)
+	class SoftwareMixer;
+
+	/// <summary>
+	/// Streams the output of a <see cref="SoftwareMixer"/> to the sound card<para/>
+	///
+	/// A single OpenAL source is used no matter how many voices the <see cref="SoftwareMixer"/> is playing.
+	/// </summary>
+	class MixerStream : public sf::SoundStream
+	{
+	public:
+		/// <summary>Constructs the <see cref="MixerStream"/> by providing the <paramref name="mixer"/> to stream and the size of its blocks</summary>
+		/// <param name="mixer">The <see cref="SoftwareMixer"/> whose output will be streamed</param>
+		/// <param name="blockFrames">The amount of frames rendered at once (lower values reduce the latency)</param>
+		/// <code>
+		/// ae::SoftwareMixer mixer;
+		/// ae::MixerStream stream(mixer);
+		/// stream.play();
+		/// </code>
+		explicit MixerStream(SoftwareMixer& mixer, std::size_t blockFrames = 512);
+		/// <summary>Stops the streaming before the <see cref="MixerStream"/> is destroyed</summary>
+		virtual ~MixerStream();
+
+	private:
+		/// <summary>Renders the next block of the <see cref="SoftwareMixer"/></summary>
+		/// <param name="data">The chunk filled with the rendered block</param>
+		/// <returns>True to continue streaming</returns>
+		virtual bool onGetData(Chunk& data) override;
+		/// <summary>The mix can't be seeked, the call is ignored</summary>
+		/// <param name="timeOffset">The new playing position</param>
+		virtual void onSeek(sf::Time timeOffset) override;
+
+	private:
+		SoftwareMixer&         mixer_;       ///< The software mixer streamed
+		const std::size_t      BLOCK_FRAMES; ///< The amount of frames rendered at once
+		std::vector<float>     mixBlock_;    ///< The block rendered by the mixer
+		std::vector<sf::Int16> outputBlock_; ///< The block handed to OpenAL
+	};
+}
+#endif
\ No newline at end of file
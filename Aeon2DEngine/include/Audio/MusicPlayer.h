@@ -22,13 +22,25 @@
 #define Aeon2D_Audio_MusicPlayer_H_
 
 #include <map>
+#include <list>
+#include <deque>
+#include <tuple>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <future>
+#include <functional>
+#include <chrono>
+#include <algorithm>
 
-#include <SFML/Audio/Music.hpp>
+#include <SFML/Audio/SoundSource.hpp>
 
 #ifdef _DEBUG
 #include "../Utils/DebugLogger.h"
 #endif
 #include "AudioPlayer.h"
+#include "StemSampleSource.h"
+#include "LayeredSampleSource.h"
 
 namespace ae
 {
@@ -37,6 +49,25 @@ namespace ae
 	template <typename T>
 	class MusicPlayer : public AudioPlayer<T>
 	{
+	public:
+		/// <summary>Function opening a new stream at the start of a music track's audio file (i.e. over an archive entry), nullptr if it can't be opened</summary>
+		using StreamOpener = std::function<std::unique_ptr<sf::InputStream>()>;
+		/// <summary>Struct used to report a beat or a marker played by a music track, see <see cref="setEventCallback"/></summary>
+		struct MusicEvent {
+			/// <summary>The type of event</summary>
+			enum class Type { Beat, Marker };
+
+			T            music;     ///< The id associated with the music track
+			Type         type;      ///< The type of event
+			std::size_t  index;     ///< The index of the beat counted from the first beat, or the index of the marker in those provided
+			std::size_t  bar;       ///< The bar of the beat counted from the first beat (0 for a marker)
+			unsigned int beat;      ///< The beat within its bar, 0 for the downbeat (0 for a marker)
+			sf::Time     position;  ///< The position of the beat or the marker in the music track
+			sf::Time     clockTime; ///< The time of the audio clock at which the beat or the marker is mixed
+		};
+		/// <summary>Function called by <see cref="update"/> for each beat and marker played since the previous frame</summary>
+		using EventCallback = std::function<void(const MusicEvent&)>;
+
 	public:
 		/// <summary>
 		/// Default constructor<para/>
@@ -44,7 +75,18 @@ namespace ae
 		/// The global volume is set to 100% and the listener's position to (0, 0, 300).<br/>
 		/// The listener's position is the same for both the <see cref="MusicPlayer"/> and the <see cref="SoundPlayer"/>.
 		/// </summary>
-		MusicPlayer() = default;
+		MusicPlayer();
+		/// <summary>
+		/// Constructs the <see cref="MusicPlayer"/> by providing the <paramref name="backend"/> that will stream its music tracks<para/>
+		///
+		/// The <paramref name="backend"/> must outlive the <see cref="MusicPlayer"/>.
+		/// </summary>
+		/// <param name="backend">The <see cref="AudioBackend"/> that will stream the music tracks</param>
+		/// <code>
+		/// ae::NullAudioBackend backend;
+		/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer(backend);
+		/// </code>
+		explicit MusicPlayer(AudioBackend& backend);
 		/// <summary>Deleted copy constructor</summary>
 		/// <param name="copy">The <see cref="MusicPlayer"/> to be copied</param>
 		MusicPlayer(const MusicPlayer<T>& copy) = delete;
@@ -86,6 +128,77 @@ namespace ae
 		/// <seealso cref="load"/>
 		void play(const sf::Vector2f& position, T id, bool loop);
 		/// <summary>
+		/// Plays a pre-loaded music track when the audio clock reaches the <paramref name="clockTime"/> provided<para/>
+		///
+		/// The start is scheduled on the audio backend, a <see cref="SoftwareAudioBackend"/> starts the music track on the exact sample.<br/>
+		/// The music track's source will be the position of the listener.
+		/// </summary>
+		/// <param name="id">The id associated with the desired music track</param>
+		/// <param name="loop">True to put the music track on loop, false otherwise</param>
+		/// <param name="clockTime">The time of the audio clock at which the music track starts</param>
+		/// <code>
+		/// enum class MusicID { ID1, ID2, ID3 };
+		/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer;
+		/// ...
+		/// musicPlayer.playAt(MusicID::ID2, true, musicPlayer.getAudioClock() + sf::seconds(4.f));
+		/// </code>
+		/// <seealso cref="getAudioClock"/>
+		void playAt(T id, bool loop, sf::Time clockTime);
+		/// <summary>
+		/// Plays a pre-loaded music track at a <paramref name="position"/> when the audio clock reaches the <paramref name="clockTime"/> provided<para/>
+		///
+		/// The start is scheduled on the audio backend, a <see cref="SoftwareAudioBackend"/> starts the music track on the exact sample.
+		/// </summary>
+		/// <param name="position">The position of the music track's source</param>
+		/// <param name="id">The id associated with the desired music track</param>
+		/// <param name="loop">True to put the music track on loop, false otherwise</param>
+		/// <param name="clockTime">The time of the audio clock at which the music track starts</param>
+		/// <code>
+		/// enum class MusicID { ID1, ID2, ID3 };
+		/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer;
+		/// ...
+		/// musicPlayer.playAt(sf::Vector2f(250.f, 100.f), MusicID::ID2, true, musicPlayer.getAudioClock() + sf::seconds(4.f));
+		/// </code>
+		/// <seealso cref="getAudioClock"/>
+		void playAt(const sf::Vector2f& position, T id, bool loop, sf::Time clockTime);
+		/// <summary>
+		/// Plays a pre-loaded music track that fades in over a <paramref name="duration"/><para/>
+		///
+		/// The fade is ramped by the audio backend, no call is needed on the game thread while it lasts.<br/>
+		/// A music track that's already playing fades in from its current fade gain.
+		/// </summary>
+		/// <param name="id">The id associated with the desired music track</param>
+		/// <param name="loop">True to put the music track on loop, false otherwise</param>
+		/// <param name="duration">The duration of the fade-in</param>
+		/// <code>
+		/// enum class MusicID { ID1, ID2, ID3 };
+		/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer;
+		/// ...
+		/// musicPlayer.fadeIn(MusicID::ID1, true, sf::seconds(2.f));
+		/// </code>
+		/// <seealso cref="fadeOut"/>
+		/// <seealso cref="crossfade"/>
+		void fadeIn(T id, bool loop, sf::Time duration);
+		/// <summary>
+		/// Plays a pre-loaded music track at a <paramref name="position"/> that fades in over a <paramref name="duration"/><para/>
+		///
+		/// The fade is ramped by the audio backend, no call is needed on the game thread while it lasts.<br/>
+		/// A music track that's already playing fades in from its current fade gain.
+		/// </summary>
+		/// <param name="position">The position of the music track's source</param>
+		/// <param name="id">The id associated with the desired music track</param>
+		/// <param name="loop">True to put the music track on loop, false otherwise</param>
+		/// <param name="duration">The duration of the fade-in</param>
+		/// <code>
+		/// enum class MusicID { ID1, ID2, ID3 };
+		/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer;
+		/// ...
+		/// musicPlayer.fadeIn(sf::Vector2f(250.f, 100.f), MusicID::ID1, true, sf::seconds(2.f));
+		/// </code>
+		/// <seealso cref="fadeOut"/>
+		/// <seealso cref="crossfade"/>
+		void fadeIn(const sf::Vector2f& position, T id, bool loop, sf::Time duration);
+		/// <summary>
 		/// (Un)Pauses all active music tracks<para/>
 		///
 		/// Pausing the music tracks can be useful when you wish to resume playing them from the point where they were previously paused.
@@ -145,6 +258,96 @@ namespace ae
 		/// <seealso cref="pause"/>
 		/// <seealso cref="play"/>
 		void stop(T id);
+		/// <summary>Fades out all music tracks over a <paramref name="duration"/>, they're stopped once faded out</summary>
+		/// <param name="duration">The duration of the fade-out</param>
+		/// <code>
+		/// enum class MusicID { ID1, ID2, ID3 };
+		/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer;
+		/// ...
+		/// musicPlayer.fadeOut(sf::seconds(3.f));
+		/// </code>
+		/// <seealso cref="fadeIn"/>
+		/// <seealso cref="stop"/>
+		void fadeOut(sf::Time duration);
+		/// <summary>Fades out the specified music track over a <paramref name="duration"/>, it's stopped once faded out</summary>
+		/// <param name="id">The id associated with the music track</param>
+		/// <param name="duration">The duration of the fade-out</param>
+		/// <code>
+		/// enum class MusicID { ID1, ID2, ID3 };
+		/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer;
+		/// ...
+		/// musicPlayer.fadeOut(MusicID::ID1, sf::seconds(3.f));
+		/// </code>
+		/// <seealso cref="fadeIn"/>
+		/// <seealso cref="crossfade"/>
+		void fadeOut(T id, sf::Time duration);
+		/// <summary>Fades out a music track while another one fades in over a <paramref name="duration"/></summary>
+		/// <param name="from">The id associated with the music track to fade out</param>
+		/// <param name="to">The id associated with the music track to fade in</param>
+		/// <param name="loop">True to put the music track faded in on loop, false otherwise</param>
+		/// <param name="duration">The duration of the crossfade</param>
+		/// <code>
+		/// enum class MusicID { Exploration, Battle };
+		/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer;
+		/// ...
+		/// musicPlayer.crossfade(MusicID::Exploration, MusicID::Battle, true, sf::seconds(1.5f));
+		/// </code>
+		/// <seealso cref="fadeIn"/>
+		/// <seealso cref="fadeOut"/>
+		void crossfade(T from, T to, bool loop, sf::Time duration);
+		/// <summary>
+		/// Queues a pre-loaded music track in the playlist, it's played once the music tracks queued before it have ended<para/>
+		///
+		/// The playlist starts straight away if it was empty, its music tracks are played at the listener's position and aren't looped.<br/>
+		/// The next music track is chained to the one playing on the audio backend, a <see cref="SoftwareAudioBackend"/> starts it on the sample following the end of the previous one.<br/>
+		/// Its stream is opened and its first frames decoded as soon as it's chained, no file is read on the game thread for the transition.<br/>
+		/// Stopping or fading out the music track playing ends the playlist, a music track queued right after itself is restarted by <see cref="update"/> (with a gap).
+		/// </summary>
+		/// <param name="id">The id associated with the music track to queue</param>
+		/// <code>
+		/// enum class MusicID { Intro, Loop, Outro };
+		/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer(backend);
+		/// ...
+		/// musicPlayer.queue(MusicID::Intro);
+		/// musicPlayer.queue(MusicID::Loop);
+		/// musicPlayer.queue(MusicID::Outro);
+		/// </code>
+		/// <seealso cref="update"/>
+		/// <seealso cref="clearQueue"/>
+		/// <seealso cref="setPlaylistLoop"/>
+		void queue(T id);
+		/// <summary>Removes the music tracks queued after the one playing, which plays until its end</summary>
+		/// <code>
+		/// musicPlayer.clearQueue();
+		/// musicPlayer.queue(MusicID::Outro);
+		/// </code>
+		/// <seealso cref="queue"/>
+		void clearQueue();
+		/// <summary>Sets if the music tracks of the playlist are queued again once they've ended</summary>
+		/// <param name="flag">True to loop the playlist, false otherwise (default)</param>
+		/// <seealso cref="getPlaylistLoop"/>
+		/// <seealso cref="queue"/>
+		void setPlaylistLoop(bool flag);
+		/// <summary>Retrieves if the music tracks of the playlist are queued again once they've ended</summary>
+		/// <returns>True if the playlist is looped, false otherwise</returns>
+		/// <seealso cref="setPlaylistLoop"/>
+		bool getPlaylistLoop() const;
+		/// <summary>
+		/// Advances the playlist and reports the beats and markers played, should be called once per frame<para/>
+		///
+		/// The music track that ended is removed from the playlist (and queued again if the playlist is looped) and the following one is chained to the new one.<br/>
+		/// The next music track is started here if the audio backend can't chain sources (i.e. the SFML backend), once the previous one has ended.<br/>
+		/// The audio clock is read once for the music clocks and the beats and markers played are drained from the audio backend's wait-free queue to the event callback.<br/>
+		/// The ducking ramps of the buses the music tracks play on are advanced.
+		/// </summary>
+		/// <code>
+		/// while (window.isOpen()) {
+		///		musicPlayer.update();
+		///		...
+		/// }
+		/// </code>
+		/// <seealso cref="queue"/>
+		void update();
 		/// <summary>Sets the <paramref name="position"/> of the specified music track's source</summary>
 		/// <param name="position">The new position of the specified music track's source</param>
 		/// <param name="id">The id associated with the desired music track</param>
@@ -167,10 +370,179 @@ namespace ae
 		/// }
 		/// </code>
 		sf::SoundSource::Status getMusicStatus(T id) const;
+		/// <summary>Retrieves the duration of the specified music track, read from its file's header when it was loaded in</summary>
+		/// <param name="id">The id associated with the desired music track</param>
+		/// <returns>The duration of the specified music track</returns>
+		/// <code>
+		/// const sf::Time DURATION = musicPlayer.getMusicDuration(MusicID::ID1);
+		/// </code>
+		sf::Time getMusicDuration(T id) const;
+		/// <summary>
+		/// Changes the playing position of the specified music track<para/>
+		///
+		/// A music track that isn't playing has its stream opened and its decoder positioned straight away by the decode threads, it resumes from the new position without a gap once played.<br/>
+		/// The stream of a stopped music track stays open until it's played or stopped, it isn't closed to make room for others (see <see cref="setMaxOpenTracks"/>).<br/>
+		/// No seek table is kept: the decoder searches the compressed file for the position itself (an OGG file is bisected), the seek is only kept off the audio path.<br/>
+		/// Music tracks read from memory (see <see cref="loadFromMemory"/>) seek without reading the disk.
+		/// </summary>
+		/// <param name="id">The id associated with the desired music track</param>
+		/// <param name="offset">The new playing position, from the beginning of the music track</param>
+		/// <code>
+		/// // Resume the level's music where it was saved
+		/// musicPlayer.setPlayingOffset(MusicID::Level, save.musicOffset);
+		/// musicPlayer.play(MusicID::Level, true);
+		/// </code>
+		/// <seealso cref="getPlayingOffset"/>
+		void setPlayingOffset(T id, sf::Time offset);
+		/// <summary>Retrieves the playing position of the specified music track</summary>
+		/// <param name="id">The id associated with the desired music track</param>
+		/// <returns>The playing position of the specified music track, zero if its stream is closed</returns>
+		/// <code>
+		/// save.musicOffset = musicPlayer.getPlayingOffset(MusicID::Level);
+		/// </code>
+		/// <seealso cref="setPlayingOffset"/>
+		sf::Time getPlayingOffset(T id) const;
+		/// <summary>
+		/// Sets the maximum amount of music tracks whose stream is kept open (8 by default, at least 1)<para/>
+		///
+		/// Each open stream holds a file handle, a decoder and its buffered frames.<br/>
+		/// The streams of the least recently played music tracks that are stopped are closed to make room, they're opened again on their next play.<br/>
+		/// Music tracks that are playing, paused, seeked ahead of play or queued next in the playlist are never closed, the maximum is exceeded while more of them are open.
+		/// </summary>
+		/// <param name="count">The maximum amount of open music tracks</param>
+		/// <code>
+		/// musicPlayer.setMaxOpenTracks(4);
+		/// </code>
+		/// <seealso cref="getMaxOpenTracks"/>
+		/// <seealso cref="getOpenTrackCount"/>
+		void setMaxOpenTracks(std::size_t count);
+		/// <summary>Retrieves the maximum amount of music tracks whose stream is kept open</summary>
+		/// <returns>The maximum amount of open music tracks</returns>
+		/// <seealso cref="setMaxOpenTracks"/>
+		std::size_t getMaxOpenTracks() const;
+		/// <summary>Retrieves the amount of music tracks whose stream is currently open</summary>
+		/// <returns>The amount of open music tracks</returns>
+		/// <seealso cref="setMaxOpenTracks"/>
+		std::size_t getOpenTrackCount() const;
+		/// <summary>
+		/// Sets the duration the streams of the music tracks decode ahead and the duration they decode at once (the music tracks with their own buffering excepted)<para/>
+		///
+		/// Longer buffers survive slower storage and I/O pressure, shorter ones use less memory; longer chunks keep the file accesses sequential.<br/>
+		/// The volume, fades and layer gains are applied as the frames are mixed, so the buffering doesn't delay the reactions of the music.<br/>
+		/// It's applied to the streams already open, the frames decoded ahead are kept. Backends with fixed buffers (i.e. the SFML backend) ignore it.
+		/// </summary>
+		/// <param name="bufferTime">The duration decoded ahead, zero for the audio backend's default</param>
+		/// <param name="chunkTime">The minimum duration decoded at once, zero for a quarter of the buffer</param>
+		/// <code>
+		/// // Slow storage: decode two seconds ahead, half a second at a time
+		/// musicPlayer.setStreamBuffering(sf::seconds(2.f), sf::seconds(0.5f));
+		/// </code>
+		/// <seealso cref="getStreamState"/>
+		void setStreamBuffering(sf::Time bufferTime, sf::Time chunkTime);
+		/// <summary>
+		/// Sets the duration the stream of the specified music track decodes ahead and the duration it decodes at once, instead of the music player's<para/>
+		///
+		/// It's applied to the music track's stream if it's open, and again each time it's opened.
+		/// </summary>
+		/// <param name="id">The id associated with the desired music track</param>
+		/// <param name="bufferTime">The duration decoded ahead, zero to use the music player's buffering the next time the stream is opened</param>
+		/// <param name="chunkTime">The minimum duration decoded at once, zero for a quarter of the buffer</param>
+		/// <code>
+		/// // The combat music reacts quickly and is played often, keep its buffer small
+		/// musicPlayer.setStreamBuffering(MusicID::Combat, sf::milliseconds(250), sf::Time::Zero);
+		/// </code>
+		/// <seealso cref="getStreamState"/>
+		void setStreamBuffering(T id, sf::Time bufferTime, sf::Time chunkTime);
+		/// <summary>
+		/// Retrieves the state of the buffer decoded ahead by the stream of the specified music track, cheap enough to be polled every frame<para/>
+		///
+		/// The underruns are those of the music track's current stream, they start again from zero when the stream is opened again.
+		/// </summary>
+		/// <param name="id">The id associated with the desired music track</param>
+		/// <param name="fill">The fill level (0 - 1) of the stream's buffer</param>
+		/// <param name="underruns">The amount of times the stream ran out of decoded frames</param>
+		/// <returns>True if the music track's stream is open and reports its buffer, false otherwise</returns>
+		/// <code>
+		/// float fill = 0.f;
+		/// std::size_t underruns = 0;
+		/// if (musicPlayer.getStreamState(MusicID::ID1, fill, underruns))
+		///		overlay.plot("Music buffer", fill);
+		/// </code>
+		/// <seealso cref="setStreamBuffering"/>
+		bool getStreamState(T id, float& fill, std::size_t& underruns) const;
+		/// <summary>
+		/// Sets the tempo of the specified music track, its beats are reported to the event callback and count the beats of its music clock<para/>
+		///
+		/// The beats are laid from the first beat to the end of the music track, they follow its pitch and its loops.
+		/// </summary>
+		/// <param name="id">The id associated with the desired music track</param>
+		/// <param name="bpm">The tempo in beats per minute, 0 to remove it</param>
+		/// <param name="beatsPerBar">The amount of beats per bar (i.e. 4 for a 4/4 time signature)</param>
+		/// <param name="firstBeat">The position of the first beat (the downbeat of the first bar)</param>
+		/// <code>
+		/// musicPlayer.setTempo(MusicID::Boss, 128.f, 4, sf::milliseconds(250));
+		/// </code>
+		/// <seealso cref="setEventCallback"/>
+		/// <seealso cref="getMusicBeat"/>
+		void setTempo(T id, float bpm, unsigned int beatsPerBar, sf::Time firstBeat);
+		/// <summary>
+		/// Sets the <paramref name="markers"/> of the specified music track (i.e. the drop of a song), they're reported to the event callback as they're played<para/>
+		///
+		/// The beats and the markers are detected by the audio backend on the exact frame where they're mixed, and delivered through a wait-free queue drained by <see cref="update"/>.<br/>
+		/// Backends that don't mix in software (i.e. the SFML backend) don't report them, the music clock is then only anchored by the calls of the music player.<br/>
+		/// The markers of all the streams of the audio backend share its queue, a single music player per backend should set markers.
+		/// </summary>
+		/// <param name="id">The id associated with the desired music track</param>
+		/// <param name="markers">The positions of the markers, in any order (empty to remove them)</param>
+		/// <code>
+		/// enum Marker { Drop, Breakdown };
+		/// musicPlayer.setMarkers(MusicID::Boss, { sf::seconds(32.f), sf::seconds(96.f) });
+		/// </code>
+		/// <seealso cref="setEventCallback"/>
+		void setMarkers(T id, const std::vector<sf::Time>& markers);
+		/// <summary>Sets the function called by <see cref="update"/> for each beat and marker played since the previous frame, in the order they were mixed</summary>
+		/// <param name="callback">The function called for each event, nullptr to remove it</param>
+		/// <code>
+		/// musicPlayer.setEventCallback([&amp;](const ae::MusicPlayer&lt;MusicID&gt;::MusicEvent&amp; event) {
+		///		if (event.type == ae::MusicPlayer&lt;MusicID&gt;::MusicEvent::Type::Beat &amp;&amp; event.beat == 0)
+		///			stageLights.flash();
+		///		else if (event.type == ae::MusicPlayer&lt;MusicID&gt;::MusicEvent::Type::Marker &amp;&amp; event.index == Drop)
+		///			spawner.startWave();
+		/// });
+		/// </code>
+		/// <seealso cref="setTempo"/>
+		/// <seealso cref="setMarkers"/>
+		void setEventCallback(const EventCallback& callback);
+		/// <summary>
+		/// Retrieves the precise playing position of the specified music track, extrapolated from the audio clock read by the last <see cref="update"/><para/>
+		///
+		/// The music clock is anchored when the music track is played, paused or positioned, and again on the exact frame of each of its beats and markers played,
+		/// so it doesn't query the audio backend's stream. It's frozen while the music track is paused or stopped.
+		/// </summary>
+		/// <param name="id">The id associated with the desired music track</param>
+		/// <returns>The extrapolated playing position of the specified music track</returns>
+		/// <code>
+		/// const sf::Time POSITION = musicPlayer.getMusicClock(MusicID::Boss);
+		/// </code>
+		/// <seealso cref="getMusicBeat"/>
+		sf::Time getMusicClock(T id) const;
+		/// <summary>Retrieves the beat of the specified music track's clock counted from its first beat, along with its fraction (negative before the first beat)</summary>
+		/// <param name="id">The id associated with the desired music track</param>
+		/// <returns>The beat of the music track, 0 if it has no tempo</returns>
+		/// <code>
+		/// // Pulse the lights on each beat and change their colour on each bar
+		/// const float BEAT = musicPlayer.getMusicBeat(MusicID::Boss);
+		/// stageLights.setIntensity(1.f - (BEAT - std::floor(BEAT)));
+		/// stageLights.setColour(palette[static_cast&lt;std::size_t&gt;(BEAT / 4.f) % palette.size()]);
+		/// </code>
+		/// <seealso cref="setTempo"/>
+		/// <seealso cref="getMusicClock"/>
+		float getMusicBeat(T id) const;
 		/// <summary>
 		/// Sets the music player's global volume (0% - 100%)<para/>
 		///
-		/// A global volume of 50% will reduce the music player's tracks' volume by half of their current volume.
+		/// A global volume of 50% will reduce the music player's tracks' volume by half of their current volume.<br/>
+		/// Only the music tracks on the music player's bus and its sub-buses are updated.
 		/// </summary>
 		/// <param name="globalVolume">The music player's global volume</param>
 		/// <code>
@@ -180,11 +552,44 @@ namespace ae
 		/// </code>
 		virtual void setGlobalVolume(float globalVolume) override final;
 		/// <summary>
+		/// Routes a loaded-in music track to a <paramref name="bus"/> by providing the associated <paramref name="id"/><para/>
+		///
+		/// The music tracks are on the music player's bus by default.
+		/// </summary>
+		/// <param name="bus">The bus of the music track (it must outlive the music player)</param>
+		/// <param name="id">The ID associated with the music track</param>
+		/// <code>
+		/// enum class MusicID { ID1, ID2, ID3 };
+		/// ae::AudioBus ambience;
+		/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer;
+		/// ambience.setParent(&amp;musicPlayer.getBus());
+		/// musicPlayer.setBus(ambience, MusicID::ID1);
+		/// </code>
+		void setBus(AudioBus& bus, T id);
+		/// <summary>
+		/// Sets the <paramref name="effects"/> processing a loaded-in music track alone by providing the associated <paramref name="id"/><para/>
+		///
+		/// The effects are only processed by backends mixing in software (i.e. a <see cref="SoftwareAudioBackend"/>).
+		/// </summary>
+		/// <param name="effects">The effect chain (it must outlive the music player), nullptr to remove it</param>
+		/// <param name="id">The ID associated with the music track</param>
+		/// <code>
+		/// enum class MusicID { ID1, ID2, ID3 };
+		/// ae::BiquadFilter muffle(ae::BiquadFilter::Type::LowPass, 600.f);
+		/// ae::EffectChain underwater;
+		/// underwater.add(muffle);
+		/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer(backend);
+		/// musicPlayer.setEffects(&amp;underwater, MusicID::ID1);
+		/// </code>
+		void setEffects(EffectChain* effects, T id);
+		/// <summary>
 		/// Loads in a music track by providing a <paramref name="filepath"/> and an <paramref name="id"/> to associate it with<para/>
 		///
 		/// The <see cref="AudioProperties"/> of the music track will be those by default.<para/>
 		///
-		/// Only music tracks with one channel (mono sounds) can be spatialized.
+		/// Only the header of the file is read, the music track's stream is opened on its first play (see <see cref="setMaxOpenTracks"/>).<br/>
+		/// Only music tracks with one channel (mono sounds) can be spatialized.<br/>
+		/// With loudness normalization, the music track is measured by a background thread unless the loudness cache knows it, its gain is applied once measured the next time it's played.
 		/// </summary>
 		/// <param name="filepath">The music track's filepath</param>
 		/// <param name="id">An ID with which to associate the music track (i.e. an enum value)</param>
@@ -199,7 +604,9 @@ namespace ae
 		/// <summary>
 		/// Loads in a music track by providing a <paramref name="filepath"/>, an <see cref="AudioProperties"/> that contain the music track's properties, and an <paramref name="id"/> to associate it with<para/>
 		///
-		/// Only music tracks with one channel (mono sounds) can be spatialized.
+		/// Only the header of the file is read, the music track's stream is opened on its first play (see <see cref="setMaxOpenTracks"/>).<br/>
+		/// Only music tracks with one channel (mono sounds) can be spatialized.<br/>
+		/// With loudness normalization, the music track is measured by a background thread unless the loudness cache knows it, its gain is applied once measured the next time it's played.
 		/// </summary>
 		/// <param name="filepath">The music track's filepath</param>
 		/// <param name="properties">The <see cref="AudioProperties"/> that contain the music track's properties</param>
@@ -213,6 +620,139 @@ namespace ae
 		/// <seealso cref="play"/>
 		virtual void load(const std::string& filepath, const AudioProperties& properties, T id) override final;
 		/// <summary>
+		/// Loads in a music track held by a region of memory (i.e. a memory-mapped archive) by providing its <paramref name="data"/>, its <paramref name="size"/>, a <paramref name="name"/> and an <paramref name="id"/> to associate it with<para/>
+		///
+		/// The <see cref="AudioProperties"/> of the music track will be those by default.<para/>
+		///
+		/// The <paramref name="data"/> isn't copied, it's decoded in place and must remain alive until the music track is unloaded.<br/>
+		/// The reads of a memory-mapped region are served by the OS page cache, no temporary file is extracted.<br/>
+		/// The <paramref name="name"/> identifies the music track in the loudness cache and the debug messages.
+		/// </summary>
+		/// <param name="data">The first byte of the audio file</param>
+		/// <param name="size">The size of the audio file in bytes</param>
+		/// <param name="name">The music track's name (i.e. the path of its archive entry)</param>
+		/// <param name="id">An ID with which to associate the music track (i.e. an enum value)</param>
+		/// <code>
+		/// enum class MusicID { Theme };
+		/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer(backend);
+		/// musicPlayer.loadFromMemory(archive.getData() + entry.offset, entry.size, "Music/Theme.ogg", MusicID::Theme);
+		/// </code>
+		/// <seealso cref="loadFromStream"/>
+		/// <seealso cref="unload"/>
+		void loadFromMemory(const void* data, std::size_t size, const std::string& name, T id);
+		/// <summary>
+		/// Loads in a music track held by a region of memory (i.e. a memory-mapped archive) by providing its <paramref name="data"/>, its <paramref name="size"/>, a <paramref name="name"/>, an <see cref="AudioProperties"/> that contain the music track's properties, and an <paramref name="id"/> to associate it with<para/>
+		///
+		/// The <paramref name="data"/> isn't copied, it's decoded in place and must remain alive until the music track is unloaded.<br/>
+		/// The reads of a memory-mapped region are served by the OS page cache, no temporary file is extracted.<br/>
+		/// The <paramref name="name"/> identifies the music track in the loudness cache and the debug messages.
+		/// </summary>
+		/// <param name="data">The first byte of the audio file</param>
+		/// <param name="size">The size of the audio file in bytes</param>
+		/// <param name="name">The music track's name (i.e. the path of its archive entry)</param>
+		/// <param name="properties">The <see cref="AudioProperties"/> that contain the music track's properties</param>
+		/// <param name="id">An ID with which to associate the music track (i.e. an enum value)</param>
+		/// <code>
+		/// enum class MusicID { Theme };
+		/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer(backend);
+		/// musicPlayer.loadFromMemory(archive.getData() + entry.offset, entry.size, "Music/Theme.ogg", ae::AudioProperties(80.f, 0.f, 1.f, 1.f), MusicID::Theme);
+		/// </code>
+		/// <seealso cref="loadFromStream"/>
+		/// <seealso cref="unload"/>
+		void loadFromMemory(const void* data, std::size_t size, const std::string& name, const AudioProperties& properties, T id);
+		/// <summary>
+		/// Loads in a music track read by custom streams (i.e. over an archive entry) by providing the function opening them, a <paramref name="name"/> and an <paramref name="id"/> to associate it with<para/>
+		///
+		/// The <see cref="AudioProperties"/> of the music track will be those by default.<para/>
+		///
+		/// A new stream is opened each time the music track is read: once when it's loaded in (header and loudness) and each time its stream is opened.<br/>
+		/// Each stream is only read by a single thread, the function may be called from the game thread as long as the music track is loaded in.<br/>
+		/// The <paramref name="name"/> identifies the music track in the loudness cache and the debug messages.
+		/// </summary>
+		/// <param name="openStream">The function opening a new stream at the start of the audio file (nullptr if it can't be opened)</param>
+		/// <param name="name">The music track's name (i.e. the path of its archive entry)</param>
+		/// <param name="id">An ID with which to associate the music track (i.e. an enum value)</param>
+		/// <code>
+		/// enum class MusicID { Theme };
+		/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer(backend);
+		/// musicPlayer.loadFromStream([&amp;archive]() { return archive.openEntry("Music/Theme.ogg"); }, "Music/Theme.ogg", MusicID::Theme);
+		/// </code>
+		/// <seealso cref="loadFromMemory"/>
+		/// <seealso cref="unload"/>
+		void loadFromStream(const StreamOpener& openStream, const std::string& name, T id);
+		/// <summary>
+		/// Loads in a music track read by custom streams (i.e. over an archive entry) by providing the function opening them, a <paramref name="name"/>, an <see cref="AudioProperties"/> that contain the music track's properties, and an <paramref name="id"/> to associate it with<para/>
+		///
+		/// A new stream is opened each time the music track is read: once when it's loaded in (header and loudness) and each time its stream is opened.<br/>
+		/// Each stream is only read by a single thread, the function may be called from the game thread as long as the music track is loaded in.<br/>
+		/// The <paramref name="name"/> identifies the music track in the loudness cache and the debug messages.
+		/// </summary>
+		/// <param name="openStream">The function opening a new stream at the start of the audio file (nullptr if it can't be opened)</param>
+		/// <param name="name">The music track's name (i.e. the path of its archive entry)</param>
+		/// <param name="properties">The <see cref="AudioProperties"/> that contain the music track's properties</param>
+		/// <param name="id">An ID with which to associate the music track (i.e. an enum value)</param>
+		/// <code>
+		/// enum class MusicID { Theme };
+		/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer(backend);
+		/// musicPlayer.loadFromStream([&amp;archive]() { return archive.openEntry("Music/Theme.ogg"); }, "Music/Theme.ogg", ae::AudioProperties(80.f, 0.f, 1.f, 1.f), MusicID::Theme);
+		/// </code>
+		/// <seealso cref="loadFromMemory"/>
+		/// <seealso cref="unload"/>
+		void loadFromStream(const StreamOpener& openStream, const std::string& name, const AudioProperties& properties, T id);
+		/// <summary>
+		/// Loads in a layered music track by providing the <paramref name="filepaths"/> of its stems and an <paramref name="id"/> to associate it with<para/>
+		///
+		/// The <see cref="AudioProperties"/> of the music track will be those by default.<para/>
+		///
+		/// The stems (i.e. drums, bass and strings) are decoded in lockstep and mixed into a single stream, so they stay sample-locked while their layers are faded in and out.<br/>
+		/// The stems must have the same amount of channels and the same sample rate, the layers start at full gain and the music track's loudness is measured with all of them at full gain.<br/>
+		/// Only backends mixing in software (i.e. a <see cref="SoftwareAudioBackend"/>) play layered music tracks, the music track isn't loaded in on the others.
+		/// </summary>
+		/// <param name="filepaths">The stems' filepaths, one per layer</param>
+		/// <param name="id">An ID with which to associate the music track (i.e. an enum value)</param>
+		/// <code>
+		/// enum class MusicID { Combat };
+		/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer(backend);
+		/// musicPlayer.loadLayers({ "Assets/Music/CombatDrums.ogg", "Assets/Music/CombatBass.ogg", "Assets/Music/CombatStrings.ogg" }, MusicID::Combat);
+		/// </code>
+		/// <seealso cref="setLayerGain"/>
+		/// <seealso cref="unload"/>
+		void loadLayers(const std::vector<std::string>& filepaths, T id);
+		/// <summary>
+		/// Loads in a layered music track by providing the <paramref name="filepaths"/> of its stems, an <see cref="AudioProperties"/> that contain the music track's properties, and an <paramref name="id"/> to associate it with<para/>
+		///
+		/// The stems (i.e. drums, bass and strings) are decoded in lockstep and mixed into a single stream, so they stay sample-locked while their layers are faded in and out.<br/>
+		/// The stems must have the same amount of channels and the same sample rate, the layers start at full gain and the music track's loudness is measured with all of them at full gain.<br/>
+		/// Only backends mixing in software (i.e. a <see cref="SoftwareAudioBackend"/>) play layered music tracks, the music track isn't loaded in on the others.
+		/// </summary>
+		/// <param name="filepaths">The stems' filepaths, one per layer</param>
+		/// <param name="properties">The <see cref="AudioProperties"/> that contain the music track's properties</param>
+		/// <param name="id">An ID with which to associate the music track (i.e. an enum value)</param>
+		/// <code>
+		/// enum class MusicID { Combat };
+		/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer(backend);
+		/// musicPlayer.loadLayers({ "Assets/Music/CombatDrums.ogg", "Assets/Music/CombatBass.ogg" }, ae::AudioProperties(80.f, 0.f, 1.f, 1.f), MusicID::Combat);
+		/// </code>
+		/// <seealso cref="setLayerGain"/>
+		/// <seealso cref="unload"/>
+		void loadLayers(const std::vector<std::string>& filepaths, const AudioProperties& properties, T id);
+		/// <summary>
+		/// Ramps the gain (0 - 1) of a <paramref name="layer"/> of a layered music track to the <paramref name="gain"/> provided over a <paramref name="rampTime"/><para/>
+		///
+		/// The ramp is applied by the audio backend as the stems are mixed down, no call is needed on the game thread while it lasts.<br/>
+		/// The gains are kept while the music track is stopped and its stream closed.
+		/// </summary>
+		/// <param name="id">The id associated with the layered music track</param>
+		/// <param name="layer">The index of the layer (the index of its stem in the filepaths provided)</param>
+		/// <param name="gain">The gain reached at the end of the ramp</param>
+		/// <param name="rampTime">The duration of the ramp (zero to apply the <paramref name="gain"/> straight away)</param>
+		/// <code>
+		/// // The strings fade in as the battle's intensity rises
+		/// musicPlayer.setLayerGain(MusicID::Combat, 2, intensity, sf::seconds(1.5f));
+		/// </code>
+		/// <seealso cref="loadLayers"/>
+		void setLayerGain(T id, std::size_t layer, float gain, sf::Time rampTime);
+		/// <summary>
 		/// Unloads a loaded-in music track by providing the associated <paramref name="id"/><para/>
 		///
 		/// The music track associated with this <paramref name="id"/> will be removed (even if it's currently playing).
@@ -226,27 +766,140 @@ namespace ae
 		/// </code>
 		/// <seealso cref="load"/>
 		virtual void unload(T id) override final;
-	private:
-		/// <summary>Sets up the new music track by providing the <see cref="AudioProperties"/> and the <paramref name="filepath"/> of the music track</summary>
-		/// <param name="properties">The <see cref="AudioProperties"/> that contain the music track's properties</param>
-		/// <param name="filepath">The music track's filepath</param>
-		void setupTrack(const AudioProperties& properties, const std::string& filepath);
 
 	private:
+		/// <summary>Struct used to represent a beat or a marker set on the stream of a music track</summary>
+		struct Cue {
+			sf::Time                  position; ///< The position in the music track
+			typename MusicEvent::Type type;     ///< Is it a beat or a marker?
+			std::size_t               index;    ///< The index of the beat counted from the first beat, or the index of the marker in those provided
+		};
 		/// <summary>Struct used to represent a music track along with its original volume</summary>
 		struct MusicTrack {
-			sf::Music   music;  ///< The sf::Music object
-			const float VOLUME; ///< The original volume of the music track
+			AudioBackend&                      backend;      ///< The audio backend streaming the music track
+			AudioBus*                          bus;          ///< The bus of the music track
+			AudioBackend::SourceID             source;       ///< The backend's stream (0 while the music track is closed)
+			const AudioProperties              PROPERTIES;   ///< The properties applied to the stream when it's opened
+			const float                        VOLUME;       ///< The original volume of the music track
+			EffectChain*                       effects;      ///< The effects processing the music track (nullptr if there are none)
+			sf::Time                           duration;     ///< The duration of the music track
+			float                              gain;         ///< The loudness normalization gain folded into the volume
+			std::size_t                        underruns;    ///< The underruns of the music track's stream already counted
+			sf::Time                           bufferTime;   ///< The duration decoded ahead by the music track's stream (zero for the music player's)
+			sf::Time                           chunkTime;    ///< The minimum duration decoded at once by the music track's stream
+			std::string                        filepath;     ///< The music track's filepath (its first stem's if it's layered, its name if it's read from memory or from streams)
+			const void*                        data;         ///< The memory holding the music track's audio file (nullptr if it isn't read from memory)
+			std::size_t                        size;         ///< The size of the memory holding the music track's audio file
+			StreamOpener                       openStream;   ///< The function opening the streams reading the music track's audio file (empty if it isn't read from streams)
+			std::vector<std::string>           layers;       ///< The filepaths of the stems of the layered music track (empty if it isn't layered)
+			std::vector<float>                 layerGains;   ///< The gains of the layers, applied again when the stream is opened
+			float                              tempo;        ///< The tempo in beats per minute (0 if the music track has none)
+			unsigned int                       beatsPerBar;  ///< The amount of beats per bar
+			sf::Time                           firstBeat;    ///< The position of the first beat
+			std::vector<sf::Time>              markers;      ///< The positions of the markers, in the order they were provided
+			std::vector<Cue>                   cues;         ///< The beats and the markers set on the stream, sorted by position
+			bool                               loop;         ///< Is the music track played on loop?
+			bool                               seeked;       ///< Was the stopped music track seeked ahead of play? (its stream is kept open until it's played or stopped)
+			sf::Time                           anchorClock;  ///< The time of the audio clock at which the music clock was at the anchor's offset
+			sf::Time                           anchorOffset; ///< The playing position at the anchor
+			float                              anchorSpeed;  ///< The speed of the music clock from the anchor (the pitch, 0 while the music track isn't playing)
+			std::future<float>                 loudness;     ///< The loudness being measured by the background thread (invalid once applied)
+			std::shared_ptr<std::atomic<bool>> cancel;       ///< The flag stopping the background measurement (nullptr if there's none)
 
-			/// <summary>Constructs the <see cref="MusicTrack"/> by providing the original <paramref name="volume"/></summary>
-			/// <param name="volume">The original volume of the music track</param>
-			explicit MusicTrack(float volume);
-			/// <summary>Move constructor</summary>
-			/// <param name="other">The <see cref="MusicTrack"/> to be moved</param>
-			MusicTrack(MusicTrack&& other);
+			/// <summary>Constructs the <see cref="MusicTrack"/> by providing the audio <paramref name="backend"/>, its <paramref name="bus"/> and its <paramref name="properties"/></summary>
+			/// <param name="backend">The audio backend that will stream the music track</param>
+			/// <param name="bus">The bus of the music track</param>
+			/// <param name="properties">The properties of the music track</param>
+			MusicTrack(AudioBackend& backend, AudioBus& bus, const AudioProperties& properties);
+			/// <summary>Deleted copy constructor, the music tracks are constructed in place and never moved</summary>
+			/// <param name="copy">The <see cref="MusicTrack"/> to be copied</param>
+			MusicTrack(const MusicTrack& copy) = delete;
+			/// <summary>Stops the background measurement, detaches the music track's stream from its bus and destroys it</summary>
+			~MusicTrack();
 		};
 	private:
-		std::map<T, MusicTrack> tracks_; ///< The list of all loaded-in music tracks
+		/// <summary>Sets up the newly emplaced music <paramref name="track"/> by reading the header of its audio file, it's removed if the file can't be opened</summary>
+		/// <param name="track">The iterator to the new music track, whose filepath, memory or stream function has been set</param>
+		void setupTrack(typename std::map<T, MusicTrack>::iterator track);
+		/// <summary>Opens the audio file of a music <paramref name="track"/> from the disk, its memory or a new stream</summary>
+		/// <param name="track">The music track</param>
+		/// <param name="file">The sample source opening the audio file</param>
+		/// <returns>True if the file could be opened, false otherwise</returns>
+		bool openFile(const MusicTrack& track, FileSampleSource& file) const;
+		/// <summary>Sets up the newly emplaced layered music <paramref name="track"/> by opening its stems to check them, it's removed if the audio backend doesn't support layered streams or if they can't be opened or don't match</summary>
+		/// <param name="track">The iterator to the new music track</param>
+		/// <param name="filepaths">The stems' filepaths</param>
+		void setupLayers(typename std::map<T, MusicTrack>::iterator track, const std::vector<std::string>& filepaths);
+		/// <summary>Starts playing a music <paramref name="track"/>, fading it in over a <paramref name="duration"/></summary>
+		/// <param name="track">The music track to play</param>
+		/// <param name="position">The position of the music track's source</param>
+		/// <param name="loop">True to put the music track on loop, false otherwise</param>
+		/// <param name="duration">The duration of the fade-in (zero to play it at full volume straight away)</param>
+		/// <param name="clockTime">The time of the audio clock at which the music track starts (zero to start it straight away)</param>
+		void startTrack(MusicTrack& track, const sf::Vector2f& position, bool loop, sf::Time duration, sf::Time clockTime);
+		/// <summary>Opens the stream of a music <paramref name="track"/> unless it's already open, closing the least recently played ones beyond the maximum</summary>
+		/// <param name="track">The music track</param>
+		/// <returns>True if the music track's stream is open, false if its file couldn't be opened</returns>
+		bool openTrack(MusicTrack& track);
+		/// <summary>Closes the streams of the least recently played music tracks that are stopped until at most <paramref name="count"/> remain open</summary>
+		/// <param name="count">The amount of open music tracks to keep</param>
+		void closeIdleTracks(std::size_t count);
+		/// <summary>Applies the buffering of a music <paramref name="track"/>, or the music player's, to its open stream</summary>
+		/// <param name="track">The music track</param>
+		void applyBuffering(MusicTrack& track);
+		/// <summary>Applies the loudness gain, the fade-in, the <paramref name="position"/> and the <paramref name="loop"/> of a music <paramref name="track"/> about to play</summary>
+		/// <param name="track">The music track</param>
+		/// <param name="position">The position of the music track's source</param>
+		/// <param name="loop">True to put the music track on loop, false otherwise</param>
+		/// <param name="duration">The duration of the fade-in (zero to play it at full volume straight away)</param>
+		void prepareTrack(MusicTrack& track, const sf::Vector2f& position, bool loop, sf::Time duration);
+		/// <summary>Lays the beats and the markers of a music <paramref name="track"/> out as cues, and sets them on its stream if it's open</summary>
+		/// <param name="track">The music track</param>
+		void layCues(MusicTrack& track);
+		/// <summary>Sets the cues of a music <paramref name="track"/> as the markers of its open stream</summary>
+		/// <param name="track">The music track</param>
+		void applyCues(MusicTrack& track);
+		/// <summary>Anchors the music clock of a music <paramref name="track"/>, it advances from the <paramref name="offset"/> with the audio clock while it's playing</summary>
+		/// <param name="track">The music track</param>
+		/// <param name="clockTime">The time of the audio clock at which the music track is at the <paramref name="offset"/></param>
+		/// <param name="offset">The playing position of the music track</param>
+		/// <param name="playing">True if the music track is playing, false to freeze its music clock</param>
+		void anchorTrack(MusicTrack& track, sf::Time clockTime, sf::Time offset, bool playing);
+		/// <summary>Extrapolates the music clock of a music <paramref name="track"/> from the audio clock read by the last update</summary>
+		/// <param name="track">The music track</param>
+		/// <returns>The playing position of the music track</returns>
+		sf::Time computeClock(const MusicTrack& track) const;
+		/// <summary>Drains the beats and markers played from the audio backend, re-anchors the music clocks on them and reports them to the event callback</summary>
+		void dispatchEvents();
+		/// <summary>Chains the second music track of the playlist to the first one on the audio backend, unless it's already chained or it's the same music track</summary>
+		void chainNext();
+		/// <summary>Ends the playlist, the music track playing keeps playing until its end without any music track chained to it</summary>
+		void endPlaylist();
+		/// <summary>Starts measuring the loudness of the new music <paramref name="track"/> on a background thread with its <paramref name="source"/> already opened, or applies it straight away if the loudness cache knows it</summary>
+		/// <param name="track">The music track</param>
+		/// <param name="source">The music track's file, or its stems mixed down, opened when it was loaded in</param>
+		void measureLoudness(MusicTrack& track, std::shared_ptr<SampleSource> source);
+		/// <summary>Folds the loudness measured by the background thread into the volume of the music <paramref name="track"/> once it's available</summary>
+		/// <param name="track">The music track</param>
+		void applyLoudness(MusicTrack& track);
+		/// <summary>Retrieves the key of a music <paramref name="track"/> in the loudness cache</summary>
+		/// <param name="track">The music track</param>
+		/// <returns>The music track's filepath, followed by the filepaths of its other stems if it's layered</returns>
+		std::string getLoudnessKey(const MusicTrack& track) const;
+		/// <summary>Fills in the voice counts and the state of the streams of the music tracks playing, and accumulates their underruns</summary>
+		/// <param name="stats">The music player's statistics</param>
+		virtual void collectStats(AudioStats& stats) override final;
+	private:
+		std::map<T, MusicTrack> tracks_;          ///< The list of all loaded-in music tracks
+		std::deque<T>           playlist_;        ///< The music tracks queued, the first one being played
+		bool                    playlistChained_; ///< Has the second music track queued been chained to the first one?
+		bool                    playlistLoop_;    ///< Are the ended music tracks of the playlist queued again?
+		std::list<MusicTrack*>  openTracks_;      ///< The music tracks whose stream is open, the most recently played first
+		std::size_t             maxOpenTracks_;   ///< The maximum amount of music tracks whose stream is kept open
+		sf::Time                bufferTime_;      ///< The duration decoded ahead by the streams (zero for the audio backend's default)
+		sf::Time                chunkTime_;       ///< The minimum duration decoded at once by the streams
+		EventCallback           eventCallback_;   ///< The function called for each beat and marker played (empty if there's none)
+		sf::Time                audioClock_;      ///< The audio clock read by the last update
 	};
 }
 #include "MusicPlayer.inl"
@@ -20,6 +20,54 @@
 
 namespace ae
 {
+	/// <summary>
+	/// Default constructor<para/>
+	///
+	/// The global volume is set to 100% and the listener's position to (0, 0, 300).<br/>
+	/// The listener's position is the same for both the <see cref="MusicPlayer"/> and the <see cref="SoundPlayer"/>.
+	/// </summary>
+	template <typename T>
+	MusicPlayer<T>::MusicPlayer()
+		: AudioPlayer<T>()
+		, tracks_()
+		, playlist_()
+		, playlistChained_(false)
+		, playlistLoop_(false)
+		, openTracks_()
+		, maxOpenTracks_(8)
+		, bufferTime_(sf::Time::Zero)
+		, chunkTime_(sf::Time::Zero)
+		, eventCallback_()
+		, audioClock_(sf::Time::Zero)
+	{
+	}
+
+	/// <summary>
+	/// Constructs the <see cref="MusicPlayer"/> by providing the <paramref name="backend"/> that will stream its music tracks<para/>
+	///
+	/// The <paramref name="backend"/> must outlive the <see cref="MusicPlayer"/>.
+	/// </summary>
+	/// <param name="backend">The <see cref="AudioBackend"/> that will stream the music tracks</param>
+	/// <code>
+	/// ae::NullAudioBackend backend;
+	/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer(backend);
+	/// </code>
+	template <typename T>
+	MusicPlayer<T>::MusicPlayer(AudioBackend& backend)
+		: AudioPlayer<T>(backend)
+		, tracks_()
+		, playlist_()
+		, playlistChained_(false)
+		, playlistLoop_(false)
+		, openTracks_()
+		, maxOpenTracks_(8)
+		, bufferTime_(sf::Time::Zero)
+		, chunkTime_(sf::Time::Zero)
+		, eventCallback_()
+		, audioClock_(sf::Time::Zero)
+	{
+	}
+
 	/// <summary>
 	/// Plays a pre-loaded music track by providing an <paramref name="id"/> associated with the desired music track and if it should be on <paramref name="loop"/><para/>
 	///
@@ -62,16 +110,127 @@ namespace ae
 		auto found = tracks_.find(id);
 		if (found == tracks_.end()) {
 			DebugLogger::cacheMessage("ae::MusicPlayer<T>::play - Unable to find music track");
+			++AudioPlayer<T>::getStatsCounters().droppedPlays;
+			return;
+		}
+		MusicTrack& track = found->second;
+#else
+		MusicTrack& track = tracks_.find(id)->second;
+#endif
+		startTrack(track, position, loop, sf::Time::Zero, sf::Time::Zero);
+	}
+
+	/// <summary>
+	/// Plays a pre-loaded music track when the audio clock reaches the <paramref name="clockTime"/> provided<para/>
+	///
+	/// The start is scheduled on the audio backend, a <see cref="SoftwareAudioBackend"/> starts the music track on the exact sample.<br/>
+	/// The music track's source will be the position of the listener.
+	/// </summary>
+	/// <param name="id">The id associated with the desired music track</param>
+	/// <param name="loop">True to put the music track on loop, false otherwise</param>
+	/// <param name="clockTime">The time of the audio clock at which the music track starts</param>
+	/// <code>
+	/// enum class MusicID { ID1, ID2, ID3 };
+	/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer;
+	/// ...
+	/// musicPlayer.playAt(MusicID::ID2, true, musicPlayer.getAudioClock() + sf::seconds(4.f));
+	/// </code>
+	/// <seealso cref="getAudioClock"/>
+	template <typename T>
+	void MusicPlayer<T>::playAt(T id, bool loop, sf::Time clockTime)
+	{
+		playAt(AudioPlayer<T>::getListenerPosition(), id, loop, clockTime);
+	}
+
+	/// <summary>
+	/// Plays a pre-loaded music track at a <paramref name="position"/> when the audio clock reaches the <paramref name="clockTime"/> provided<para/>
+	///
+	/// The start is scheduled on the audio backend, a <see cref="SoftwareAudioBackend"/> starts the music track on the exact sample.
+	/// </summary>
+	/// <param name="position">The position of the music track's source</param>
+	/// <param name="id">The id associated with the desired music track</param>
+	/// <param name="loop">True to put the music track on loop, false otherwise</param>
+	/// <param name="clockTime">The time of the audio clock at which the music track starts</param>
+	/// <code>
+	/// enum class MusicID { ID1, ID2, ID3 };
+	/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer;
+	/// ...
+	/// musicPlayer.playAt(sf::Vector2f(250.f, 100.f), MusicID::ID2, true, musicPlayer.getAudioClock() + sf::seconds(4.f));
+	/// </code>
+	/// <seealso cref="getAudioClock"/>
+	template <typename T>
+	void MusicPlayer<T>::playAt(const sf::Vector2f& position, T id, bool loop, sf::Time clockTime)
+	{
+#ifdef _DEBUG
+		auto found = tracks_.find(id);
+		if (found == tracks_.end()) {
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::playAt - Unable to find music track");
+			++AudioPlayer<T>::getStatsCounters().droppedPlays;
+			return;
+		}
+		MusicTrack& track = found->second;
+#else
+		MusicTrack& track = tracks_.find(id)->second;
+#endif
+		startTrack(track, position, loop, sf::Time::Zero, clockTime);
+	}
+
+	/// <summary>
+	/// Plays a pre-loaded music track that fades in over a <paramref name="duration"/><para/>
+	///
+	/// The fade is ramped by the audio backend, no call is needed on the game thread while it lasts.<br/>
+	/// A music track that's already playing fades in from its current fade gain.
+	/// </summary>
+	/// <param name="id">The id associated with the desired music track</param>
+	/// <param name="loop">True to put the music track on loop, false otherwise</param>
+	/// <param name="duration">The duration of the fade-in</param>
+	/// <code>
+	/// enum class MusicID { ID1, ID2, ID3 };
+	/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer;
+	/// ...
+	/// musicPlayer.fadeIn(MusicID::ID1, true, sf::seconds(2.f));
+	/// </code>
+	/// <seealso cref="fadeOut"/>
+	/// <seealso cref="crossfade"/>
+	template <typename T>
+	void MusicPlayer<T>::fadeIn(T id, bool loop, sf::Time duration)
+	{
+		fadeIn(AudioPlayer<T>::getListenerPosition(), id, loop, duration);
+	}
+
+	/// <summary>
+	/// Plays a pre-loaded music track at a <paramref name="position"/> that fades in over a <paramref name="duration"/><para/>
+	///
+	/// The fade is ramped by the audio backend, no call is needed on the game thread while it lasts.<br/>
+	/// A music track that's already playing fades in from its current fade gain.
+	/// </summary>
+	/// <param name="position">The position of the music track's source</param>
+	/// <param name="id">The id associated with the desired music track</param>
+	/// <param name="loop">True to put the music track on loop, false otherwise</param>
+	/// <param name="duration">The duration of the fade-in</param>
+	/// <code>
+	/// enum class MusicID { ID1, ID2, ID3 };
+	/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer;
+	/// ...
+	/// musicPlayer.fadeIn(sf::Vector2f(250.f, 100.f), MusicID::ID1, true, sf::seconds(2.f));
+	/// </code>
+	/// <seealso cref="fadeOut"/>
+	/// <seealso cref="crossfade"/>
+	template <typename T>
+	void MusicPlayer<T>::fadeIn(const sf::Vector2f& position, T id, bool loop, sf::Time duration)
+	{
+#ifdef _DEBUG
+		auto found = tracks_.find(id);
+		if (found == tracks_.end()) {
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::fadeIn - Unable to find music track");
+			++AudioPlayer<T>::getStatsCounters().droppedPlays;
 			return;
 		}
 		MusicTrack& track = found->second;
 #else
 		MusicTrack& track = tracks_.find(id)->second;
 #endif
-		track.music.setPosition(position.x, -position.y, 0.f);
-		track.music.setLoop(loop);
-		track.music.setVolume(AudioPlayer<T>::getGlobalVolume() * track.VOLUME / 100.f);
-		track.music.play();
+		startTrack(track, position, loop, duration, sf::Time::Zero);
 	}
 
 	/// <summary>
@@ -91,15 +250,21 @@ namespace ae
 	template <typename T>
 	void MusicPlayer<T>::pause(bool flag)
 	{
+		AudioBackend& backend = AudioPlayer<T>::getBackend();
+		const sf::Time CLOCK = backend.getAudioClock();
 		if (flag)
 			for (auto& track : tracks_) {
-				if (track.second.music.getStatus() == sf::SoundSource::Status::Playing)
-					track.second.music.pause();
+				if (backend.getStatus(track.second.source) == sf::SoundSource::Status::Playing) {
+					backend.pause(track.second.source);
+					anchorTrack(track.second, CLOCK, backend.getPlayingOffset(track.second.source), false);
+				}
 			}
 		else
 			for (auto& track : tracks_) {
-				if (track.second.music.getStatus() == sf::SoundSource::Status::Paused)
-					track.second.music.play();
+				if (backend.getStatus(track.second.source) == sf::SoundSource::Status::Paused) {
+					backend.play(track.second.source);
+					anchorTrack(track.second, CLOCK, track.second.anchorOffset, true);
+				}
 			}
 	}
 
@@ -127,14 +292,19 @@ namespace ae
 			DebugLogger::cacheMessage("ae::MusicPlayer<T>::pause - Unable to find music track");
 			return;
 		}
-		sf::Music& music = found->second.music;
+		MusicTrack& track = found->second;
 #else
-		sf::Music& music = tracks_.find(id)->second.music;
+		MusicTrack& track = tracks_.find(id)->second;
 #endif
-		if (flag && music.getStatus() == sf::SoundSource::Status::Playing)
-			music.pause();
-		else if (!flag && music.getStatus() == sf::SoundSource::Status::Paused)
-			music.play();
+		AudioBackend& backend = AudioPlayer<T>::getBackend();
+		if (flag && backend.getStatus(track.source) == sf::SoundSource::Status::Playing) {
+			backend.pause(track.source);
+			anchorTrack(track, backend.getAudioClock(), backend.getPlayingOffset(track.source), false);
+		}
+		else if (!flag && backend.getStatus(track.source) == sf::SoundSource::Status::Paused) {
+			backend.play(track.source);
+			anchorTrack(track, backend.getAudioClock(), track.anchorOffset, true);
+		}
 	}
 
 	/// <summary>
@@ -153,8 +323,13 @@ namespace ae
 	template <typename T>
 	void MusicPlayer<T>::stop()
 	{
-		for (auto& track : tracks_)
-			track.second.music.stop();
+		endPlaylist();
+		AudioBackend& backend = AudioPlayer<T>::getBackend();
+		for (auto& track : tracks_) {
+			backend.stop(track.second.source);
+			track.second.seeked = false;
+			anchorTrack(track.second, audioClock_, sf::Time::Zero, false);
+		}
 	}
 
 	/// <summary>
@@ -174,214 +349,1470 @@ namespace ae
 	template <typename T>
 	void MusicPlayer<T>::stop(T id)
 	{
+		if (!playlist_.empty() && playlist_.front() == id)
+			endPlaylist();
 #ifdef _DEBUG
 		auto found = tracks_.find(id);
 		if (found == tracks_.end()) {
 			DebugLogger::cacheMessage("ae::MusicPlayer<T>::stop - Unable to find music track");
 			return;
 		}
-		found->second.music.stop();
+		MusicTrack& track = found->second;
 #else
-		tracks_.find(id)->second.music.stop();
+		MusicTrack& track = tracks_.find(id)->second;
 #endif
+		AudioPlayer<T>::getBackend().stop(track.source);
+		track.seeked = false;
+		anchorTrack(track, audioClock_, sf::Time::Zero, false);
 	}
 
-	/// <summary>Sets the <paramref name="position"/> of the specified music track's source</summary>
-	/// <param name="position">The new position of the specified music track's source</param>
-	/// <param name="id">The id associated with the desired music track</param>
+	/// <summary>Fades out all music tracks over a <paramref name="duration"/>, they're stopped once faded out</summary>
+	/// <param name="duration">The duration of the fade-out</param>
 	/// <code>
 	/// enum class MusicID { ID1, ID2, ID3 };
 	/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer;
 	/// ...
-	/// musicPlayer.setMusicSourcePosition(boomboxZombie.getPosition(), MusicID::ID1);
+	/// musicPlayer.fadeOut(sf::seconds(3.f));
 	/// </code>
+	/// <seealso cref="fadeIn"/>
+	/// <seealso cref="stop"/>
 	template <typename T>
-	void MusicPlayer<T>::setMusicSourcePosition(const sf::Vector2f& position, T id)
+	void MusicPlayer<T>::fadeOut(sf::Time duration)
 	{
-#ifdef _DEBUG
-		auto found = tracks_.find(id);
-		if (found == tracks_.end()) {
-			DebugLogger::cacheMessage("ae::MusicPlayer<T>::setMusicSourcePosition - Unable to find music track");
-			return;
-		}
-		found->second.music.setPosition(position.x, -position.y, 0.f);
-#else
-		tracks_.find(id)->second.music.setPosition(position.x, -position.y, 0.f);
-#endif
+		endPlaylist();
+		AudioBackend& backend = AudioPlayer<T>::getBackend();
+		for (auto& track : tracks_)
+			backend.fade(track.second.source, 0.f, duration, true);
 	}
 
-	/// <summary>Retrieves the status of the specified music track</summary>
-	/// <param name="id">The id associated with the desired music track</param>
-	/// <returns>The status of the specified music track</returns>
+	/// <summary>Fades out the specified music track over a <paramref name="duration"/>, it's stopped once faded out</summary>
+	/// <param name="id">The id associated with the music track</param>
+	/// <param name="duration">The duration of the fade-out</param>
 	/// <code>
 	/// enum class MusicID { ID1, ID2, ID3 };
 	/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer;
 	/// ...
-	/// if (musicPlayer.getMusicStatus(MusicID::ID2) == sf::SoundSource::Status::Paused) {
-	///		...
-	/// }
+	/// musicPlayer.fadeOut(MusicID::ID1, sf::seconds(3.f));
 	/// </code>
+	/// <seealso cref="fadeIn"/>
+	/// <seealso cref="crossfade"/>
 	template <typename T>
-	sf::SoundSource::Status MusicPlayer<T>::getMusicStatus(T id) const
+	void MusicPlayer<T>::fadeOut(T id, sf::Time duration)
 	{
+		if (!playlist_.empty() && playlist_.front() == id)
+			endPlaylist();
 #ifdef _DEBUG
 		auto found = tracks_.find(id);
 		if (found == tracks_.end()) {
-			DebugLogger::cacheMessage("ae::MusicPlayer<T>::getMusicStatus - Unable to find music track");
-			return sf::SoundSource::Status::Stopped;
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::fadeOut - Unable to find music track");
+			return;
 		}
-		return found->second.music.getStatus();
+		AudioPlayer<T>::getBackend().fade(found->second.source, 0.f, duration, true);
 #else
-		return tracks_.find(id)->second.music.getStatus();
+		AudioPlayer<T>::getBackend().fade(tracks_.find(id)->second.source, 0.f, duration, true);
 #endif
 	}
 
-	/// <summary>
-	/// Sets the music player's global volume (0% - 100%)<para/>
-	///
-	/// A global volume of 50% will reduce the music player's tracks' volume by half of their current volume.
-	/// </summary>
-	/// <param name="globalVolume">The music player's global volume</param>
+	/// <summary>Fades out a music track while another one fades in over a <paramref name="duration"/></summary>
+	/// <param name="from">The id associated with the music track to fade out</param>
+	/// <param name="to">The id associated with the music track to fade in</param>
+	/// <param name="loop">True to put the music track faded in on loop, false otherwise</param>
+	/// <param name="duration">The duration of the crossfade</param>
 	/// <code>
-	/// enum class MusicID { ID1, ID2, ID3 };
+	/// enum class MusicID { Exploration, Battle };
 	/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer;
-	/// musicPlayer.setGlobalVolume(50.f);
+	/// ...
+	/// musicPlayer.crossfade(MusicID::Exploration, MusicID::Battle, true, sf::seconds(1.5f));
 	/// </code>
+	/// <seealso cref="fadeIn"/>
+	/// <seealso cref="fadeOut"/>
 	template <typename T>
-	void MusicPlayer<T>::setGlobalVolume(float globalVolume)
+	void MusicPlayer<T>::crossfade(T from, T to, bool loop, sf::Time duration)
 	{
-		AudioPlayer<T>::setGlobalVolume(globalVolume);
-
-		const float GLOBAL_VOLUME = AudioPlayer<T>::getGlobalVolume();
-		for (auto& track : tracks_)
-			track.second.music.setVolume(GLOBAL_VOLUME * track.second.VOLUME / 100.f);
+		fadeOut(from, duration);
+		fadeIn(to, loop, duration);
 	}
 
 	/// <summary>
-	/// Loads in a music track by providing a <paramref name="filepath"/> and an <paramref name="id"/> to associate it with<para/>
-	///
-	/// The <see cref="AudioProperties"/> of the music track will be those by default.<para/>
+	/// Queues a pre-loaded music track in the playlist, it's played once the music tracks queued before it have ended<para/>
 	///
-	/// Only music tracks with one channel (mono sounds) can be spatialized.
+	/// The playlist starts straight away if it was empty, its music tracks are played at the listener's position and aren't looped.<br/>
+	/// The next music track is chained to the one playing on the audio backend, a <see cref="SoftwareAudioBackend"/> starts it on the sample following the end of the previous one.<br/>
+	/// Its stream is opened and its first frames decoded as soon as it's chained, no file is read on the game thread for the transition.<br/>
+	/// Stopping or fading out the music track playing ends the playlist, a music track queued right after itself is restarted by <see cref="update"/> (with a gap).
 	/// </summary>
-	/// <param name="filepath">The music track's filepath</param>
-	/// <param name="id">An ID with which to associate the music track (i.e. an enum value)</param>
+	/// <param name="id">The id associated with the music track to queue</param>
 	/// <code>
-	/// enum class MusicID { ID1, ID2, ID3 };
-	/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer;
-	/// musicPlayer.load("Assets/Music/Soundtrack.wav", MusicID::ID1);
+	/// enum class MusicID { Intro, Loop, Outro };
+	/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer(backend);
+	/// ...
+	/// musicPlayer.queue(MusicID::Intro);
+	/// musicPlayer.queue(MusicID::Loop);
+	/// musicPlayer.queue(MusicID::Outro);
 	/// </code>
-	/// <seealso cref="unload"/>
-	/// <seealso cref="play"/>
+	/// <seealso cref="update"/>
+	/// <seealso cref="clearQueue"/>
+	/// <seealso cref="setPlaylistLoop"/>
 	template <typename T>
-	void MusicPlayer<T>::load(const std::string& filepath, T id)
+	void MusicPlayer<T>::queue(T id)
 	{
-		if (tracks_.find(id) == tracks_.end()) {
-			AudioProperties properties;
-			tracks_.insert(std::make_pair(id, MusicTrack(properties.getVolume())));
-			setupTrack(properties, filepath);
-		}
 #ifdef _DEBUG
-		else {
-			DebugLogger::cacheMessage("ae::MusicPlayer<T>::load - Attempt to load in music track that's already loaded in");
+		auto found = tracks_.find(id);
+		if (found == tracks_.end()) {
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::queue - Unable to find music track");
+			++AudioPlayer<T>::getStatsCounters().droppedPlays;
+			return;
 		}
+		MusicTrack& track = found->second;
+#else
+		MusicTrack& track = tracks_.find(id)->second;
 #endif
+		playlist_.push_back(id);
+		if (playlist_.size() == 1)
+			startTrack(track, AudioPlayer<T>::getListenerPosition(), false, sf::Time::Zero, sf::Time::Zero);
+		else
+			chainNext();
+	}
+
+	/// <summary>Removes the music tracks queued after the one playing, which plays until its end</summary>
+	/// <code>
+	/// musicPlayer.clearQueue();
+	/// musicPlayer.queue(MusicID::Outro);
+	/// </code>
+	/// <seealso cref="queue"/>
+	template <typename T>
+	void MusicPlayer<T>::clearQueue()
+	{
+		if (playlist_.empty())
+			return;
+
+		if (playlistChained_)
+			AudioPlayer<T>::getBackend().chain(tracks_.find(playlist_.front())->second.source, 0);
+		playlist_.erase(playlist_.begin() + 1, playlist_.end());
+		playlistChained_ = false;
+	}
+
+	/// <summary>Sets if the music tracks of the playlist are queued again once they've ended</summary>
+	/// <param name="flag">True to loop the playlist, false otherwise (default)</param>
+	/// <seealso cref="getPlaylistLoop"/>
+	/// <seealso cref="queue"/>
+	template <typename T>
+	void MusicPlayer<T>::setPlaylistLoop(bool flag)
+	{
+		playlistLoop_ = flag;
+	}
+
+	/// <summary>Retrieves if the music tracks of the playlist are queued again once they've ended</summary>
+	/// <returns>True if the playlist is looped, false otherwise</returns>
+	/// <seealso cref="setPlaylistLoop"/>
+	template <typename T>
+	bool MusicPlayer<T>::getPlaylistLoop() const
+	{
+		return playlistLoop_;
 	}
 
 	/// <summary>
-	/// Loads in a music track by providing a <paramref name="filepath"/>, an <see cref="AudioProperties"/> that contain the music track's properties, and an <paramref name="id"/> to associate it with<para/>
+	/// Advances the playlist and reports the beats and markers played, should be called once per frame<para/>
 	///
-	/// Only music tracks with one channel (mono sounds) can be spatialized.
+	/// The music track that ended is removed from the playlist (and queued again if the playlist is looped) and the following one is chained to the new one.<br/>
+	/// The next music track is started here if the audio backend can't chain sources (i.e. the SFML backend), once the previous one has ended.<br/>
+	/// The audio clock is read once for the music clocks and the beats and markers played are drained from the audio backend's wait-free queue to the event callback.<br/>
+	/// The ducking ramps of the buses the music tracks play on are advanced.
 	/// </summary>
-	/// <param name="filepath">The music track's filepath</param>
-	/// <param name="properties">The <see cref="AudioProperties"/> that contain the music track's properties</param>
-	/// <param name="id">An ID with which to associate the music track (i.e. an enum value)</param>
 	/// <code>
-	/// enum class MusicID { ID1, ID2, ID3 };
-	/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer;
-	/// musicPlayer.load("Assets/Music/Soundtrack.wav", ae::AudioProperties(100.f, 35.f, 1.f, 250.f), MusicID::ID1);
+	/// while (window.isOpen()) {
+	///		musicPlayer.update();
+	///		...
+	/// }
 	/// </code>
-	/// <seealso cref="unload"/>
-	/// <seealso cref="play"/>
+	/// <seealso cref="queue"/>
 	template <typename T>
-	void MusicPlayer<T>::load(const std::string& filepath, const AudioProperties& properties, T id)
+	void MusicPlayer<T>::update()
 	{
-		if (tracks_.find(id) == tracks_.end()) {
-			tracks_.insert(std::make_pair(id, MusicTrack(properties.getVolume())));
-			setupTrack(properties, filepath);
-		}
-#ifdef _DEBUG
-		else {
-			DebugLogger::cacheMessage("ae::MusicPlayer<T>::load - Attempt to load in music track that's already loaded in");
+		AudioBackend& backend = AudioPlayer<T>::getBackend();
+		audioClock_ = backend.getAudioClock();
+		AudioPlayer<T>::getBus().update(audioClock_);
+		for (auto& track : tracks_)
+			track.second.bus->update(audioClock_);
+		dispatchEvents();
+		if (playlist_.empty() || backend.getStatus(tracks_.find(playlist_.front())->second.source) != sf::SoundSource::Status::Stopped)
+			return;
+
+		// The music track playing has ended, the backend started the next one on the following sample if they were chained
+		const T ENDED = playlist_.front();
+		MusicTrack& ended = tracks_.find(ENDED)->second;
+		const sf::Time END_CLOCK = (ended.anchorSpeed > 0.f) ? ended.anchorClock + (ended.duration - ended.anchorOffset) / ended.anchorSpeed : audioClock_;
+		anchorTrack(ended, END_CLOCK, sf::Time::Zero, false);
+		playlist_.pop_front();
+		if (playlistLoop_)
+			playlist_.push_back(ENDED);
+		if (playlist_.empty())
+			return;
+
+		MusicTrack& next = tracks_.find(playlist_.front())->second;
+		if (playlistChained_ && backend.getStatus(next.source) == sf::SoundSource::Status::Playing) {
+			++AudioPlayer<T>::getStatsCounters().plays;
+			anchorTrack(next, END_CLOCK, sf::Time::Zero, true);
 		}
-#endif
+		else
+			startTrack(next, AudioPlayer<T>::getListenerPosition(), false, sf::Time::Zero, sf::Time::Zero);
+		playlistChained_ = false;
+		chainNext();
 	}
 
-	/// <summary>
-	/// Unloads a loaded-in music track by providing the associated <paramref name="id"/><para/>
-	///
-	/// The music track associated with this <paramref name="id"/> will be removed (even if it's currently playing).
-	/// </summary>
-	/// <param name="id">The ID associated with the music track to unload</param>
+	/// <summary>Sets the <paramref name="position"/> of the specified music track's source</summary>
+	/// <param name="position">The new position of the specified music track's source</param>
+	/// <param name="id">The id associated with the desired music track</param>
 	/// <code>
 	/// enum class MusicID { ID1, ID2, ID3 };
 	/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer;
 	/// ...
-	/// musicPlayer.unload(MusicID::ID1);
+	/// musicPlayer.setMusicSourcePosition(boomboxZombie.getPosition(), MusicID::ID1);
 	/// </code>
-	/// <seealso cref="load"/>
 	template <typename T>
-	void MusicPlayer<T>::unload(T id)
+	void MusicPlayer<T>::setMusicSourcePosition(const sf::Vector2f& position, T id)
 	{
 #ifdef _DEBUG
 		auto found = tracks_.find(id);
 		if (found == tracks_.end()) {
-			DebugLogger::cacheMessage("ae::MusicPlayer<T>::unload - The ID provided isn't associated with any music track");
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::setMusicSourcePosition - Unable to find music track");
 			return;
 		}
-		tracks_.erase(found);
+		AudioPlayer<T>::getBackend().setPosition(found->second.source, sf::Vector3f(position.x, -position.y, 0.f));
 #else
-		tracks_.erase(tracks_.find(id));
+		AudioPlayer<T>::getBackend().setPosition(tracks_.find(id)->second.source, sf::Vector3f(position.x, -position.y, 0.f));
 #endif
 	}
 
-	/// <summary>Sets up the new music track by providing the <see cref="AudioProperties"/> and the <paramref name="filepath"/> of the music track</summary>
-	/// <param name="properties">The <see cref="AudioProperties"/> that contain the music track's properties</param>
-	/// <param name="filepath">The music track's filepath</param>
+	/// <summary>Retrieves the status of the specified music track</summary>
+	/// <param name="id">The id associated with the desired music track</param>
+	/// <returns>The status of the specified music track</returns>
+	/// <code>
+	/// enum class MusicID { ID1, ID2, ID3 };
+	/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer;
+	/// ...
+	/// if (musicPlayer.getMusicStatus(MusicID::ID2) == sf::SoundSource::Status::Paused) {
+	///		...
+	/// }
+	/// </code>
 	template <typename T>
-	void MusicPlayer<T>::setupTrack(const AudioProperties& properties, const std::string& filepath)
+	sf::SoundSource::Status MusicPlayer<T>::getMusicStatus(T id) const
 	{
-		// Retrieve the newly inserted music track and configure its properties
-		sf::Music& music = tracks_.rbegin()->second.music;
-		if (music.openFromFile(filepath)) {
-			music.setAttenuation(properties.getAttenuation());
-			music.setPitch(properties.getPitch());
-			music.setMinDistance(properties.getMinDistance3D());
-			music.setRelativeToListener(properties.isRelativeToListener());
-		}
-		else {
 #ifdef _DEBUG
-			DebugLogger::cacheMessage("ae::MusicPlayer<T>::loadTrack - Failed to open \"" + filepath + '"');
-#endif
-			tracks_.erase(tracks_.rbegin()->first);
+		auto found = tracks_.find(id);
+		if (found == tracks_.end()) {
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::getMusicStatus - Unable to find music track");
+			return sf::SoundSource::Status::Stopped;
 		}
+		return AudioPlayer<T>::getBackend().getStatus(found->second.source);
+#else
+		return AudioPlayer<T>::getBackend().getStatus(tracks_.find(id)->second.source);
+#endif
 	}
 
-	/// <summary>Constructs the <see cref="MusicTrack"/> by providing the original <paramref name="volume"/></summary>
-	/// <param name="volume">The original volume of the music track</param>
+	/// <summary>Retrieves the duration of the specified music track, read from its file's header when it was loaded in</summary>
+	/// <param name="id">The id associated with the desired music track</param>
+	/// <returns>The duration of the specified music track</returns>
+	/// <code>
+	/// const sf::Time DURATION = musicPlayer.getMusicDuration(MusicID::ID1);
+	/// </code>
 	template <typename T>
-	MusicPlayer<T>::MusicTrack::MusicTrack(float volume)
-		: music()
-		, VOLUME(volume)
+	sf::Time MusicPlayer<T>::getMusicDuration(T id) const
 	{
+#ifdef _DEBUG
+		auto found = tracks_.find(id);
+		if (found == tracks_.end()) {
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::getMusicDuration - Unable to find music track");
+			return sf::Time::Zero;
+		}
+		return found->second.duration;
+#else
+		return tracks_.find(id)->second.duration;
+#endif
 	}
 
-	/// <summary>Move constructor</summary>
-	/// <param name="other">The <see cref="MusicTrack"/> to be moved</param>
+	/// <summary>
+	/// Changes the playing position of the specified music track<para/>
+	///
+	/// A music track that isn't playing has its stream opened and its decoder positioned straight away by the decode threads, it resumes from the new position without a gap once played.<br/>
+	/// The stream of a stopped music track stays open until it's played or stopped, it isn't closed to make room for others (see <see cref="setMaxOpenTracks"/>).<br/>
+	/// No seek table is kept: the decoder searches the compressed file for the position itself (an OGG file is bisected), the seek is only kept off the audio path.<br/>
+	/// Music tracks read from memory (see <see cref="loadFromMemory"/>) seek without reading the disk.
+	/// </summary>
+	/// <param name="id">The id associated with the desired music track</param>
+	/// <param name="offset">The new playing position, from the beginning of the music track</param>
+	/// <code>
+	/// // Resume the level's music where it was saved
+	/// musicPlayer.setPlayingOffset(MusicID::Level, save.musicOffset);
+	/// musicPlayer.play(MusicID::Level, true);
+	/// </code>
+	/// <seealso cref="getPlayingOffset"/>
 	template <typename T>
-	MusicPlayer<T>::MusicTrack::MusicTrack(MusicTrack&& other)
-		: music()
-		, VOLUME(std::move(other.VOLUME))
+	void MusicPlayer<T>::setPlayingOffset(T id, sf::Time offset)
 	{
+#ifdef _DEBUG
+		auto found = tracks_.find(id);
+		if (found == tracks_.end()) {
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::setPlayingOffset - Unable to find music track");
+			return;
+		}
+		MusicTrack& track = found->second;
+#else
+		MusicTrack& track = tracks_.find(id)->second;
+#endif
+
+		// The stream is opened now so that the decoder's seek is done before the music track is played
+		AudioBackend& backend = AudioPlayer<T>::getBackend();
+		if (openTrack(track)) {
+			track.seeked = (backend.getStatus(track.source) == sf::SoundSource::Status::Stopped);
+			backend.setPlayingOffset(track.source, offset);
+			anchorTrack(track, backend.getAudioClock(), offset, track.anchorSpeed > 0.f);
+		}
+	}
+
+	/// <summary>Retrieves the playing position of the specified music track</summary>
+	/// <param name="id">The id associated with the desired music track</param>
+	/// <returns>The playing position of the specified music track, zero if its stream is closed</returns>
+	/// <code>
+	/// save.musicOffset = musicPlayer.getPlayingOffset(MusicID::Level);
+	/// </code>
+	/// <seealso cref="setPlayingOffset"/>
+	template <typename T>
+	sf::Time MusicPlayer<T>::getPlayingOffset(T id) const
+	{
+#ifdef _DEBUG
+		auto found = tracks_.find(id);
+		if (found == tracks_.end()) {
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::getPlayingOffset - Unable to find music track");
+			return sf::Time::Zero;
+		}
+		return found->second.source ? AudioPlayer<T>::getBackend().getPlayingOffset(found->second.source) : sf::Time::Zero;
+#else
+		const MusicTrack& track = tracks_.find(id)->second;
+		return track.source ? AudioPlayer<T>::getBackend().getPlayingOffset(track.source) : sf::Time::Zero;
+#endif
+	}
+
+	/// <summary>
+	/// Sets the maximum amount of music tracks whose stream is kept open (8 by default, at least 1)<para/>
+	///
+	/// Each open stream holds a file handle, a decoder and its buffered frames.<br/>
+	/// The streams of the least recently played music tracks that are stopped are closed to make room, they're opened again on their next play.<br/>
+	/// Music tracks that are playing, paused, seeked ahead of play or queued next in the playlist are never closed, the maximum is exceeded while more of them are open.
+	/// </summary>
+	/// <param name="count">The maximum amount of open music tracks</param>
+	/// <code>
+	/// musicPlayer.setMaxOpenTracks(4);
+	/// </code>
+	/// <seealso cref="getMaxOpenTracks"/>
+	/// <seealso cref="getOpenTrackCount"/>
+	template <typename T>
+	void MusicPlayer<T>::setMaxOpenTracks(std::size_t count)
+	{
+		maxOpenTracks_ = std::max<std::size_t>(count, 1);
+		closeIdleTracks(maxOpenTracks_);
+	}
+
+	/// <summary>Retrieves the maximum amount of music tracks whose stream is kept open</summary>
+	/// <returns>The maximum amount of open music tracks</returns>
+	/// <seealso cref="setMaxOpenTracks"/>
+	template <typename T>
+	std::size_t MusicPlayer<T>::getMaxOpenTracks() const
+	{
+		return maxOpenTracks_;
+	}
+
+	/// <summary>Retrieves the amount of music tracks whose stream is currently open</summary>
+	/// <returns>The amount of open music tracks</returns>
+	/// <seealso cref="setMaxOpenTracks"/>
+	template <typename T>
+	std::size_t MusicPlayer<T>::getOpenTrackCount() const
+	{
+		return openTracks_.size();
+	}
+
+	/// <summary>
+	/// Sets the duration the streams of the music tracks decode ahead and the duration they decode at once (the music tracks with their own buffering excepted)<para/>
+	///
+	/// Longer buffers survive slower storage and I/O pressure, shorter ones use less memory; longer chunks keep the file accesses sequential.<br/>
+	/// The volume, fades and layer gains are applied as the frames are mixed, so the buffering doesn't delay the reactions of the music.<br/>
+	/// It's applied to the streams already open, the frames decoded ahead are kept. Backends with fixed buffers (i.e. the SFML backend) ignore it.
+	/// </summary>
+	/// <param name="bufferTime">The duration decoded ahead, zero for the audio backend's default</param>
+	/// <param name="chunkTime">The minimum duration decoded at once, zero for a quarter of the buffer</param>
+	/// <code>
+	/// // Slow storage: decode two seconds ahead, half a second at a time
+	/// musicPlayer.setStreamBuffering(sf::seconds(2.f), sf::seconds(0.5f));
+	/// </code>
+	/// <seealso cref="getStreamState"/>
+	template <typename T>
+	void MusicPlayer<T>::setStreamBuffering(sf::Time bufferTime, sf::Time chunkTime)
+	{
+		bufferTime_ = bufferTime;
+		chunkTime_ = chunkTime;
+		for (MusicTrack* track : openTracks_)
+			if (track->bufferTime == sf::Time::Zero)
+				applyBuffering(*track);
+	}
+
+	/// <summary>
+	/// Sets the duration the stream of the specified music track decodes ahead and the duration it decodes at once, instead of the music player's<para/>
+	///
+	/// It's applied to the music track's stream if it's open, and again each time it's opened.
+	/// </summary>
+	/// <param name="id">The id associated with the desired music track</param>
+	/// <param name="bufferTime">The duration decoded ahead, zero to use the music player's buffering the next time the stream is opened</param>
+	/// <param name="chunkTime">The minimum duration decoded at once, zero for a quarter of the buffer</param>
+	/// <code>
+	/// // The combat music reacts quickly and is played often, keep its buffer small
+	/// musicPlayer.setStreamBuffering(MusicID::Combat, sf::milliseconds(250), sf::Time::Zero);
+	/// </code>
+	/// <seealso cref="getStreamState"/>
+	template <typename T>
+	void MusicPlayer<T>::setStreamBuffering(T id, sf::Time bufferTime, sf::Time chunkTime)
+	{
+#ifdef _DEBUG
+		auto found = tracks_.find(id);
+		if (found == tracks_.end()) {
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::setStreamBuffering - Unable to find music track");
+			return;
+		}
+		MusicTrack& track = found->second;
+#else
+		MusicTrack& track = tracks_.find(id)->second;
+#endif
+		track.bufferTime = bufferTime;
+		track.chunkTime = chunkTime;
+		if (track.source)
+			applyBuffering(track);
+	}
+
+	/// <summary>
+	/// Retrieves the state of the buffer decoded ahead by the stream of the specified music track, cheap enough to be polled every frame<para/>
+	///
+	/// The underruns are those of the music track's current stream, they start again from zero when the stream is opened again.
+	/// </summary>
+	/// <param name="id">The id associated with the desired music track</param>
+	/// <param name="fill">The fill level (0 - 1) of the stream's buffer</param>
+	/// <param name="underruns">The amount of times the stream ran out of decoded frames</param>
+	/// <returns>True if the music track's stream is open and reports its buffer, false otherwise</returns>
+	/// <code>
+	/// float fill = 0.f;
+	/// std::size_t underruns = 0;
+	/// if (musicPlayer.getStreamState(MusicID::ID1, fill, underruns))
+	///		overlay.plot("Music buffer", fill);
+	/// </code>
+	/// <seealso cref="setStreamBuffering"/>
+	template <typename T>
+	bool MusicPlayer<T>::getStreamState(T id, float& fill, std::size_t& underruns) const
+	{
+#ifdef _DEBUG
+		auto found = tracks_.find(id);
+		if (found == tracks_.end()) {
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::getStreamState - Unable to find music track");
+			return false;
+		}
+		const MusicTrack& track = found->second;
+#else
+		const MusicTrack& track = tracks_.find(id)->second;
+#endif
+		return track.source && AudioPlayer<T>::getBackend().getStreamState(track.source, fill, underruns);
+	}
+
+	/// <summary>
+	/// Sets the tempo of the specified music track, its beats are reported to the event callback and count the beats of its music clock<para/>
+	///
+	/// The beats are laid from the first beat to the end of the music track, they follow its pitch and its loops.
+	/// </summary>
+	/// <param name="id">The id associated with the desired music track</param>
+	/// <param name="bpm">The tempo in beats per minute, 0 to remove it</param>
+	/// <param name="beatsPerBar">The amount of beats per bar (i.e. 4 for a 4/4 time signature)</param>
+	/// <param name="firstBeat">The position of the first beat (the downbeat of the first bar)</param>
+	/// <code>
+	/// musicPlayer.setTempo(MusicID::Boss, 128.f, 4, sf::milliseconds(250));
+	/// </code>
+	/// <seealso cref="setEventCallback"/>
+	/// <seealso cref="getMusicBeat"/>
+	template <typename T>
+	void MusicPlayer<T>::setTempo(T id, float bpm, unsigned int beatsPerBar, sf::Time firstBeat)
+	{
+#ifdef _DEBUG
+		auto found = tracks_.find(id);
+		if (found == tracks_.end()) {
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::setTempo - Unable to find music track");
+			return;
+		}
+		MusicTrack& track = found->second;
+#else
+		MusicTrack& track = tracks_.find(id)->second;
+#endif
+		track.tempo = std::max(bpm, 0.f);
+		track.beatsPerBar = std::max(beatsPerBar, 1u);
+		track.firstBeat = std::max(firstBeat, sf::Time::Zero);
+		layCues(track);
+	}
+
+	/// <summary>
+	/// Sets the <paramref name="markers"/> of the specified music track (i.e. the drop of a song), they're reported to the event callback as they're played<para/>
+	///
+	/// The beats and the markers are detected by the audio backend on the exact frame where they're mixed, and delivered through a wait-free queue drained by <see cref="update"/>.<br/>
+	/// Backends that don't mix in software (i.e. the SFML backend) don't report them, the music clock is then only anchored by the calls of the music player.<br/>
+	/// The markers of all the streams of the audio backend share its queue, a single music player per backend should set markers.
+	/// </summary>
+	/// <param name="id">The id associated with the desired music track</param>
+	/// <param name="markers">The positions of the markers, in any order (empty to remove them)</param>
+	/// <code>
+	/// enum Marker { Drop, Breakdown };
+	/// musicPlayer.setMarkers(MusicID::Boss, { sf::seconds(32.f), sf::seconds(96.f) });
+	/// </code>
+	/// <seealso cref="setEventCallback"/>
+	template <typename T>
+	void MusicPlayer<T>::setMarkers(T id, const std::vector<sf::Time>& markers)
+	{
+#ifdef _DEBUG
+		auto found = tracks_.find(id);
+		if (found == tracks_.end()) {
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::setMarkers - Unable to find music track");
+			return;
+		}
+		MusicTrack& track = found->second;
+#else
+		MusicTrack& track = tracks_.find(id)->second;
+#endif
+		track.markers = markers;
+		layCues(track);
+	}
+
+	/// <summary>Sets the function called by <see cref="update"/> for each beat and marker played since the previous frame, in the order they were mixed</summary>
+	/// <param name="callback">The function called for each event, nullptr to remove it</param>
+	/// <code>
+	/// musicPlayer.setEventCallback([&amp;](const ae::MusicPlayer&lt;MusicID&gt;::MusicEvent&amp; event) {
+	///		if (event.type == ae::MusicPlayer&lt;MusicID&gt;::MusicEvent::Type::Beat &amp;&amp; event.beat == 0)
+	///			stageLights.flash();
+	///		else if (event.type == ae::MusicPlayer&lt;MusicID&gt;::MusicEvent::Type::Marker &amp;&amp; event.index == Drop)
+	///			spawner.startWave();
+	/// });
+	/// </code>
+	/// <seealso cref="setTempo"/>
+	/// <seealso cref="setMarkers"/>
+	template <typename T>
+	void MusicPlayer<T>::setEventCallback(const EventCallback& callback)
+	{
+		eventCallback_ = callback;
+	}
+
+	/// <summary>
+	/// Retrieves the precise playing position of the specified music track, extrapolated from the audio clock read by the last <see cref="update"/><para/>
+	///
+	/// The music clock is anchored when the music track is played, paused or positioned, and again on the exact frame of each of its beats and markers played,
+	/// so it doesn't query the audio backend's stream. It's frozen while the music track is paused or stopped.
+	/// </summary>
+	/// <param name="id">The id associated with the desired music track</param>
+	/// <returns>The extrapolated playing position of the specified music track</returns>
+	/// <code>
+	/// const sf::Time POSITION = musicPlayer.getMusicClock(MusicID::Boss);
+	/// </code>
+	/// <seealso cref="getMusicBeat"/>
+	template <typename T>
+	sf::Time MusicPlayer<T>::getMusicClock(T id) const
+	{
+#ifdef _DEBUG
+		auto found = tracks_.find(id);
+		if (found == tracks_.end()) {
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::getMusicClock - Unable to find music track");
+			return sf::Time::Zero;
+		}
+		return computeClock(found->second);
+#else
+		return computeClock(tracks_.find(id)->second);
+#endif
+	}
+
+	/// <summary>Retrieves the beat of the specified music track's clock counted from its first beat, along with its fraction (negative before the first beat)</summary>
+	/// <param name="id">The id associated with the desired music track</param>
+	/// <returns>The beat of the music track, 0 if it has no tempo</returns>
+	/// <code>
+	/// // Pulse the lights on each beat and change their colour on each bar
+	/// const float BEAT = musicPlayer.getMusicBeat(MusicID::Boss);
+	/// stageLights.setIntensity(1.f - (BEAT - std::floor(BEAT)));
+	/// stageLights.setColour(palette[static_cast&lt;std::size_t&gt;(BEAT / 4.f) % palette.size()]);
+	/// </code>
+	/// <seealso cref="setTempo"/>
+	/// <seealso cref="getMusicClock"/>
+	template <typename T>
+	float MusicPlayer<T>::getMusicBeat(T id) const
+	{
+#ifdef _DEBUG
+		auto found = tracks_.find(id);
+		if (found == tracks_.end()) {
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::getMusicBeat - Unable to find music track");
+			return 0.f;
+		}
+		const MusicTrack& track = found->second;
+#else
+		const MusicTrack& track = tracks_.find(id)->second;
+#endif
+		return (track.tempo > 0.f) ? (computeClock(track) - track.firstBeat).asSeconds() * track.tempo / 60.f : 0.f;
+	}
+
+	/// <summary>
+	/// Sets the music player's global volume (0% - 100%)<para/>
+	///
+	/// A global volume of 50% will reduce the music player's tracks' volume by half of their current volume.<br/>
+	/// Only the music tracks on the music player's bus and its sub-buses are updated.
+	/// </summary>
+	/// <param name="globalVolume">The music player's global volume</param>
+	/// <code>
+	/// enum class MusicID { ID1, ID2, ID3 };
+	/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer;
+	/// musicPlayer.setGlobalVolume(50.f);
+	/// </code>
+	template <typename T>
+	void MusicPlayer<T>::setGlobalVolume(float globalVolume)
+	{
+		// The bus applies its new gain to the music tracks attached to it
+		AudioPlayer<T>::setGlobalVolume(globalVolume);
+	}
+
+	/// <summary>
+	/// Routes a loaded-in music track to a <paramref name="bus"/> by providing the associated <paramref name="id"/><para/>
+	///
+	/// The music tracks are on the music player's bus by default.
+	/// </summary>
+	/// <param name="bus">The bus of the music track (it must outlive the music player)</param>
+	/// <param name="id">The ID associated with the music track</param>
+	/// <code>
+	/// enum class MusicID { ID1, ID2, ID3 };
+	/// ae::AudioBus ambience;
+	/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer;
+	/// ambience.setParent(&amp;musicPlayer.getBus());
+	/// musicPlayer.setBus(ambience, MusicID::ID1);
+	/// </code>
+	template <typename T>
+	void MusicPlayer<T>::setBus(AudioBus& bus, T id)
+	{
+#ifdef _DEBUG
+		auto found = tracks_.find(id);
+		if (found == tracks_.end()) {
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::setBus - Unable to find music track");
+			return;
+		}
+		MusicTrack& track = found->second;
+#else
+		MusicTrack& track = tracks_.find(id)->second;
+#endif
+		if (track.bus == &bus)
+			return;
+
+		// A closed music track is attached to its bus when its stream is opened
+		applyLoudness(track);
+		if (track.source) {
+			track.bus->detach(track.backend, track.source);
+			bus.attach(track.backend, track.source, track.VOLUME * track.gain);
+		}
+		track.bus = &bus;
+	}
+
+	/// <summary>
+	/// Sets the <paramref name="effects"/> processing a loaded-in music track alone by providing the associated <paramref name="id"/><para/>
+	///
+	/// The effects are only processed by backends mixing in software (i.e. a <see cref="SoftwareAudioBackend"/>).
+	/// </summary>
+	/// <param name="effects">The effect chain (it must outlive the music player), nullptr to remove it</param>
+	/// <param name="id">The ID associated with the music track</param>
+	/// <code>
+	/// enum class MusicID { ID1, ID2, ID3 };
+	/// ae::BiquadFilter muffle(ae::BiquadFilter::Type::LowPass, 600.f);
+	/// ae::EffectChain underwater;
+	/// underwater.add(muffle);
+	/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer(backend);
+	/// musicPlayer.setEffects(&amp;underwater, MusicID::ID1);
+	/// </code>
+	template <typename T>
+	void MusicPlayer<T>::setEffects(EffectChain* effects, T id)
+	{
+#ifdef _DEBUG
+		auto found = tracks_.find(id);
+		if (found == tracks_.end()) {
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::setEffects - Unable to find music track");
+			return;
+		}
+		MusicTrack& track = found->second;
+#else
+		MusicTrack& track = tracks_.find(id)->second;
+#endif
+		track.effects = effects;
+		track.backend.setSourceEffects(track.source, effects);
+	}
+
+	/// <summary>
+	/// Loads in a music track by providing a <paramref name="filepath"/> and an <paramref name="id"/> to associate it with<para/>
+	///
+	/// The <see cref="AudioProperties"/> of the music track will be those by default.<para/>
+	///
+	/// Only the header of the file is read, the music track's stream is opened on its first play (see <see cref="setMaxOpenTracks"/>).<br/>
+	/// Only music tracks with one channel (mono sounds) can be spatialized.<br/>
+	/// With loudness normalization, the music track is measured by a background thread unless the loudness cache knows it, its gain is applied once measured the next time it's played.
+	/// </summary>
+	/// <param name="filepath">The music track's filepath</param>
+	/// <param name="id">An ID with which to associate the music track (i.e. an enum value)</param>
+	/// <code>
+	/// enum class MusicID { ID1, ID2, ID3 };
+	/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer;
+	/// musicPlayer.load("Assets/Music/Soundtrack.wav", MusicID::ID1);
+	/// </code>
+	/// <seealso cref="unload"/>
+	/// <seealso cref="play"/>
+	template <typename T>
+	void MusicPlayer<T>::load(const std::string& filepath, T id)
+	{
+		load(filepath, AudioProperties(), id);
+	}
+
+	/// <summary>
+	/// Loads in a music track by providing a <paramref name="filepath"/>, an <see cref="AudioProperties"/> that contain the music track's properties, and an <paramref name="id"/> to associate it with<para/>
+	///
+	/// Only the header of the file is read, the music track's stream is opened on its first play (see <see cref="setMaxOpenTracks"/>).<br/>
+	/// Only music tracks with one channel (mono sounds) can be spatialized.<br/>
+	/// With loudness normalization, the music track is measured by a background thread unless the loudness cache knows it, its gain is applied once measured the next time it's played.
+	/// </summary>
+	/// <param name="filepath">The music track's filepath</param>
+	/// <param name="properties">The <see cref="AudioProperties"/> that contain the music track's properties</param>
+	/// <param name="id">An ID with which to associate the music track (i.e. an enum value)</param>
+	/// <code>
+	/// enum class MusicID { ID1, ID2, ID3 };
+	/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer;
+	/// musicPlayer.load("Assets/Music/Soundtrack.wav", ae::AudioProperties(100.f, 35.f, 1.f, 250.f), MusicID::ID1);
+	/// </code>
+	/// <seealso cref="unload"/>
+	/// <seealso cref="play"/>
+	template <typename T>
+	void MusicPlayer<T>::load(const std::string& filepath, const AudioProperties& properties, T id)
+	{
+		// The music track is constructed in place, its address stays the same until it's unloaded
+		auto inserted = tracks_.emplace(std::piecewise_construct, std::forward_as_tuple(id),
+			std::forward_as_tuple(AudioPlayer<T>::getBackend(), AudioPlayer<T>::getBus(), properties));
+		if (inserted.second) {
+			inserted.first->second.filepath = filepath;
+			setupTrack(inserted.first);
+		}
+#ifdef _DEBUG
+		else {
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::load - Attempt to load in music track that's already loaded in");
+		}
+#endif
+	}
+
+	/// <summary>
+	/// Loads in a music track held by a region of memory (i.e. a memory-mapped archive) by providing its <paramref name="data"/>, its <paramref name="size"/>, a <paramref name="name"/> and an <paramref name="id"/> to associate it with<para/>
+	///
+	/// The <see cref="AudioProperties"/> of the music track will be those by default.<para/>
+	///
+	/// The <paramref name="data"/> isn't copied, it's decoded in place and must remain alive until the music track is unloaded.<br/>
+	/// The reads of a memory-mapped region are served by the OS page cache, no temporary file is extracted.<br/>
+	/// The <paramref name="name"/> identifies the music track in the loudness cache and the debug messages.
+	/// </summary>
+	/// <param name="data">The first byte of the audio file</param>
+	/// <param name="size">The size of the audio file in bytes</param>
+	/// <param name="name">The music track's name (i.e. the path of its archive entry)</param>
+	/// <param name="id">An ID with which to associate the music track (i.e. an enum value)</param>
+	/// <code>
+	/// enum class MusicID { Theme };
+	/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer(backend);
+	/// musicPlayer.loadFromMemory(archive.getData() + entry.offset, entry.size, "Music/Theme.ogg", MusicID::Theme);
+	/// </code>
+	/// <seealso cref="loadFromStream"/>
+	/// <seealso cref="unload"/>
+	template <typename T>
+	void MusicPlayer<T>::loadFromMemory(const void* data, std::size_t size, const std::string& name, T id)
+	{
+		loadFromMemory(data, size, name, AudioProperties(), id);
+	}
+
+	/// <summary>
+	/// Loads in a music track held by a region of memory (i.e. a memory-mapped archive) by providing its <paramref name="data"/>, its <paramref name="size"/>, a <paramref name="name"/>, an <see cref="AudioProperties"/> that contain the music track's properties, and an <paramref name="id"/> to associate it with<para/>
+	///
+	/// The <paramref name="data"/> isn't copied, it's decoded in place and must remain alive until the music track is unloaded.<br/>
+	/// The reads of a memory-mapped region are served by the OS page cache, no temporary file is extracted.<br/>
+	/// The <paramref name="name"/> identifies the music track in the loudness cache and the debug messages.
+	/// </summary>
+	/// <param name="data">The first byte of the audio file</param>
+	/// <param name="size">The size of the audio file in bytes</param>
+	/// <param name="name">The music track's name (i.e. the path of its archive entry)</param>
+	/// <param name="properties">The <see cref="AudioProperties"/> that contain the music track's properties</param>
+	/// <param name="id">An ID with which to associate the music track (i.e. an enum value)</param>
+	/// <code>
+	/// enum class MusicID { Theme };
+	/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer(backend);
+	/// musicPlayer.loadFromMemory(archive.getData() + entry.offset, entry.size, "Music/Theme.ogg", ae::AudioProperties(80.f, 0.f, 1.f, 1.f), MusicID::Theme);
+	/// </code>
+	/// <seealso cref="loadFromStream"/>
+	/// <seealso cref="unload"/>
+	template <typename T>
+	void MusicPlayer<T>::loadFromMemory(const void* data, std::size_t size, const std::string& name, const AudioProperties& properties, T id)
+	{
+		auto inserted = tracks_.emplace(std::piecewise_construct, std::forward_as_tuple(id),
+			std::forward_as_tuple(AudioPlayer<T>::getBackend(), AudioPlayer<T>::getBus(), properties));
+		if (inserted.second) {
+			inserted.first->second.filepath = name;
+			inserted.first->second.data = data;
+			inserted.first->second.size = size;
+			setupTrack(inserted.first);
+		}
+#ifdef _DEBUG
+		else {
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::loadFromMemory - Attempt to load in music track that's already loaded in");
+		}
+#endif
+	}
+
+	/// <summary>
+	/// Loads in a music track read by custom streams (i.e. over an archive entry) by providing the function opening them, a <paramref name="name"/> and an <paramref name="id"/> to associate it with<para/>
+	///
+	/// The <see cref="AudioProperties"/> of the music track will be those by default.<para/>
+	///
+	/// A new stream is opened each time the music track is read: once when it's loaded in (header and loudness) and each time its stream is opened.<br/>
+	/// Each stream is only read by a single thread, the function may be called from the game thread as long as the music track is loaded in.<br/>
+	/// The <paramref name="name"/> identifies the music track in the loudness cache and the debug messages.
+	/// </summary>
+	/// <param name="openStream">The function opening a new stream at the start of the audio file (nullptr if it can't be opened)</param>
+	/// <param name="name">The music track's name (i.e. the path of its archive entry)</param>
+	/// <param name="id">An ID with which to associate the music track (i.e. an enum value)</param>
+	/// <code>
+	/// enum class MusicID { Theme };
+	/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer(backend);
+	/// musicPlayer.loadFromStream([&amp;archive]() { return archive.openEntry("Music/Theme.ogg"); }, "Music/Theme.ogg", MusicID::Theme);
+	/// </code>
+	/// <seealso cref="loadFromMemory"/>
+	/// <seealso cref="unload"/>
+	template <typename T>
+	void MusicPlayer<T>::loadFromStream(const StreamOpener& openStream, const std::string& name, T id)
+	{
+		loadFromStream(openStream, name, AudioProperties(), id);
+	}
+
+	/// <summary>
+	/// Loads in a music track read by custom streams (i.e. over an archive entry) by providing the function opening them, a <paramref name="name"/>, an <see cref="AudioProperties"/> that contain the music track's properties, and an <paramref name="id"/> to associate it with<para/>
+	///
+	/// A new stream is opened each time the music track is read: once when it's loaded in (header and loudness) and each time its stream is opened.<br/>
+	/// Each stream is only read by a single thread, the function may be called from the game thread as long as the music track is loaded in.<br/>
+	/// The <paramref name="name"/> identifies the music track in the loudness cache and the debug messages.
+	/// </summary>
+	/// <param name="openStream">The function opening a new stream at the start of the audio file (nullptr if it can't be opened)</param>
+	/// <param name="name">The music track's name (i.e. the path of its archive entry)</param>
+	/// <param name="properties">The <see cref="AudioProperties"/> that contain the music track's properties</param>
+	/// <param name="id">An ID with which to associate the music track (i.e. an enum value)</param>
+	/// <code>
+	/// enum class MusicID { Theme };
+	/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer(backend);
+	/// musicPlayer.loadFromStream([&amp;archive]() { return archive.openEntry("Music/Theme.ogg"); }, "Music/Theme.ogg", ae::AudioProperties(80.f, 0.f, 1.f, 1.f), MusicID::Theme);
+	/// </code>
+	/// <seealso cref="loadFromMemory"/>
+	/// <seealso cref="unload"/>
+	template <typename T>
+	void MusicPlayer<T>::loadFromStream(const StreamOpener& openStream, const std::string& name, const AudioProperties& properties, T id)
+	{
+		auto inserted = tracks_.emplace(std::piecewise_construct, std::forward_as_tuple(id),
+			std::forward_as_tuple(AudioPlayer<T>::getBackend(), AudioPlayer<T>::getBus(), properties));
+		if (inserted.second) {
+			inserted.first->second.filepath = name;
+			inserted.first->second.openStream = openStream;
+			setupTrack(inserted.first);
+		}
+#ifdef _DEBUG
+		else {
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::loadFromStream - Attempt to load in music track that's already loaded in");
+		}
+#endif
+	}
+
+	/// <summary>
+	/// Loads in a layered music track by providing the <paramref name="filepaths"/> of its stems and an <paramref name="id"/> to associate it with<para/>
+	///
+	/// The <see cref="AudioProperties"/> of the music track will be those by default.<para/>
+	///
+	/// The stems (i.e. drums, bass and strings) are decoded in lockstep and mixed into a single stream, so they stay sample-locked while their layers are faded in and out.<br/>
+	/// The stems must have the same amount of channels and the same sample rate, the layers start at full gain and the music track's loudness is measured with all of them at full gain.<br/>
+	/// Only backends mixing in software (i.e. a <see cref="SoftwareAudioBackend"/>) play layered music tracks, the music track isn't loaded in on the others.
+	/// </summary>
+	/// <param name="filepaths">The stems' filepaths, one per layer</param>
+	/// <param name="id">An ID with which to associate the music track (i.e. an enum value)</param>
+	/// <code>
+	/// enum class MusicID { Combat };
+	/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer(backend);
+	/// musicPlayer.loadLayers({ "Assets/Music/CombatDrums.ogg", "Assets/Music/CombatBass.ogg", "Assets/Music/CombatStrings.ogg" }, MusicID::Combat);
+	/// </code>
+	/// <seealso cref="setLayerGain"/>
+	/// <seealso cref="unload"/>
+	template <typename T>
+	void MusicPlayer<T>::loadLayers(const std::vector<std::string>& filepaths, T id)
+	{
+		loadLayers(filepaths, AudioProperties(), id);
+	}
+
+	/// <summary>
+	/// Loads in a layered music track by providing the <paramref name="filepaths"/> of its stems, an <see cref="AudioProperties"/> that contain the music track's properties, and an <paramref name="id"/> to associate it with<para/>
+	///
+	/// The stems (i.e. drums, bass and strings) are decoded in lockstep and mixed into a single stream, so they stay sample-locked while their layers are faded in and out.<br/>
+	/// The stems must have the same amount of channels and the same sample rate, the layers start at full gain and the music track's loudness is measured with all of them at full gain.<br/>
+	/// Only backends mixing in software (i.e. a <see cref="SoftwareAudioBackend"/>) play layered music tracks, the music track isn't loaded in on the others.
+	/// </summary>
+	/// <param name="filepaths">The stems' filepaths, one per layer</param>
+	/// <param name="properties">The <see cref="AudioProperties"/> that contain the music track's properties</param>
+	/// <param name="id">An ID with which to associate the music track (i.e. an enum value)</param>
+	/// <code>
+	/// enum class MusicID { Combat };
+	/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer(backend);
+	/// musicPlayer.loadLayers({ "Assets/Music/CombatDrums.ogg", "Assets/Music/CombatBass.ogg" }, ae::AudioProperties(80.f, 0.f, 1.f, 1.f), MusicID::Combat);
+	/// </code>
+	/// <seealso cref="setLayerGain"/>
+	/// <seealso cref="unload"/>
+	template <typename T>
+	void MusicPlayer<T>::loadLayers(const std::vector<std::string>& filepaths, const AudioProperties& properties, T id)
+	{
+		auto inserted = tracks_.emplace(std::piecewise_construct, std::forward_as_tuple(id),
+			std::forward_as_tuple(AudioPlayer<T>::getBackend(), AudioPlayer<T>::getBus(), properties));
+		if (inserted.second)
+			setupLayers(inserted.first, filepaths);
+#ifdef _DEBUG
+		else {
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::loadLayers - Attempt to load in music track that's already loaded in");
+		}
+#endif
+	}
+
+	/// <summary>
+	/// Ramps the gain (0 - 1) of a <paramref name="layer"/> of a layered music track to the <paramref name="gain"/> provided over a <paramref name="rampTime"/><para/>
+	///
+	/// The ramp is applied by the audio backend as the stems are mixed down, no call is needed on the game thread while it lasts.<br/>
+	/// The gains are kept while the music track is stopped and its stream closed.
+	/// </summary>
+	/// <param name="id">The id associated with the layered music track</param>
+	/// <param name="layer">The index of the layer (the index of its stem in the filepaths provided)</param>
+	/// <param name="gain">The gain reached at the end of the ramp</param>
+	/// <param name="rampTime">The duration of the ramp (zero to apply the <paramref name="gain"/> straight away)</param>
+	/// <code>
+	/// // The strings fade in as the battle's intensity rises
+	/// musicPlayer.setLayerGain(MusicID::Combat, 2, intensity, sf::seconds(1.5f));
+	/// </code>
+	/// <seealso cref="loadLayers"/>
+	template <typename T>
+	void MusicPlayer<T>::setLayerGain(T id, std::size_t layer, float gain, sf::Time rampTime)
+	{
+#ifdef _DEBUG
+		auto found = tracks_.find(id);
+		if (found == tracks_.end()) {
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::setLayerGain - Unable to find music track");
+			return;
+		}
+		if (layer >= found->second.layerGains.size()) {
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::setLayerGain - The music track has no such layer");
+			return;
+		}
+		MusicTrack& track = found->second;
+#else
+		MusicTrack& track = tracks_.find(id)->second;
+#endif
+		track.layerGains[layer] = gain;
+		track.backend.setLayerGain(track.source, layer, gain, rampTime);
+	}
+
+	/// <summary>
+	/// Unloads a loaded-in music track by providing the associated <paramref name="id"/><para/>
+	///
+	/// The music track associated with this <paramref name="id"/> will be removed (even if it's currently playing).
+	/// </summary>
+	/// <param name="id">The ID associated with the music track to unload</param>
+	/// <code>
+	/// enum class MusicID { ID1, ID2, ID3 };
+	/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer;
+	/// ...
+	/// musicPlayer.unload(MusicID::ID1);
+	/// </code>
+	/// <seealso cref="load"/>
+	template <typename T>
+	void MusicPlayer<T>::unload(T id)
+	{
+		// The music track is removed from the playlist before its stream is destroyed
+		auto queued = std::find(playlist_.begin(), playlist_.end(), id);
+		if (queued == playlist_.begin() && queued != playlist_.end())
+			endPlaylist();
+		else if (queued != playlist_.end()) {
+			if (playlistChained_)
+				AudioPlayer<T>::getBackend().chain(tracks_.find(playlist_.front())->second.source, 0);
+			playlistChained_ = false;
+			playlist_.erase(std::remove(playlist_.begin(), playlist_.end(), id), playlist_.end());
+			chainNext();
+		}
+
+#ifdef _DEBUG
+		auto found = tracks_.find(id);
+		if (found == tracks_.end()) {
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::unload - The ID provided isn't associated with any music track");
+			return;
+		}
+		openTracks_.remove(&found->second);
+		tracks_.erase(found);
+#else
+		auto found = tracks_.find(id);
+		openTracks_.remove(&found->second);
+		tracks_.erase(found);
+#endif
+	}
+
+	/// <summary>Sets up the newly emplaced music <paramref name="track"/> by reading the header of its audio file, it's removed if the file can't be opened</summary>
+	/// <param name="track">The iterator to the new music track, whose filepath, memory or stream function has been set</param>
+	template <typename T>
+	void MusicPlayer<T>::setupTrack(typename std::map<T, MusicTrack>::iterator track)
+	{
+		// The file is opened once, to read its header and then to measure its loudness, the stream is opened on the first play
+		auto file = std::make_shared<FileSampleSource>();
+		if (openFile(track->second, *file)) {
+			track->second.duration = sf::microseconds(static_cast<sf::Int64>(file->getFrameCount() * 1000000 / file->getSampleRate()));
+			measureLoudness(track->second, std::move(file));
+		}
+		else {
+#ifdef _DEBUG
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::setupTrack - Failed to open \"" + track->second.filepath + '"');
+#endif
+			tracks_.erase(track);
+		}
+	}
+
+	/// <summary>Opens the audio file of a music <paramref name="track"/> from the disk, its memory or a new stream</summary>
+	/// <param name="track">The music track</param>
+	/// <param name="file">The sample source opening the audio file</param>
+	/// <returns>True if the file could be opened, false otherwise</returns>
+	template <typename T>
+	bool MusicPlayer<T>::openFile(const MusicTrack& track, FileSampleSource& file) const
+	{
+		if (track.openStream)
+			return file.openFromStream(track.openStream());
+		if (track.data)
+			return file.openFromMemory(track.data, track.size);
+		return file.openFromFile(track.filepath);
+	}
+
+	/// <summary>Sets up the newly emplaced layered music <paramref name="track"/> by opening its stems to check them, it's removed if the audio backend doesn't support layered streams or if they can't be opened or don't match</summary>
+	/// <param name="track">The iterator to the new music track</param>
+	/// <param name="filepaths">The stems' filepaths</param>
+	template <typename T>
+	void MusicPlayer<T>::setupLayers(typename std::map<T, MusicTrack>::iterator track, const std::vector<std::string>& filepaths)
+	{
+		// A backend that can't mix the stems would never play the music track
+		if (!track->second.backend.supportsLayeredStreams()) {
+#ifdef _DEBUG
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::setupLayers - The audio backend doesn't support layered streams");
+#endif
+			tracks_.erase(track);
+			return;
+		}
+
+		// The stems are opened together once, to check that they can be mixed, to read their duration and then to measure their mix's loudness
+		auto stems = std::make_unique<StemSampleSource>();
+		if (stems->openFromFiles(filepaths)) {
+			track->second.filepath = filepaths.front();
+			track->second.layers = filepaths;
+			track->second.layerGains.assign(filepaths.size(), 1.f);
+			track->second.duration = sf::microseconds(static_cast<sf::Int64>(stems->getFrameCount() * 1000000 / stems->getSampleRate()));
+			measureLoudness(track->second, std::make_shared<LayeredSampleSource>(std::move(stems), filepaths.size()));
+		}
+		else {
+#ifdef _DEBUG
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::setupLayers - Failed to open the stems or they don't match");
+#endif
+			tracks_.erase(track);
+		}
+	}
+
+	/// <summary>Starts playing a music <paramref name="track"/>, fading it in over a <paramref name="duration"/></summary>
+	/// <param name="track">The music track to play</param>
+	/// <param name="position">The position of the music track's source</param>
+	/// <param name="loop">True to put the music track on loop, false otherwise</param>
+	/// <param name="duration">The duration of the fade-in (zero to play it at full volume straight away)</param>
+	/// <param name="clockTime">The time of the audio clock at which the music track starts (zero to start it straight away)</param>
+	template <typename T>
+	void MusicPlayer<T>::startTrack(MusicTrack& track, const sf::Vector2f& position, bool loop, sf::Time duration, sf::Time clockTime)
+	{
+		if (!openTrack(track)) {
+			++AudioPlayer<T>::getStatsCounters().droppedPlays;
+			return;
+		}
+
+		AudioBackend& backend = AudioPlayer<T>::getBackend();
+		++AudioPlayer<T>::getStatsCounters().plays;
+
+		track.seeked = false;
+		prepareTrack(track, position, loop, duration);
+		if (clockTime > sf::Time::Zero)
+			backend.playAt(track.source, clockTime);
+		else
+			backend.play(track.source);
+		anchorTrack(track, (clockTime > sf::Time::Zero) ? clockTime : backend.getAudioClock(), backend.getPlayingOffset(track.source), true);
+	}
+
+	/// <summary>Opens the stream of a music <paramref name="track"/> unless it's already open, closing the least recently played ones beyond the maximum</summary>
+	/// <param name="track">The music track</param>
+	/// <returns>True if the music track's stream is open, false if its file couldn't be opened</returns>
+	template <typename T>
+	bool MusicPlayer<T>::openTrack(MusicTrack& track)
+	{
+		if (track.source) {
+			openTracks_.splice(openTracks_.begin(), openTracks_, std::find(openTracks_.begin(), openTracks_.end(), &track));
+			return true;
+		}
+
+		// Make room for the new stream before opening it so that the maximum isn't exceeded, even briefly
+		closeIdleTracks(maxOpenTracks_ - 1);
+		if (!track.layers.empty())
+			track.source = track.backend.createLayeredStream(track.layers);
+		else if (track.openStream)
+			track.source = track.backend.createStream(track.openStream());
+		else if (track.data)
+			track.source = track.backend.createStream(track.data, track.size);
+		else
+			track.source = track.backend.createStream(track.filepath);
+		if (!track.source) {
+#ifdef _DEBUG
+			DebugLogger::cacheMessage("ae::MusicPlayer<T>::openTrack - Failed to open \"" + track.filepath + '"');
+#endif
+			return false;
+		}
+
+		// The properties, the effects and the volume are applied again to the new stream
+		applyLoudness(track);
+		track.backend.setProperties(track.source, track.PROPERTIES);
+		for (std::size_t layer = 0; layer < track.layerGains.size(); ++layer)
+			if (track.layerGains[layer] != 1.f)
+				track.backend.setLayerGain(track.source, layer, track.layerGains[layer], sf::Time::Zero);
+		if (track.effects)
+			track.backend.setSourceEffects(track.source, track.effects);
+		applyBuffering(track);
+		if (!track.cues.empty())
+			applyCues(track);
+		track.bus->attach(track.backend, track.source, track.VOLUME * track.gain);
+		track.underruns = 0;
+		openTracks_.push_front(&track);
+		return true;
+	}
+
+	/// <summary>Closes the streams of the least recently played music tracks that are stopped until at most <paramref name="count"/> remain open</summary>
+	/// <param name="count">The amount of open music tracks to keep</param>
+	template <typename T>
+	void MusicPlayer<T>::closeIdleTracks(std::size_t count)
+	{
+		// The music tracks playing, paused, seeked ahead of play or about to be chained in the playlist are kept open
+		AudioBackend& backend = AudioPlayer<T>::getBackend();
+		const MusicTrack* current = (playlist_.size() > 0) ? &tracks_.find(playlist_[0])->second : nullptr;
+		const MusicTrack* next = (playlist_.size() > 1) ? &tracks_.find(playlist_[1])->second : nullptr;
+		for (auto itr = openTracks_.end(); openTracks_.size() > count && itr != openTracks_.begin();) {
+			MusicTrack& track = **(--itr);
+			if (&track == current || &track == next || track.seeked || backend.getStatus(track.source) != sf::SoundSource::Status::Stopped)
+				continue;
+
+			track.bus->detach(track.backend, track.source);
+			track.backend.destroySource(track.source);
+			track.source = 0;
+			itr = openTracks_.erase(itr);
+		}
+	}
+
+	/// <summary>Applies the buffering of a music <paramref name="track"/>, or the music player's, to its open stream</summary>
+	/// <param name="track">The music track</param>
+	template <typename T>
+	void MusicPlayer<T>::applyBuffering(MusicTrack& track)
+	{
+		const bool OWN = track.bufferTime > sf::Time::Zero;
+		const sf::Time BUFFER_TIME = OWN ? track.bufferTime : bufferTime_;
+		if (BUFFER_TIME > sf::Time::Zero)
+			track.backend.setStreamBuffering(track.source, BUFFER_TIME, OWN ? track.chunkTime : chunkTime_);
+	}
+
+	/// <summary>Applies the loudness gain, the fade-in, the <paramref name="position"/> and the <paramref name="loop"/> of a music <paramref name="track"/> about to play</summary>
+	/// <param name="track">The music track</param>
+	/// <param name="position">The position of the music track's source</param>
+	/// <param name="loop">True to put the music track on loop, false otherwise</param>
+	/// <param name="duration">The duration of the fade-in (zero to play it at full volume straight away)</param>
+	template <typename T>
+	void MusicPlayer<T>::prepareTrack(MusicTrack& track, const sf::Vector2f& position, bool loop, sf::Time duration)
+	{
+		AudioBackend& backend = AudioPlayer<T>::getBackend();
+		applyLoudness(track);
+
+		// A music track that isn't playing fades in from silence, a playing one from its current fade gain
+		if (duration > sf::Time::Zero && backend.getStatus(track.source) != sf::SoundSource::Status::Playing)
+			backend.fade(track.source, 0.f, sf::Time::Zero, false);
+		backend.fade(track.source, 1.f, duration, false);
+
+		backend.setPosition(track.source, sf::Vector3f(position.x, -position.y, 0.f));
+		backend.setLoop(track.source, loop);
+		track.loop = loop;
+	}
+
+	/// <summary>Lays the beats and the markers of a music <paramref name="track"/> out as cues, and sets them on its stream if it's open</summary>
+	/// <param name="track">The music track</param>
+	template <typename T>
+	void MusicPlayer<T>::layCues(MusicTrack& track)
+	{
+		track.cues.clear();
+		if (track.tempo > 0.f) {
+			const double PERIOD = 60000000.0 / track.tempo;
+			for (std::size_t beat = 0;; ++beat) {
+				const sf::Time POSITION = track.firstBeat + sf::microseconds(static_cast<sf::Int64>(beat * PERIOD));
+				if (POSITION >= track.duration)
+					break;
+				track.cues.push_back(Cue{ POSITION, MusicEvent::Type::Beat, beat });
+			}
+		}
+		for (std::size_t marker = 0; marker < track.markers.size(); ++marker)
+			if (track.markers[marker] >= sf::Time::Zero && track.markers[marker] < track.duration)
+				track.cues.push_back(Cue{ track.markers[marker], MusicEvent::Type::Marker, marker });
+
+		// The backend reports the cues by their index in the sorted positions
+		std::stable_sort(track.cues.begin(), track.cues.end(), [](const Cue& c1, const Cue& c2) {
+			return c1.position < c2.position;
+		});
+		if (track.source)
+			applyCues(track);
+	}
+
+	/// <summary>Sets the cues of a music <paramref name="track"/> as the markers of its open stream</summary>
+	/// <param name="track">The music track</param>
+	template <typename T>
+	void MusicPlayer<T>::applyCues(MusicTrack& track)
+	{
+		std::vector<sf::Time> positions;
+		positions.reserve(track.cues.size());
+		for (const auto& cue : track.cues)
+			positions.push_back(cue.position);
+		track.backend.setMarkers(track.source, positions);
+	}
+
+	/// <summary>Anchors the music clock of a music <paramref name="track"/>, it advances from the <paramref name="offset"/> with the audio clock while it's playing</summary>
+	/// <param name="track">The music track</param>
+	/// <param name="clockTime">The time of the audio clock at which the music track is at the <paramref name="offset"/></param>
+	/// <param name="offset">The playing position of the music track</param>
+	/// <param name="playing">True if the music track is playing, false to freeze its music clock</param>
+	template <typename T>
+	void MusicPlayer<T>::anchorTrack(MusicTrack& track, sf::Time clockTime, sf::Time offset, bool playing)
+	{
+		track.anchorClock = clockTime;
+		track.anchorOffset = offset;
+		track.anchorSpeed = playing ? track.PROPERTIES.getPitch() : 0.f;
+	}
+
+	/// <summary>Extrapolates the music clock of a music <paramref name="track"/> from the audio clock read by the last update</summary>
+	/// <param name="track">The music track</param>
+	/// <returns>The playing position of the music track</returns>
+	template <typename T>
+	sf::Time MusicPlayer<T>::computeClock(const MusicTrack& track) const
+	{
+		// A music track scheduled to start later stays at its anchor until the audio clock reaches it
+		if (track.anchorSpeed <= 0.f || audioClock_ <= track.anchorClock)
+			return track.anchorOffset;
+
+		const sf::Time POSITION = track.anchorOffset + (audioClock_ - track.anchorClock) * track.anchorSpeed;
+		if (track.duration <= sf::Time::Zero)
+			return POSITION;
+		return track.loop ? POSITION % track.duration : std::min(POSITION, track.duration);
+	}
+
+	/// <summary>Drains the beats and markers played from the audio backend, re-anchors the music clocks on them and reports them to the event callback</summary>
+	template <typename T>
+	void MusicPlayer<T>::dispatchEvents()
+	{
+		AudioBackend& backend = AudioPlayer<T>::getBackend();
+		AudioBackend::SourceID source = 0;
+		std::size_t index = 0;
+		sf::Time clockTime;
+		while (backend.pollMarker(source, index, clockTime)) {
+			auto found = std::find_if(tracks_.begin(), tracks_.end(), [source](const std::pair<const T, MusicTrack>& track) {
+				return track.second.source == source;
+			});
+			if (found == tracks_.end() || index >= found->second.cues.size())
+				continue;
+
+			// The cue was mixed on an exact frame, the music clock is anchored on it unless the music track was paused or positioned since
+			MusicTrack& track = found->second;
+			const Cue CUE = track.cues[index];
+			if (track.anchorSpeed > 0.f && clockTime >= track.anchorClock) {
+				track.anchorClock = clockTime;
+				track.anchorOffset = CUE.position;
+			}
+
+			if (eventCallback_) {
+				const bool BEAT = CUE.type == MusicEvent::Type::Beat;
+				eventCallback_(MusicEvent{ found->first, CUE.type, CUE.index, BEAT ? CUE.index / track.beatsPerBar : 0, BEAT ? static_cast<unsigned int>(CUE.index % track.beatsPerBar) : 0u, CUE.position, clockTime });
+			}
+		}
+	}
+
+	/// <summary>Chains the second music track of the playlist to the first one on the audio backend, unless it's already chained or it's the same music track</summary>
+	template <typename T>
+	void MusicPlayer<T>::chainNext()
+	{
+		if (playlist_.size() < 2 || playlistChained_ || playlist_[0] == playlist_[1])
+			return;
+
+		// The next music track is rewound so that it starts from its first frames, already decoded
+		AudioBackend& backend = AudioPlayer<T>::getBackend();
+		MusicTrack& current = tracks_.find(playlist_[0])->second;
+		MusicTrack& next = tracks_.find(playlist_[1])->second;
+		if (!openTrack(next))
+			return;
+		backend.stop(next.source);
+		prepareTrack(next, AudioPlayer<T>::getListenerPosition(), false, sf::Time::Zero);
+		playlistChained_ = backend.chain(current.source, next.source);
+	}
+
+	/// <summary>Ends the playlist, the music track playing keeps playing until its end without any music track chained to it</summary>
+	template <typename T>
+	void MusicPlayer<T>::endPlaylist()
+	{
+		if (playlistChained_)
+			AudioPlayer<T>::getBackend().chain(tracks_.find(playlist_.front())->second.source, 0);
+		playlist_.clear();
+		playlistChained_ = false;
+	}
+
+	/// <summary>Starts measuring the loudness of the new music <paramref name="track"/> on a background thread with its <paramref name="source"/> already opened, or applies it straight away if the loudness cache knows it</summary>
+	/// <param name="track">The music track</param>
+	/// <param name="source">The music track's file, or its stems mixed down, opened when it was loaded in</param>
+	template <typename T>
+	void MusicPlayer<T>::measureLoudness(MusicTrack& track, std::shared_ptr<SampleSource> source)
+	{
+		if (AudioPlayer<T>::getLoudnessTarget() == 0.f)
+			return;
+
+		LoudnessCache* cache = AudioPlayer<T>::getLoudnessCache();
+		float loudness = 0.f;
+		if (cache && cache->find(getLoudnessKey(track), loudness)) {
+			track.gain = AudioPlayer<T>::computeLoudnessGain(loudness);
+			return;
+		}
+
+		// Scan the whole file with the decoder opened at load time, in chunks so that the measurement can be stopped
+		auto cancel = std::make_shared<std::atomic<bool>>(false);
+		track.cancel = cancel;
+		track.loudness = std::async(std::launch::async, [source, cancel]() {
+			const std::size_t CHUNK_FRAMES = 8192;
+
+			LoudnessMeter meter(source->getChannelCount(), source->getSampleRate());
+			std::vector<sf::Int16> samples(CHUNK_FRAMES * source->getChannelCount());
+			std::size_t read = 0;
+			while (!cancel->load(std::memory_order_relaxed) && (read = source->read(samples.data(), CHUNK_FRAMES)) > 0)
+				meter.process(samples.data(), read);
+			return meter.getIntegratedLoudness();
+		});
+	}
+
+	/// <summary>Folds the loudness measured by the background thread into the volume of the music <paramref name="track"/> once it's available</summary>
+	/// <param name="track">The music track</param>
+	template <typename T>
+	void MusicPlayer<T>::applyLoudness(MusicTrack& track)
+	{
+		if (!track.loudness.valid() || track.loudness.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+			return;
+
+		const float LOUDNESS = track.loudness.get();
+		track.cancel = nullptr;
+		if (AudioPlayer<T>::getLoudnessCache())
+			AudioPlayer<T>::getLoudnessCache()->store(getLoudnessKey(track), LOUDNESS);
+
+		track.gain = AudioPlayer<T>::computeLoudnessGain(LOUDNESS);
+		track.bus->setSourceVolume(track.backend, track.source, track.VOLUME * track.gain);
+	}
+
+	/// <summary>Retrieves the key of a music <paramref name="track"/> in the loudness cache</summary>
+	/// <param name="track">The music track</param>
+	/// <returns>The music track's filepath, followed by the filepaths of its other stems if it's layered</returns>
+	template <typename T>
+	std::string MusicPlayer<T>::getLoudnessKey(const MusicTrack& track) const
+	{
+		// A layered music track is measured as a whole, its entry mustn't be taken for the one of its first stem alone
+		std::string key = track.filepath;
+		for (std::size_t i = 1; i < track.layers.size(); ++i)
+			key += '|' + track.layers[i];
+		return key;
+	}
+
+	/// <summary>Fills in the voice counts and the state of the streams of the music tracks playing, and accumulates their underruns</summary>
+	/// <param name="stats">The music player's statistics</param>
+	template <typename T>
+	void MusicPlayer<T>::collectStats(AudioStats& stats)
+	{
+		const AudioBackend& backend = AudioPlayer<T>::getBackend();
+		stats.activeVoices = 0;
+		stats.streams = 0;
+		stats.minStreamFill = 1.f;
+		for (auto& pair : tracks_) {
+			MusicTrack& track = pair.second;
+			if (backend.getStatus(track.source) == sf::SoundSource::Status::Stopped)
+				continue;
+
+			// Every music track playing owns a stream of the audio backend
+			++stats.activeVoices;
+			++stats.streams;
+			float fill = 1.f;
+			std::size_t underruns = 0;
+			if (backend.getStreamState(track.source, fill, underruns)) {
+				stats.minStreamFill = std::min(stats.minStreamFill, fill);
+				stats.underruns += underruns - std::min(track.underruns, underruns);
+				track.underruns = underruns;
+			}
+		}
+		stats.realVoices = stats.activeVoices;
+	}
+
+	/// <summary>Constructs the <see cref="MusicTrack"/> by providing the audio <paramref name="backend"/>, its <paramref name="bus"/> and its <paramref name="properties"/></summary>
+	/// <param name="backend">The audio backend that will stream the music track</param>
+	/// <param name="bus">The bus of the music track</param>
+	/// <param name="properties">The properties of the music track</param>
+	template <typename T>
+	MusicPlayer<T>::MusicTrack::MusicTrack(AudioBackend& backend, AudioBus& bus, const AudioProperties& properties)
+		: backend(backend)
+		, bus(&bus)
+		, source(0)
+		, PROPERTIES(properties)
+		, VOLUME(properties.getVolume())
+		, effects(nullptr)
+		, duration(sf::Time::Zero)
+		, gain(1.f)
+		, underruns(0)
+		, bufferTime(sf::Time::Zero)
+		, chunkTime(sf::Time::Zero)
+		, filepath()
+		, data(nullptr)
+		, size(0)
+		, openStream()
+		, layers()
+		, layerGains()
+		, tempo(0.f)
+		, beatsPerBar(4)
+		, firstBeat(sf::Time::Zero)
+		, markers()
+		, cues()
+		, loop(false)
+		, seeked(false)
+		, anchorClock(sf::Time::Zero)
+		, anchorOffset(sf::Time::Zero)
+		, anchorSpeed(0.f)
+		, loudness()
+		, cancel(nullptr)
+	{
+	}
+
+	/// <summary>Stops the background measurement, detaches the music track's stream from its bus and destroys it</summary>
+	template <typename T>
+	MusicPlayer<T>::MusicTrack::~MusicTrack()
+	{
+		// The future waits for the background thread, which stops at its next chunk
+		if (cancel)
+			cancel->store(true, std::memory_order_relaxed);
+
+		if (source) {
+			bus->detach(backend, source);
+			backend.destroySource(source);
+		}
 	}
 }
\ No newline at end of file
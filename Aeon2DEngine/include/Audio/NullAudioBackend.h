@@ -0,0 +1,107 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#ifndef Aeon2D_Audio_NullAudioBackend_H_
+#define Aeon2D_Audio_NullAudioBackend_H_
+
+#include <vector>
+#include <memory>
+#include <string>
+
+#include <SFML/Audio/OutputSoundFile.hpp>
+
+#include "SoftwareAudioBackend.h"
+
+namespace ae
+{
+	/// <summary>
+	/// Audio backend that doesn't need an audio device, the sources are mixed offline into memory<para/>
+	///
+	/// Time only advances when <see cref="render"/> is called, as fast as the mixing allows.<br/>
+	/// The sources reach their end and stop exactly like they would when played, which makes the audio players deterministic to test and to profile.<br/>
+	/// The renders can be written to an audio file, to capture a scripted sequence of calls to the audio players (trailers, regression tests, audio QA).
+	/// </summary>
+	/// <code>
+	/// ae::NullAudioBackend backend;
+	/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer(backend);
+	/// soundPlayer.load("Assets/Sounds/KnightAttack.wav", SoundID::ID1);
+	/// soundPlayer.play(SoundID::ID1);
+	/// const std::vector&lt;float&gt;&amp; output = backend.render(sf::seconds(1.f));
+	/// </code>
+	class NullAudioBackend : public SoftwareAudioBackend
+	{
+	public:
+		/// <summary>Constructs the <see cref="NullAudioBackend"/> by providing the sample rate of its output and the size of its blocks</summary>
+		/// <param name="sampleRate">The amount of frames per second mixed</param>
+		/// <param name="blockFrames">The amount of frames mixed at once (the granularity of the gain ramps, like in a <see cref="MixerStream"/>)</param>
+		explicit NullAudioBackend(unsigned int sampleRate = 44100, std::size_t blockFrames = 512);
+	public:
+		/// <summary>Mixes the sources for the <paramref name="duration"/> provided</summary>
+		/// <param name="duration">The amount of time to mix</param>
+		/// <returns>The interleaved stereo frames mixed (in the range [-1, 1] unless they clip)</returns>
+		/// <seealso cref="getRenderedTime"/>
+		const std::vector<float>& render(sf::Time duration);
+		/// <summary>Retrieves the total amount of time mixed since the construction</summary>
+		/// <returns>The total amount of time mixed</returns>
+		/// <seealso cref="render"/>
+		sf::Time getRenderedTime() const;
+		/// <summary>
+		/// Retrieves the speed of the rendering, the seconds of audio mixed per second spent in <see cref="render"/><para/>
+		///
+		/// The decoding of the streams is included as they're decoded on demand, but not the time spent in the audio players between the renders.
+		/// </summary>
+		/// <returns>The ratio of the time mixed over the time spent mixing (0 if nothing was mixed yet)</returns>
+		/// <seealso cref="getRenderedTime"/>
+		float getRenderSpeed() const;
+		/// <summary>
+		/// Opens an audio file in which the following renders are written as 16-bit stereo frames<para/>
+		///
+		/// An output file already open is closed first.
+		/// </summary>
+		/// <param name="filepath">The path of the audio file to write, its extension determines the format (wav, ogg or flac)</param>
+		/// <returns>True if the audio file could be opened, false otherwise</returns>
+		/// <code>
+		/// ae::NullAudioBackend backend;
+		/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer(backend);
+		/// musicPlayer.load("Assets/Music/Trailer.ogg", MusicID::ID1);
+		/// backend.openOutputFile("Trailer.wav");
+		/// musicPlayer.play(MusicID::ID1, false);
+		/// while (backend.getRenderedTime() &lt; sf::seconds(60.f)) {
+		///		musicPlayer.update();
+		///		backend.render(sf::milliseconds(16));
+		/// }
+		/// backend.closeOutputFile();
+		/// </code>
+		/// <seealso cref="closeOutputFile"/>
+		bool openOutputFile(const std::string& filepath);
+		/// <summary>Closes the audio file opened by <see cref="openOutputFile"/>, the following renders are only kept in memory</summary>
+		/// <seealso cref="openOutputFile"/>
+		void closeOutputFile();
+
+	private:
+		const std::size_t                    BLOCK_FRAMES;    ///< The amount of frames mixed at once
+		std::vector<float>                   output_;         ///< The frames mixed by the last render
+		sf::Uint64                           renderedFrames_; ///< The total amount of frames mixed
+		sf::Time                             renderingTime_;  ///< The total amount of time spent mixing
+		std::unique_ptr<sf::OutputSoundFile> outputFile_;     ///< The audio file in which the renders are written (nullptr if none)
+		std::vector<sf::Int16>               outputSamples_;  ///< The frames of the last render converted for the audio file
+	};
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,125 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#ifndef Aeon2D_Audio_OcclusionMap_H_
+#define Aeon2D_Audio_OcclusionMap_H_
+
+#include <vector>
+
+#include <SFML/Config.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <SFML/System/Time.hpp>
+
+namespace ae
+{
+	/// <summary>
+	/// Class that keeps the level's walls in a uniform grid to find how much sound goes through them between the listener and the emitters<para/>
+	///
+	/// Each wall is a 2D segment letting through a fraction of the sound (its transmission), the transmissions of every wall crossed are multiplied together.<br/>
+	/// A query walks the grid's cells along the ray (DDA) and tests the walls of each cell four at a time with SSE, each wall being counted once per query.<br/>
+	/// The grid is rebuilt by the first query following a change of the walls.
+	/// </summary>
+	/// <code>
+	/// ae::OcclusionMap occlusion(128.f);
+	/// for (const Wall&amp; wall : level.getWalls())
+	///		occlusion.addWall(wall.start, wall.end, 0.25f);
+	/// soundPlayer.setOcclusionMap(&amp;occlusion);
+	/// </code>
+	class OcclusionMap
+	{
+	public:
+		/// <summary>Constructs the <see cref="OcclusionMap"/> by providing the size of the grid's cells</summary>
+		/// <param name="cellSize">The width and height of a cell (in the level's units), increased if the grid would have more than a million cells</param>
+		explicit OcclusionMap(float cellSize = 128.f);
+	public:
+		/// <summary>Adds a wall going from <paramref name="start"/> to <paramref name="end"/></summary>
+		/// <param name="start">The first end of the wall's segment</param>
+		/// <param name="end">The second end of the wall's segment</param>
+		/// <param name="transmission">The fraction of the sound going through the wall (0 - 1)</param>
+		/// <returns>The index of the wall</returns>
+		/// <seealso cref="setWallTransmission"/>
+		std::size_t addWall(const sf::Vector2f& start, const sf::Vector2f& end, float transmission = 0.3f);
+		/// <summary>Changes the fraction of the sound going through a wall (i.e. a door opening)</summary>
+		/// <param name="wall">The index of the wall</param>
+		/// <param name="transmission">The new fraction of the sound going through the wall (0 - 1)</param>
+		void setWallTransmission(std::size_t wall, float transmission);
+		/// <summary>Removes all the walls</summary>
+		void clear();
+		/// <summary>Retrieves the amount of walls</summary>
+		/// <returns>The amount of walls</returns>
+		std::size_t getWallCount() const;
+		/// <summary>Computes the fraction of the sound going from the <paramref name="emitter"/> to the <paramref name="listener"/> through the walls</summary>
+		/// <param name="listener">The position of the listener</param>
+		/// <param name="emitter">The position of the emitter</param>
+		/// <returns>The transmission (0 - 1), 1 if no wall is crossed</returns>
+		float computeTransmission(const sf::Vector2f& listener, const sf::Vector2f& emitter);
+		/// <summary>
+		/// Computes the transmissions of several emitters in order until the time <paramref name="budget"/> runs out<para/>
+		///
+		/// The elapsed time is checked every 8 emitters, the emitters left are to be updated by a later call.
+		/// </summary>
+		/// <param name="listener">The position of the listener</param>
+		/// <param name="emitters">The positions of the emitters</param>
+		/// <param name="transmissions">The transmissions computed for the emitters (<paramref name="count"/> floats)</param>
+		/// <param name="count">The amount of emitters</param>
+		/// <param name="budget">The time available for the queries (zero for no limit)</param>
+		/// <returns>The amount of emitters whose transmission was computed</returns>
+		std::size_t computeTransmissions(const sf::Vector2f& listener, const sf::Vector2f* emitters, float* transmissions, std::size_t count, sf::Time budget);
+
+	private:
+		/// <summary>Struct used to represent a wall</summary>
+		struct Wall {
+			sf::Vector2f start;        ///< The first end of the segment
+			sf::Vector2f end;          ///< The second end of the segment
+			float        transmission; ///< The fraction of the sound going through
+		};
+
+	private:
+		/// <summary>Sorts the walls into the cells they overlap, padding each cell to a multiple of four walls</summary>
+		void build();
+		/// <summary>Calls <paramref name="visit"/> with the index of every cell crossed by the segment going from <paramref name="start"/> to <paramref name="end"/>, in order</summary>
+		/// <param name="start">The start of the segment</param>
+		/// <param name="end">The end of the segment</param>
+		/// <param name="visit">The function called for each cell, returning false to stop the walk</param>
+		template <typename F>
+		void walk(const sf::Vector2f& start, const sf::Vector2f& end, F visit) const;
+
+	private:
+		/// <summary>The maximum amount of cells of the grid</summary>
+		static const std::size_t MAX_CELLS = 1 << 20;
+
+		std::vector<Wall>        walls_;        ///< The walls
+		std::vector<sf::Uint32>  visits_;       ///< The last query that tested each wall
+		sf::Uint32               query_;        ///< The identifier of the current query
+		bool                     dirty_;        ///< Have the walls changed since the grid was built?
+		float                    cellSize_;     ///< The size of the cells requested
+		float                    gridCellSize_; ///< The size of the grid's cells
+		sf::Vector2f             origin_;       ///< The corner of the grid with the lowest coordinates
+		std::size_t              columns_;      ///< The amount of columns of the grid
+		std::size_t              rows_;         ///< The amount of rows of the grid
+		std::vector<std::size_t> cellStarts_;   ///< The index of the first wall of each cell in the arrays below (plus the total at the end)
+		std::vector<sf::Uint32>  cellWalls_;    ///< The index of each wall of the cells
+		std::vector<float>       startX_;       ///< The horizontal coordinate of the first end of the cells' walls
+		std::vector<float>       startY_;       ///< The vertical coordinate of the first end of the cells' walls
+		std::vector<float>       deltaX_;       ///< The horizontal extent of the cells' walls
+		std::vector<float>       deltaY_;       ///< The vertical extent of the cells' walls
+	};
+}
+#endif
\ No newline at end of file
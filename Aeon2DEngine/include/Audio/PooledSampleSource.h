@@ -0,0 +1,155 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+
+#ifndef Aeon2D_Audio_PooledSampleSource_H_
+#define Aeon2D_Audio_PooledSampleSource_H_
+
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <mutex>
+
+#include "SampleSource.h"
+#include "DecodePool.h"
+
+namespace ae
+{
+	/// <summary>
+	/// Sample source reading the frames of another sample source decoded ahead by a <see cref="DecodePool"/><para/>
+	///
+	/// The frames are exchanged through a wait-free ring buffer, the audio thread never decodes nor waits for a decode thread.<br/>
+	/// The first frames are kept decoded so that the source can restart (i.e. when it loops) while the decode threads seek back.<br/>
+	/// If the decode threads fall behind, the frames missing are read as silence instead of blocking the audio thread.
+	/// </summary>
+	class PooledSampleSource : public SampleSource
+	{
+	public:
+		/// <summary>Constructs the <see cref="PooledSampleSource"/> by providing the sample <paramref name="source"/> to decode ahead and the <paramref name="pool"/> decoding it, its first frames are decoded straight away</summary>
+		/// <param name="source">The sample source decoded ahead</param>
+		/// <param name="pool">The decode pool refilling the source's buffer (it must outlive the <see cref="PooledSampleSource"/>)</param>
+		/// <param name="bufferFrames">The amount of frames decoded ahead (see <see cref="setBuffering"/>)</param>
+		/// <param name="headFrames">The amount of first frames kept decoded</param>
+		PooledSampleSource(std::unique_ptr<SampleSource> source, DecodePool& pool, std::size_t bufferFrames = 16384, std::size_t headFrames = 4096);
+		/// <summary>Deleted copy constructor</summary>
+		/// <param name="copy">The <see cref="PooledSampleSource"/> to be copied</param>
+		PooledSampleSource(const PooledSampleSource& copy) = delete;
+		/// <summary>Detaches the source from its decode pool</summary>
+		virtual ~PooledSampleSource();
+	public:
+		/// <summary>Deleted assignment operator</summary>
+		/// <param name="other">The <see cref="PooledSampleSource"/> to be copied</param>
+		/// <returns>The caller <see cref="PooledSampleSource"/></returns>
+		PooledSampleSource& operator=(const PooledSampleSource& other) = delete;
+	public:
+		/// <summary>
+		/// Reads the next frames decoded ahead<para/>
+		///
+		/// Less frames than requested are read once the end of the source has been reached or if the decode threads fell behind.
+		/// </summary>
+		/// <param name="samples">The interleaved samples read (at least <paramref name="frameCount"/> * channel count)</param>
+		/// <param name="frameCount">The maximum amount of frames to read</param>
+		/// <returns>The amount of frames read</returns>
+		virtual std::size_t read(sf::Int16* samples, std::size_t frameCount) override;
+		/// <summary>
+		/// Changes the position of the next frame to read<para/>
+		///
+		/// The seek is handed over to the decode threads, the first frames are read straight away from the ones kept decoded.<br/>
+		/// A target already decoded ahead (i.e. a short skip forward) is reached by dropping the frames before it, without seeking the decoder.
+		/// </summary>
+		/// <param name="frame">The index of the next frame to read</param>
+		virtual void seek(sf::Uint64 frame) override;
+		/// <summary>
+		/// Changes the size of the ring buffer and of the chunks decoded at once (audio side, or with the audio thread's reads locked out)<para/>
+		///
+		/// The frames already decoded ahead are kept, up to the new capacity, so the source can be resized while it plays.<br/>
+		/// Larger buffers survive slower storage, smaller ones use less memory; larger chunks keep the file accesses sequential.
+		/// </summary>
+		/// <param name="bufferFrames">The amount of frames decoded ahead (at least 1024)</param>
+		/// <param name="chunkFrames">The minimum amount of frames decoded at once, 0 for a quarter of the buffer</param>
+		/// <returns>True</returns>
+		virtual bool setBuffering(std::size_t bufferFrames, std::size_t chunkFrames) override;
+		/// <summary>Retrieves the total amount of frames of the source</summary>
+		/// <returns>The amount of frames</returns>
+		virtual sf::Uint64 getFrameCount() const override;
+		/// <summary>Retrieves the amount of channels of the source</summary>
+		/// <returns>The amount of channels</returns>
+		virtual unsigned int getChannelCount() const override;
+		/// <summary>Retrieves the amount of frames per second of the source</summary>
+		/// <returns>The sample rate</returns>
+		virtual unsigned int getSampleRate() const override;
+		/// <summary>Retrieves the amount of reads that lacked frames because the decode threads fell behind</summary>
+		/// <returns>The amount of underruns</returns>
+		std::size_t getUnderrunCount() const;
+		/// <summary>
+		/// Retrieves the state of the ring buffer (audio side, or with the audio thread's reads locked out)<para/>
+		///
+		/// The fill level is relative to the frames left in the source, a buffer holding all of them is full.
+		/// </summary>
+		/// <param name="fill">The fill level (0 - 1) of the ring buffer, 0 while a seek is pending</param>
+		/// <param name="underruns">The amount of reads that lacked frames</param>
+		/// <returns>True</returns>
+		virtual bool getBufferState(float& fill, std::size_t& underruns) const override;
+
+	private:
+		friend class DecodePool;
+
+		/// <summary>
+		/// Applies the last seek requested and refills the ring buffer (decode thread, with the decode mutex locked)<para/>
+		///
+		/// Small refills are put off until enough space is available, unless the source is decoded on the audio thread.
+		/// </summary>
+		/// <returns>True if any frame was decoded or a seek was applied, false if there was nothing to do</returns>
+		bool decode();
+		/// <summary>Copies the decoded frames available in the ring buffer (audio thread)</summary>
+		/// <param name="samples">The interleaved samples read</param>
+		/// <param name="frameCount">The maximum amount of frames to copy</param>
+		/// <returns>The amount of frames copied</returns>
+		std::size_t readRing(sf::Int16* samples, std::size_t frameCount);
+		/// <summary>Retrieves the time left before the audio thread runs out of decoded frames, used by the decode threads to refill the most urgent sources first</summary>
+		/// <returns>The duration of the frames decoded ahead in seconds, 0 while a seek is pending</returns>
+		float getLead() const;
+
+	private:
+		std::unique_ptr<SampleSource> source_;       ///< The sample source decoded ahead
+		DecodePool&                   pool_;         ///< The decode pool refilling the ring buffer
+		const unsigned int            CHANNEL_COUNT; ///< The amount of channels
+		const unsigned int            SAMPLE_RATE;   ///< The sample rate
+		const sf::Uint64              FRAME_COUNT;   ///< The amount of frames of the source
+		std::size_t                   ringFrames_;   ///< The capacity of the ring buffer in frames
+		std::size_t                   chunkFrames_;  ///< The minimum amount of frames decoded at once by the decode threads
+		std::vector<sf::Int16>        head_;         ///< The first frames kept decoded
+		std::vector<sf::Int16>        ring_;         ///< The ring buffer of the frames decoded ahead
+		std::atomic<sf::Uint64>       readCount_;    ///< The total amount of frames consumed from the ring buffer
+		std::atomic<sf::Uint64>       writeCount_;   ///< The total amount of frames written in the ring buffer
+		std::atomic<sf::Uint64>       seekFrame_;    ///< The frame the decode threads seek to
+		std::atomic<sf::Uint64>       seekWrite_;    ///< The amount of frames written in the ring buffer when the last seek was applied
+		std::atomic<unsigned int>     seekRequest_;  ///< The sequence of the last seek requested
+		std::atomic<unsigned int>     seekApplied_;  ///< The sequence of the last seek applied
+		std::mutex                    decodeMutex_;  ///< The mutex held while the source is decoded
+		sf::Uint64                    decodeFrame_;  ///< The next frame of the source to decode (decode side)
+		bool                          reposition_;   ///< Must the source be seeked to the next frame to decode before decoding? (decode side)
+		sf::Uint64                    headCursor_;   ///< The next frame read from the first frames kept decoded (audio side)
+		sf::Uint64                    ringFrame_;    ///< The frame of the source read next from the ring buffer (audio side)
+		unsigned int                  seekPending_;  ///< The sequence of the last seek requested (audio side)
+		std::size_t                   underruns_;    ///< The amount of reads that lacked frames (audio side)
+	};
+}
+#endif
\ No newline at end of file
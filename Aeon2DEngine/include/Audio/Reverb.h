@@ -0,0 +1,126 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#ifndef Aeon2D_Audio_Reverb_H_
+#define Aeon2D_Audio_Reverb_H_
+
+#include <vector>
+#include <atomic>
+
+#include "AudioEffect.h"
+
+namespace ae
+{
+	/// <summary>
+	/// Algorithmic stereo reverb (Schroeder-Moorer, tuned like Freeverb) simulating the reflections of an environment<para/>
+	///
+	/// Each channel feeds 8 parallel damped comb filters followed by 4 serial all-pass filters.<br/>
+	/// The 16 comb filters of both channels are advanced together in SSE registers, four at a time.<br/>
+	/// The delay lines are allocated by the first block processed (and again if the sample rate changes).
+	/// </summary>
+	/// <code>
+	/// ae::Reverb cave;
+	/// cave.setRoomSize(0.9f);
+	/// cave.setDamping(0.2f);
+	/// cave.setWet(0.4f);
+	/// </code>
+	class Reverb : public AudioEffect
+	{
+	public:
+		/// <summary>
+		/// Default constructor<para/>
+		///
+		/// The room size is set to 0.5, the damping to 0.5, the wet level to 0.3, the dry level to 1 and the stereo width to 1.
+		/// </summary>
+		Reverb();
+	public:
+		/// <summary>Adds the reverberation of a block of frames in place</summary>
+		/// <param name="frames">The interleaved stereo frames (2 * <paramref name="frameCount"/> floats)</param>
+		/// <param name="frameCount">The amount of frames to process</param>
+		/// <param name="sampleRate">The amount of frames per second</param>
+		virtual void process(float* frames, std::size_t frameCount, unsigned int sampleRate) override;
+		/// <summary>Clears the reverb's tail</summary>
+		virtual void reset() override;
+		/// <summary>Sets the size of the simulated room (0 - 1), the longer the tail the bigger the room</summary>
+		/// <param name="roomSize">The new room size</param>
+		/// <seealso cref="getRoomSize"/>
+		void setRoomSize(float roomSize);
+		/// <summary>Retrieves the size of the simulated room (0 - 1)</summary>
+		/// <returns>The room size</returns>
+		/// <seealso cref="setRoomSize"/>
+		float getRoomSize() const;
+		/// <summary>Sets how much the high frequencies of the reflections are absorbed (0 - 1)</summary>
+		/// <param name="damping">The new damping</param>
+		/// <seealso cref="getDamping"/>
+		void setDamping(float damping);
+		/// <summary>Retrieves how much the high frequencies of the reflections are absorbed (0 - 1)</summary>
+		/// <returns>The damping</returns>
+		/// <seealso cref="setDamping"/>
+		float getDamping() const;
+		/// <summary>Sets the level of the reverberated signal (0 - 1)</summary>
+		/// <param name="wet">The new wet level</param>
+		/// <seealso cref="getWet"/>
+		void setWet(float wet);
+		/// <summary>Retrieves the level of the reverberated signal (0 - 1)</summary>
+		/// <returns>The wet level</returns>
+		/// <seealso cref="setWet"/>
+		float getWet() const;
+		/// <summary>Sets the level of the original signal (0 - 1)</summary>
+		/// <param name="dry">The new dry level</param>
+		/// <seealso cref="getDry"/>
+		void setDry(float dry);
+		/// <summary>Retrieves the level of the original signal (0 - 1)</summary>
+		/// <returns>The dry level</returns>
+		/// <seealso cref="setDry"/>
+		float getDry() const;
+		/// <summary>Sets the stereo width of the reverberated signal (0 for mono, 1 for the widest)</summary>
+		/// <param name="width">The new stereo width</param>
+		/// <seealso cref="getWidth"/>
+		void setWidth(float width);
+		/// <summary>Retrieves the stereo width of the reverberated signal (0 - 1)</summary>
+		/// <returns>The stereo width</returns>
+		/// <seealso cref="setWidth"/>
+		float getWidth() const;
+
+	private:
+		/// <summary>Allocates the delay lines scaled for the <paramref name="sampleRate"/> provided and clears them</summary>
+		/// <param name="sampleRate">The amount of frames per second</param>
+		void allocate(unsigned int sampleRate);
+
+	private:
+		/// <summary>The amount of comb filters of both channels</summary>
+		static const std::size_t COMB_COUNT = 16;
+		/// <summary>The amount of delay lines (the comb filters followed by the 8 all-pass filters of both channels)</summary>
+		static const std::size_t LINE_COUNT = COMB_COUNT + 8;
+
+		std::atomic<float> roomSize_;               ///< The size of the simulated room
+		std::atomic<float> damping_;                ///< The damping of the high frequencies
+		std::atomic<float> wet_;                    ///< The level of the reverberated signal
+		std::atomic<float> dry_;                    ///< The level of the original signal
+		std::atomic<float> width_;                  ///< The stereo width
+		unsigned int       sampleRate_;             ///< The sample rate of the delay lines
+		std::vector<float> lines_;                  ///< The delay lines, one after the other
+		std::size_t        offsets_[LINE_COUNT];    ///< The offset of each delay line
+		std::size_t        lengths_[LINE_COUNT];    ///< The length of each delay line
+		std::size_t        cursors_[LINE_COUNT];    ///< The read and write position in each delay line
+		float              combStates_[COMB_COUNT]; ///< The state of the low-pass filter of each comb filter (the damping)
+	};
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,85 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#ifndef Aeon2D_Audio_SampleSource_H_
+#define Aeon2D_Audio_SampleSource_H_
+
+#include <cstddef>
+
+#include <SFML/Config.hpp>
+
+namespace ae
+{
+	/// <summary>
+	/// Abstract base class of the sources providing 16-bit integer frames on demand<para/>
+	///
+	/// Sample sources are used to stream long sounds (i.e. music tracks) into a <see cref="SoftwareMixer"/> without decoding them entirely.
+	/// </summary>
+	class SampleSource
+	{
+	public:
+		/// <summary>Virtual destructor</summary>
+		virtual ~SampleSource() = default;
+	public:
+		/// <summary>
+		/// Reads the next frames of the source<para/>
+		///
+		/// Less frames than requested are only read once the end of the source has been reached.
+		/// </summary>
+		/// <param name="samples">The interleaved samples read (at least <paramref name="frameCount"/> * channel count)</param>
+		/// <param name="frameCount">The maximum amount of frames to read</param>
+		/// <returns>The amount of frames read</returns>
+		virtual std::size_t read(sf::Int16* samples, std::size_t frameCount) = 0;
+		/// <summary>Changes the position of the next frame to read</summary>
+		/// <param name="frame">The index of the next frame to read</param>
+		virtual void seek(sf::Uint64 frame) = 0;
+		/// <summary>Retrieves the total amount of frames of the source</summary>
+		/// <returns>The amount of frames</returns>
+		virtual sf::Uint64 getFrameCount() const = 0;
+		/// <summary>Retrieves the amount of channels of the source (1 or 2)</summary>
+		/// <returns>The amount of channels</returns>
+		virtual unsigned int getChannelCount() const = 0;
+		/// <summary>Retrieves the amount of frames per second of the source</summary>
+		/// <returns>The sample rate</returns>
+		virtual unsigned int getSampleRate() const = 0;
+		/// <summary>
+		/// Retrieves the state of the buffer decoded ahead of the reads<para/>
+		///
+		/// Sources decoding on demand (i.e. a <see cref="FileSampleSource"/>) have no buffer and return false.
+		/// </summary>
+		/// <param name="fill">The fill level (0 - 1) of the buffer</param>
+		/// <param name="underruns">The amount of reads that lacked decoded frames</param>
+		/// <returns>True if the source has a buffer, false otherwise</returns>
+		virtual bool getBufferState(float& fill, std::size_t& underruns) const;
+		/// <summary>
+		/// Changes the size of the buffer decoded ahead of the reads and of the chunks decoded at once<para/>
+		///
+		/// Sources decoding on demand (i.e. a <see cref="FileSampleSource"/>) have no buffer and return false.
+		/// </summary>
+		/// <param name="bufferFrames">The amount of frames decoded ahead</param>
+		/// <param name="chunkFrames">The minimum amount of frames decoded at once, 0 for the source's default</param>
+		/// <returns>True if the source has a buffer, false otherwise</returns>
+		virtual bool setBuffering(std::size_t bufferFrames, std::size_t chunkFrames);
+	protected:
+		/// <summary>Default constructor</summary>
+		SampleSource() = default;
+	};
+}
+#endif
\ No newline at end of file
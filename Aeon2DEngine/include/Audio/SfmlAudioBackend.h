@@ -0,0 +1,196 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#ifndef Aeon2D_Audio_SfmlAudioBackend_H_
+#define Aeon2D_Audio_SfmlAudioBackend_H_
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+#include <SFML/Audio/Sound.hpp>
+#include <SFML/Audio/Music.hpp>
+#include <SFML/System/Clock.hpp>
+
+#include "AudioBackend.h"
+
+namespace ae
+{
+	/// <summary>
+	/// Audio backend playing each source with its own sf::Sound or sf::Music object (and therefore its own OpenAL source)<para/>
+	///
+	/// This is the default backend of the audio players, see <see cref="AudioBackend::getDefault"/>.<br/>
+	/// The fades and the scheduled starts are applied by a worker thread, started by the first of them, that updates the volume of the fading sources every 10 milliseconds
+	/// and plays the scheduled sources when the audio clock reaches their start time (with an accuracy of about a millisecond).
+	/// The audio clock simply measures the time elapsed since the backend was created.
+	/// </summary>
+	class SfmlAudioBackend : public AudioBackend
+	{
+	public:
+		/// <summary>Default constructor</summary>
+		SfmlAudioBackend();
+		/// <summary>Stops the worker thread</summary>
+		virtual ~SfmlAudioBackend();
+	public:
+		/// <summary>Creates a stopped sf::Sound playing a sound <paramref name="buffer"/></summary>
+		/// <param name="buffer">The sound buffer to play</param>
+		/// <returns>The identifier of the new source</returns>
+		virtual SourceID createSound(const sf::SoundBuffer& buffer) override;
+		/// <summary>Creates a stopped sf::Music streaming the audio file located at the <paramref name="filepath"/> provided</summary>
+		/// <param name="filepath">The audio file's filepath</param>
+		/// <returns>The identifier of the new source, 0 if the file couldn't be opened</returns>
+		virtual SourceID createStream(const std::string& filepath) override;
+		/// <summary>Creates a stopped sf::Music streaming the audio file held by a region of memory, which must remain alive as long as the source exists</summary>
+		/// <param name="data">The first byte of the audio file</param>
+		/// <param name="size">The size of the audio file in bytes</param>
+		/// <returns>The identifier of the new source, 0 if the file couldn't be opened</returns>
+		virtual SourceID createStream(const void* data, std::size_t size) override;
+		/// <summary>Creates a stopped sf::Music streaming the audio file read by a custom <paramref name="stream"/>, owned by the source</summary>
+		/// <param name="stream">The stream reading the audio file</param>
+		/// <returns>The identifier of the new source, 0 if the file couldn't be opened</returns>
+		virtual SourceID createStream(std::unique_ptr<sf::InputStream> stream) override;
+		/// <summary>Destroys a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		virtual void destroySource(SourceID source) override;
+		/// <summary>Starts or resumes playing a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		virtual void play(SourceID source) override;
+		/// <summary>Starts playing a source when the audio clock reaches the <paramref name="clockTime"/> provided (within the 10 milliseconds of the worker thread)</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="clockTime">The time of the audio clock at which the source starts</param>
+		virtual void playAt(SourceID source, sf::Time clockTime) override;
+		/// <summary>Pauses a playing source (a scheduled source is unscheduled)</summary>
+		/// <param name="source">The identifier of the source</param>
+		virtual void pause(SourceID source) override;
+		/// <summary>Stops a source and rewinds it to its beginning (a scheduled source is unscheduled)</summary>
+		/// <param name="source">The identifier of the source</param>
+		virtual void stop(SourceID source) override;
+		/// <summary>Sets whether a source restarts from its beginning once it reaches its end</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="flag">True to put the source on loop, false otherwise</param>
+		virtual void setLoop(SourceID source, bool flag) override;
+		/// <summary>Sets the <paramref name="volume"/> of a source (0 - 100)</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="volume">The new volume of the source</param>
+		virtual void setVolume(SourceID source, float volume) override;
+		/// <summary>Ramps the fade gain (0 - 1) of a source to the <paramref name="gain"/> provided over a <paramref name="duration"/></summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="gain">The fade gain reached at the end of the ramp</param>
+		/// <param name="duration">The duration of the ramp (zero to apply the <paramref name="gain"/> straight away)</param>
+		/// <param name="stop">True to stop the source once the ramp ends (i.e. a fade-out)</param>
+		virtual void fade(SourceID source, float gain, sf::Time duration, bool stop) override;
+		/// <summary>Applies the pitch, the attenuation, the minimum distance and the listener relativity of the <paramref name="properties"/> to a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="properties">The <see cref="AudioProperties"/> to apply</param>
+		virtual void setProperties(SourceID source, const AudioProperties& properties) override;
+		/// <summary>Sets the 3D <paramref name="position"/> of a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="position">The new 3D position of the source</param>
+		virtual void setPosition(SourceID source, const sf::Vector3f& position) override;
+		/// <summary>
+		/// Sets the playing position of a source<para/>
+		///
+		/// SFML ignores the playing position of stopped sources, it's therefore kept until the source is played.
+		/// </summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="offset">The new playing position from the beginning of the source</param>
+		virtual void setPlayingOffset(SourceID source, sf::Time offset) override;
+		/// <summary>Retrieves the playing position of a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <returns>The playing position from the beginning of the source</returns>
+		virtual sf::Time getPlayingOffset(SourceID source) const override;
+		/// <summary>Retrieves the status of a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <returns>The status of the source (sf::SoundSource::Status::Playing if it's scheduled), sf::SoundSource::Status::Stopped if it doesn't exist</returns>
+		virtual sf::SoundSource::Status getStatus(SourceID source) const override;
+		/// <summary>Sets the 3D <paramref name="position"/> of the sf::Listener</summary>
+		/// <param name="position">The new 3D position of the listener</param>
+		virtual void setListenerPosition(const sf::Vector3f& position) override;
+		/// <summary>Retrieves the 3D position of the sf::Listener</summary>
+		/// <returns>The 3D position of the listener</returns>
+		virtual sf::Vector3f getListenerPosition() const override;
+		/// <summary>
+		/// Retrieves the maximum amount of sound sources that should be playing at the same time<para/>
+		///
+		/// Half of the 256 OpenAL sources are left to the music tracks.
+		/// </summary>
+		/// <returns>128</returns>
+		virtual std::size_t getMaxSources() const override;
+		/// <summary>Retrieves the audio clock, the time elapsed since the backend was created</summary>
+		/// <returns>The current time of the audio clock</returns>
+		virtual sf::Time getAudioClock() const override;
+
+	private:
+		/// <summary>Struct used to represent a source (either an sf::Sound or an sf::Music)</summary>
+		struct Source {
+			std::unique_ptr<sf::Sound>       sound;         ///< The sf::Sound object (nullptr if the source is a stream)
+			std::unique_ptr<sf::InputStream> stream;        ///< The custom stream read by the sf::Music object, destroyed after it (nullptr if there's none)
+			std::unique_ptr<sf::Music>       music;         ///< The sf::Music object (nullptr if the source is a sound)
+			sf::Time                         pendingOffset; ///< The playing position applied when the stopped source is played
+			float                            volume;        ///< The volume of the source, without the fade gain
+			float                            fadeGain;      ///< The current fade gain
+			float                            fadeTarget;    ///< The fade gain reached at the end of the ramp
+			sf::Time                         fadeLeft;      ///< The duration left in the ramp
+			bool                             stopAfterFade; ///< Is the source stopped once the ramp ends?
+			bool                             scheduled;     ///< Is the source waiting for the audio clock to reach its start time?
+			sf::Time                         startTime;     ///< The time of the audio clock at which the scheduled source starts
+
+			/// <summary>Default constructor</summary>
+			Source();
+		};
+
+	private:
+		/// <summary>Retrieves the source associated with the identifier provided</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <returns>The source, nullptr if it couldn't be found</returns>
+		Source* findSource(SourceID source);
+		/// <summary>Retrieves the source associated with the identifier provided</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <returns>The source, nullptr if it couldn't be found</returns>
+		const Source* findSource(SourceID source) const;
+		/// <summary>Retrieves the sf::SoundSource of the source associated with the identifier provided</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <returns>The sf::SoundSource, nullptr if it couldn't be found</returns>
+		sf::SoundSource* findSoundSource(SourceID source);
+		/// <summary>Retrieves the current status of a source, a scheduled source counts as playing (the mutex must be held)</summary>
+		/// <param name="source">The source whose status is retrieved</param>
+		/// <returns>The current status of the source</returns>
+		sf::SoundSource::Status getSourceStatus(const Source& source) const;
+		/// <summary>Starts or resumes playing a source, applying its pending playing position (the mutex must be held)</summary>
+		/// <param name="source">The source to play</param>
+		void startSource(Source& source);
+		/// <summary>Starts the worker thread if it isn't running yet and wakes it up (the mutex must be held)</summary>
+		void wakeWorker();
+		/// <summary>Body of the worker thread, advancing the ramps of the playing sources and starting the scheduled sources</summary>
+		void runWorker();
+
+	private:
+		std::map<SourceID, Source> sources_;       ///< The existing sources
+		SourceID                   nextId_;        ///< The identifier given to the next source
+		sf::Clock                  clock_;         ///< The audio clock
+		std::thread                worker_;        ///< The worker thread (started by the first fade or scheduled start)
+		mutable std::mutex         mutex_;         ///< Mutex protecting the sources' existence, fades and schedules from the worker thread
+		std::condition_variable    workCondition_; ///< Condition waking up the worker thread when a fade starts or a source is scheduled
+		bool                       running_;       ///< Is the worker thread running?
+	};
+}
+#endif
\ No newline at end of file
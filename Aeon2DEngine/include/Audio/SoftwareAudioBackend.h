@@ -0,0 +1,236 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#ifndef Aeon2D_Audio_SoftwareAudioBackend_H_
+#define Aeon2D_Audio_SoftwareAudioBackend_H_
+
+#include <map>
+#include <memory>
+
+#include "AudioBackend.h"
+#include "SoftwareMixer.h"
+#include "MixerStream.h"
+#include "DecodePool.h"
+#include "LayeredSampleSource.h"
+
+namespace ae
+{
+	/// <summary>
+	/// Audio backend mixing all the sources in software with a <see cref="SoftwareMixer"/><para/>
+	///
+	/// The mix is streamed to the audio device through a single <see cref="MixerStream"/>, the amount of sources is therefore unlimited.<br/>
+	/// Streams are decoded ahead of the audio thread by a shared <see cref="DecodePool"/>, or by the audio thread itself when the mix isn't streamed to the audio device (offline rendering stays deterministic).
+	/// </summary>
+	class SoftwareAudioBackend : public AudioBackend
+	{
+	public:
+		/// <summary>Constructs the <see cref="SoftwareAudioBackend"/> and starts streaming its mix to the audio device</summary>
+		/// <param name="sampleRate">The amount of frames per second mixed</param>
+		/// <param name="blockFrames">The amount of frames mixed at once (lower values reduce the latency)</param>
+		/// <param name="decodeThreads">The amount of threads decoding all the streams ahead, whatever their amount</param>
+		/// <code>
+		/// ae::SoftwareAudioBackend backend;
+		/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer(backend);
+		/// ae::MusicPlayer&lt;MusicID&gt; musicPlayer(backend);
+		/// </code>
+		explicit SoftwareAudioBackend(unsigned int sampleRate = 44100, std::size_t blockFrames = 512, std::size_t decodeThreads = 1);
+	public:
+		/// <summary>Creates a stopped voice playing a sound <paramref name="buffer"/></summary>
+		/// <param name="buffer">The sound buffer to play</param>
+		/// <returns>The identifier of the new source</returns>
+		virtual SourceID createSound(const sf::SoundBuffer& buffer) override;
+		/// <summary>Creates a stopped voice streaming the audio file located at the <paramref name="filepath"/> provided</summary>
+		/// <param name="filepath">The audio file's filepath</param>
+		/// <returns>The identifier of the new source, 0 if the file couldn't be opened</returns>
+		virtual SourceID createStream(const std::string& filepath) override;
+		/// <summary>Creates a stopped voice streaming the audio file held by a region of memory, decoded in place by the decode pool</summary>
+		/// <param name="data">The first byte of the audio file</param>
+		/// <param name="size">The size of the audio file in bytes</param>
+		/// <returns>The identifier of the new source, 0 if the file couldn't be opened</returns>
+		virtual SourceID createStream(const void* data, std::size_t size) override;
+		/// <summary>Creates a stopped voice streaming the audio file read by a custom <paramref name="stream"/>, only read by the decode pool</summary>
+		/// <param name="stream">The stream reading the audio file</param>
+		/// <returns>The identifier of the new source, 0 if the file couldn't be opened</returns>
+		virtual SourceID createStream(std::unique_ptr<sf::InputStream> stream) override;
+		/// <summary>
+		/// Creates a stopped voice streaming the stems located at the <paramref name="filepaths"/> provided, mixed down by a <see cref="LayeredSampleSource"/><para/>
+		///
+		/// The stems are decoded ahead together by a <see cref="StemSampleSource"/>, as a single stream of the decode pool.
+		/// </summary>
+		/// <param name="filepaths">The stems' filepaths, one per layer</param>
+		/// <returns>The identifier of the new source, 0 if a stem couldn't be opened or if the stems don't match</returns>
+		virtual SourceID createLayeredStream(const std::vector<std::string>& filepaths) override;
+		/// <summary>Checks if the backend creates layered streams, which the software mixer always does</summary>
+		/// <returns>True</returns>
+		virtual bool supportsLayeredStreams() const override;
+		/// <summary>Destroys a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		virtual void destroySource(SourceID source) override;
+		/// <summary>Starts or resumes playing a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		virtual void play(SourceID source) override;
+		/// <summary>Starts playing a source when the audio clock reaches the <paramref name="clockTime"/> provided (on the exact frame)</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="clockTime">The time of the audio clock at which the source starts</param>
+		virtual void playAt(SourceID source, sf::Time clockTime) override;
+		/// <summary>Chains the <paramref name="next"/> source to a source, it starts playing on the frame following the end of the source</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="next">The identifier of the stopped source started after it, 0 to remove the chain</param>
+		/// <returns>True</returns>
+		virtual bool chain(SourceID source, SourceID next) override;
+		/// <summary>Pauses a playing source</summary>
+		/// <param name="source">The identifier of the source</param>
+		virtual void pause(SourceID source) override;
+		/// <summary>Stops a source and rewinds it to its beginning</summary>
+		/// <param name="source">The identifier of the source</param>
+		virtual void stop(SourceID source) override;
+		/// <summary>Sets whether a source restarts from its beginning once it reaches its end</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="flag">True to put the source on loop, false otherwise</param>
+		virtual void setLoop(SourceID source, bool flag) override;
+		/// <summary>Sets the <paramref name="volume"/> of a source (0 - 100)</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="volume">The new volume of the source</param>
+		virtual void setVolume(SourceID source, float volume) override;
+		/// <summary>Ramps the fade gain (0 - 1) of a source to the <paramref name="gain"/> provided over a <paramref name="duration"/></summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="gain">The fade gain reached at the end of the ramp</param>
+		/// <param name="duration">The duration of the ramp (zero to apply the <paramref name="gain"/> straight away)</param>
+		/// <param name="stop">True to stop the source once the ramp ends (i.e. a fade-out)</param>
+		virtual void fade(SourceID source, float gain, sf::Time duration, bool stop) override;
+		/// <summary>
+		/// Ramps the gain (0 - 1) of a <paramref name="layer"/> of a layered stream to the <paramref name="gain"/> provided over a <paramref name="duration"/><para/>
+		///
+		/// The ramp is applied as the mix is rendered, it's heard once the mixer's read-ahead of the voice (4096 frames) has been played rather than the whole decode buffer.
+		/// </summary>
+		/// <param name="source">The identifier of the layered stream</param>
+		/// <param name="layer">The index of the layer (the index of its stem)</param>
+		/// <param name="gain">The gain reached at the end of the ramp</param>
+		/// <param name="duration">The duration of the ramp (zero to apply the <paramref name="gain"/> straight away)</param>
+		virtual void setLayerGain(SourceID source, std::size_t layer, float gain, sf::Time duration) override;
+		/// <summary>Applies the pitch, the attenuation, the minimum distance and the listener relativity of the <paramref name="properties"/> to a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="properties">The <see cref="AudioProperties"/> to apply</param>
+		virtual void setProperties(SourceID source, const AudioProperties& properties) override;
+		/// <summary>Sets the 3D <paramref name="position"/> of a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="position">The new 3D position of the source</param>
+		virtual void setPosition(SourceID source, const sf::Vector3f& position) override;
+		/// <summary>Sets the playing position of a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="offset">The new playing position from the beginning of the source</param>
+		virtual void setPlayingOffset(SourceID source, sf::Time offset) override;
+		/// <summary>Retrieves the playing position of a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <returns>The playing position from the beginning of the source</returns>
+		virtual sf::Time getPlayingOffset(SourceID source) const override;
+		/// <summary>Retrieves the status of a source</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <returns>The status of the source, sf::SoundSource::Status::Stopped if it doesn't exist</returns>
+		virtual sf::SoundSource::Status getStatus(SourceID source) const override;
+		/// <summary>Sets the 3D <paramref name="position"/> of the listener used by the mixer</summary>
+		/// <param name="position">The new 3D position of the listener</param>
+		virtual void setListenerPosition(const sf::Vector3f& position) override;
+		/// <summary>Retrieves the 3D position of the listener used by the mixer</summary>
+		/// <returns>The 3D position of the listener</returns>
+		virtual sf::Vector3f getListenerPosition() const override;
+		/// <summary>Retrieves the maximum amount of sound sources that should be playing at the same time</summary>
+		/// <returns>Unlimited (the maximum value of std::size_t)</returns>
+		virtual std::size_t getMaxSources() const override;
+		/// <summary>
+		/// Retrieves the audio clock, the time of the frames mixed since the backend was created<para/>
+		///
+		/// The frames are mixed ahead of the audio device by the latency of the <see cref="MixerStream"/>.
+		/// </summary>
+		/// <returns>The current time of the audio clock</returns>
+		virtual sf::Time getAudioClock() const override;
+		/// <summary>Creates a submix of the mixer whose sources are processed together by an <see cref="EffectChain"/></summary>
+		/// <param name="parent">The identifier of the parent submix, 0 for the output</param>
+		/// <returns>The identifier of the new submix</returns>
+		virtual SubmixID createSubmix(SubmixID parent) override;
+		/// <summary>Destroys a submix, its sources and child submixes are routed to its parent</summary>
+		/// <param name="submix">The identifier of the submix</param>
+		virtual void destroySubmix(SubmixID submix) override;
+		/// <summary>Sets the <paramref name="parent"/> of a submix</summary>
+		/// <param name="submix">The identifier of the submix</param>
+		/// <param name="parent">The identifier of the new parent submix, 0 for the output</param>
+		virtual void setSubmixParent(SubmixID submix, SubmixID parent) override;
+		/// <summary>Sets the <paramref name="effects"/> processing a submix</summary>
+		/// <param name="submix">The identifier of the submix</param>
+		/// <param name="effects">The effect chain, nullptr to remove it</param>
+		virtual void setSubmixEffects(SubmixID submix, EffectChain* effects) override;
+		/// <summary>Routes a source to a <paramref name="submix"/></summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="submix">The identifier of the submix, 0 for the output</param>
+		virtual void setSourceSubmix(SourceID source, SubmixID submix) override;
+		/// <summary>Sets the <paramref name="effects"/> processing a single source</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="effects">The effect chain, nullptr to remove it</param>
+		virtual void setSourceEffects(SourceID source, EffectChain* effects) override;
+		/// <summary>Sets the cutoff frequency of the low-pass filter muffling a single source</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="cutoff">The cutoff frequency in Hz, 0 to remove the filter</param>
+		virtual void setLowPass(SourceID source, float cutoff) override;
+		/// <summary>Changes the duration a stream of the mixer decodes ahead and the duration its decode threads decode at once</summary>
+		/// <param name="source">The identifier of the stream</param>
+		/// <param name="bufferTime">The duration decoded ahead</param>
+		/// <param name="chunkTime">The minimum duration decoded at once, zero for a quarter of the buffer</param>
+		virtual void setStreamBuffering(SourceID source, sf::Time bufferTime, sf::Time chunkTime) override;
+		/// <summary>Retrieves the state of the buffer decoded ahead by a stream of the mixer</summary>
+		/// <param name="source">The identifier of the stream</param>
+		/// <param name="fill">The fill level (0 - 1) of the stream's buffer</param>
+		/// <param name="underruns">The amount of times the stream ran out of decoded frames</param>
+		/// <returns>True if the stream reports its buffer, false otherwise</returns>
+		virtual bool getStreamState(SourceID source, float& fill, std::size_t& underruns) const override;
+		/// <summary>Sets the <paramref name="markers"/> of a source, detected by the mixer on the frame where they're mixed</summary>
+		/// <param name="source">The identifier of the source</param>
+		/// <param name="markers">The positions of the markers from the beginning of the source, sorted (empty to remove them)</param>
+		virtual void setMarkers(SourceID source, const std::vector<sf::Time>& markers) override;
+		/// <summary>Pops the next marker mixed by a source from the mixer's wait-free queue</summary>
+		/// <param name="source">The identifier of the source that played the marker</param>
+		/// <param name="index">The index of the marker in the source's markers</param>
+		/// <param name="clockTime">The time of the audio clock at which the marker is heard</param>
+		/// <returns>True if a marker was popped, false if none are waiting</returns>
+		virtual bool pollMarker(SourceID& source, std::size_t& index, sf::Time& clockTime) override;
+		/// <summary>Retrieves the time taken by the mixer to render its last block</summary>
+		/// <returns>The duration of the last render</returns>
+		virtual sf::Time getRenderTime() const override;
+		/// <summary>Retrieves the <see cref="SoftwareMixer"/> mixing the sources (i.e. to measure its render time)</summary>
+		/// <returns>The software mixer</returns>
+		SoftwareMixer& getMixer();
+		/// <summary>Retrieves the <see cref="SoftwareMixer"/> mixing the sources (i.e. to measure its render time)</summary>
+		/// <returns>The software mixer</returns>
+		const SoftwareMixer& getMixer() const;
+	protected:
+		/// <summary>Constructs the <see cref="SoftwareAudioBackend"/> by providing if its mix should be streamed to the audio device</summary>
+		/// <param name="sampleRate">The amount of frames per second mixed</param>
+		/// <param name="blockFrames">The amount of frames mixed at once</param>
+		/// <param name="decodeThreads">The amount of threads decoding the streams ahead (0 to decode them on the rendering thread)</param>
+		/// <param name="streamToDevice">True to stream the mix to the audio device, false to leave the rendering to the derived class</param>
+		SoftwareAudioBackend(unsigned int sampleRate, std::size_t blockFrames, std::size_t decodeThreads, bool streamToDevice);
+
+	private:
+		DecodePool                               decodePool_;     ///< The decode pool shared by the streams (without any thread if the mix isn't streamed to the audio device)
+		SoftwareMixer                            mixer_;          ///< The software mixer mixing the sources
+		std::unique_ptr<MixerStream>             stream_;         ///< The stream playing the mix (nullptr if it isn't streamed to the audio device)
+		std::map<SourceID, LayeredSampleSource*> layeredSources_; ///< The sample sources of the layered streams, owned by their voices
+	};
+}
+#endif
\ No newline at end of file
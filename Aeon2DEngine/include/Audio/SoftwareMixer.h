@@ -0,0 +1,405 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#ifndef Aeon2D_Audio_SoftwareMixer_H_
+#define Aeon2D_Audio_SoftwareMixer_H_
+
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+
+#include <SFML/Audio/SoundSource.hpp>
+#include <SFML/System/Vector3.hpp>
+#include <SFML/System/Time.hpp>
+
+#include "../Utils/RingBuffer.h"
+#include "AudioProperties.h"
+#include "SampleSource.h"
+
+// Forward Declaration(s)
+namespace sf {
+	class SoundBuffer;
+}
+namespace ae {
+	class EffectChain;
+}
+
+namespace ae
+{
+	/// <summary>
+	/// Mixes any amount of sound buffers and sample sources in software into a single stereo float stream<para/>
+	///
+	/// Panning, gain, distance attenuation (inverse distance clamped, like OpenAL) and pitch resampling are computed per voice with the vectorized <see cref="MixKernels"/>.<br/>
+	/// The voices behave like sf::Sound objects (stopping a voice rewinds it) and are controlled from the game thread
+	/// while <see cref="render"/> is called from the audio thread (i.e. by a <see cref="MixerStream"/>).<br/>
+	/// Voices may be routed to submixes, which are processed by an <see cref="EffectChain"/> before being added to their parent submix or to the output.
+	/// </summary>
+	class SoftwareMixer
+	{
+	public:
+		/// <summary>Identifier of a voice (0 is never a valid identifier)</summary>
+		using VoiceID = unsigned int;
+		/// <summary>Identifier of a submix (0 is the output)</summary>
+		using SubmixID = unsigned int;
+
+	public:
+		/// <summary>Constructs the <see cref="SoftwareMixer"/> by providing the <paramref name="sampleRate"/> of its output</summary>
+		/// <param name="sampleRate">The amount of frames per second that will be rendered</param>
+		/// <code>
+		/// ae::SoftwareMixer mixer(48000);
+		/// </code>
+		explicit SoftwareMixer(unsigned int sampleRate = 44100);
+		/// <summary>Deleted copy constructor</summary>
+		/// <param name="copy">The <see cref="SoftwareMixer"/> to be copied</param>
+		SoftwareMixer(const SoftwareMixer& copy) = delete;
+	public:
+		/// <summary>Deleted assignment operator</summary>
+		/// <param name="other">The <see cref="SoftwareMixer"/> to be copied</param>
+		/// <returns>The caller <see cref="SoftwareMixer"/></returns>
+		SoftwareMixer& operator=(const SoftwareMixer& other) = delete;
+	public:
+		/// <summary>
+		/// Creates a stopped voice playing a sound <paramref name="buffer"/><para/>
+		///
+		/// The <paramref name="buffer"/> must remain alive as long as the voice exists.
+		/// </summary>
+		/// <param name="buffer">The sound buffer to play</param>
+		/// <returns>The identifier of the new voice</returns>
+		/// <seealso cref="destroyVoice"/>
+		VoiceID createVoice(const sf::SoundBuffer& buffer);
+		/// <summary>
+		/// Creates a stopped voice streaming a sample <paramref name="source"/><para/>
+		///
+		/// The frames are read from the <paramref name="source"/> on the audio thread as they're needed (a <see cref="PooledSampleSource"/> has them decoded ahead by a <see cref="DecodePool"/>).
+		/// </summary>
+		/// <param name="source">The sample source to stream</param>
+		/// <returns>The identifier of the new voice</returns>
+		/// <seealso cref="destroyVoice"/>
+		VoiceID createVoice(std::unique_ptr<SampleSource> source);
+		/// <summary>Destroys a voice</summary>
+		/// <param name="id">The identifier of the voice</param>
+		/// <seealso cref="createVoice"/>
+		void destroyVoice(VoiceID id);
+		/// <summary>Starts or resumes playing a voice</summary>
+		/// <param name="id">The identifier of the voice</param>
+		void play(VoiceID id);
+		/// <summary>
+		/// Starts playing a voice on the frame where the mixer's clock reaches the <paramref name="clockTime"/> provided<para/>
+		///
+		/// The voice is reported as playing straight away, a <paramref name="clockTime"/> that has already passed plays it immediately.
+		/// </summary>
+		/// <param name="id">The identifier of the voice</param>
+		/// <param name="clockTime">The time of the mixer's clock at which the voice starts</param>
+		/// <seealso cref="getClock"/>
+		void playAt(VoiceID id, sf::Time clockTime);
+		/// <summary>
+		/// Chains the <paramref name="next"/> voice to a voice, it starts on the frame following the end of the voice<para/>
+		///
+		/// Stopping the voice removes its chain, a voice on loop keeps it until its loop is removed.
+		/// </summary>
+		/// <param name="id">The identifier of the voice</param>
+		/// <param name="next">The identifier of the stopped voice started after it, 0 to remove the chain</param>
+		void setVoiceNext(VoiceID id, VoiceID next);
+		/// <summary>Pauses a playing voice</summary>
+		/// <param name="id">The identifier of the voice</param>
+		void pause(VoiceID id);
+		/// <summary>Stops a voice and rewinds it to its beginning</summary>
+		/// <param name="id">The identifier of the voice</param>
+		void stop(VoiceID id);
+		/// <summary>Sets whether a voice restarts from its beginning once it reaches its end</summary>
+		/// <param name="id">The identifier of the voice</param>
+		/// <param name="flag">True to put the voice on loop, false otherwise</param>
+		void setLoop(VoiceID id, bool flag);
+		/// <summary>Sets the <paramref name="volume"/> of a voice (0 - 100)</summary>
+		/// <param name="id">The identifier of the voice</param>
+		/// <param name="volume">The new volume of the voice</param>
+		void setVolume(VoiceID id, float volume);
+		/// <summary>
+		/// Ramps the fade gain (0 - 1) of a voice to the <paramref name="gain"/> provided over a <paramref name="duration"/><para/>
+		///
+		/// The fade gain is applied on top of the volume, it's ramped sample by sample while the voice is rendered.
+		/// </summary>
+		/// <param name="id">The identifier of the voice</param>
+		/// <param name="gain">The fade gain reached at the end of the ramp</param>
+		/// <param name="duration">The duration of the ramp (zero to apply the <paramref name="gain"/> straight away)</param>
+		/// <param name="stop">True to stop the voice once the ramp ends (i.e. a fade-out)</param>
+		void fade(VoiceID id, float gain, sf::Time duration, bool stop);
+		/// <summary>
+		/// Sets the pitch, the attenuation, the minimum distance and the listener relativity of a voice<para/>
+		///
+		/// The volume of the <paramref name="properties"/> is ignored, see <see cref="setVolume"/>.
+		/// </summary>
+		/// <param name="id">The identifier of the voice</param>
+		/// <param name="properties">The <see cref="AudioProperties"/> to apply</param>
+		void setProperties(VoiceID id, const AudioProperties& properties);
+		/// <summary>Sets the 3D <paramref name="position"/> of a voice's source</summary>
+		/// <param name="id">The identifier of the voice</param>
+		/// <param name="position">The new 3D position of the voice's source</param>
+		void setPosition(VoiceID id, const sf::Vector3f& position);
+		/// <summary>Sets the playing position of a voice</summary>
+		/// <param name="id">The identifier of the voice</param>
+		/// <param name="offset">The new playing position from the beginning of the voice</param>
+		/// <seealso cref="getPlayingOffset"/>
+		void setPlayingOffset(VoiceID id, sf::Time offset);
+		/// <summary>Retrieves the playing position of a voice</summary>
+		/// <param name="id">The identifier of the voice</param>
+		/// <returns>The playing position from the beginning of the voice</returns>
+		/// <seealso cref="setPlayingOffset"/>
+		sf::Time getPlayingOffset(VoiceID id) const;
+		/// <summary>Retrieves the status of a voice</summary>
+		/// <param name="id">The identifier of the voice</param>
+		/// <returns>The status of the voice, sf::SoundSource::Status::Stopped if it doesn't exist</returns>
+		sf::SoundSource::Status getStatus(VoiceID id) const;
+		/// <summary>Changes the duration decoded ahead by the sample source of a voice and the duration it decodes at once</summary>
+		/// <param name="id">The identifier of the voice</param>
+		/// <param name="bufferTime">The duration decoded ahead</param>
+		/// <param name="chunkTime">The minimum duration decoded at once, zero for the source's default</param>
+		/// <returns>True if the voice streams a sample source with a buffer, false otherwise</returns>
+		bool setStreamBuffering(VoiceID id, sf::Time bufferTime, sf::Time chunkTime);
+		/// <summary>Retrieves the state of the buffer decoded ahead by the sample source of a voice</summary>
+		/// <param name="id">The identifier of the voice</param>
+		/// <param name="fill">The fill level (0 - 1) of the source's buffer</param>
+		/// <param name="underruns">The amount of times the source ran out of decoded frames</param>
+		/// <returns>True if the voice streams a sample source reporting its buffer, false otherwise</returns>
+		bool getStreamState(VoiceID id, float& fill, std::size_t& underruns) const;
+		/// <summary>
+		/// Sets the <paramref name="markers"/> of a voice, pushed in a wait-free queue by <see cref="render"/> on the frame where they're mixed<para/>
+		///
+		/// The markers are converted to frames of the voice, so they follow its pitch and its loops.
+		/// </summary>
+		/// <param name="id">The identifier of the voice</param>
+		/// <param name="markers">The positions of the markers from the beginning of the voice, sorted (empty to remove them)</param>
+		/// <seealso cref="pollMarker"/>
+		void setVoiceMarkers(VoiceID id, const std::vector<sf::Time>& markers);
+		/// <summary>Pops the next marker mixed by a voice, without any lock (a single thread may poll the markers)</summary>
+		/// <param name="id">The identifier of the voice that mixed the marker</param>
+		/// <param name="index">The index of the marker in the voice's markers</param>
+		/// <param name="clockTime">The time of the mixer's clock at which the marker is mixed</param>
+		/// <returns>True if a marker was popped, false if none are waiting</returns>
+		/// <seealso cref="setVoiceMarkers"/>
+		bool pollMarker(VoiceID& id, std::size_t& index, sf::Time& clockTime);
+		/// <summary>Sets the 3D <paramref name="position"/> of the listener used to spatialize the voices</summary>
+		/// <param name="position">The new 3D position of the listener</param>
+		/// <seealso cref="getListenerPosition"/>
+		void setListenerPosition(const sf::Vector3f& position);
+		/// <summary>
+		/// Creates a submix whose frames are added to its <paramref name="parent"/> submix once they're processed by its effects<para/>
+		///
+		/// The submixes are rendered from the deepest to the output, their effects are processed even when no voice is routed to them (i.e. for a reverb's tail).
+		/// </summary>
+		/// <param name="parent">The identifier of the parent submix, 0 for the output</param>
+		/// <returns>The identifier of the new submix</returns>
+		/// <seealso cref="destroySubmix"/>
+		SubmixID createSubmix(SubmixID parent = 0);
+		/// <summary>Destroys a submix, its voices and child submixes are routed to its parent</summary>
+		/// <param name="id">The identifier of the submix</param>
+		/// <seealso cref="createSubmix"/>
+		void destroySubmix(SubmixID id);
+		/// <summary>Sets the <paramref name="parent"/> of a submix, ignored if it would create a cycle</summary>
+		/// <param name="id">The identifier of the submix</param>
+		/// <param name="parent">The identifier of the new parent submix, 0 for the output</param>
+		void setSubmixParent(SubmixID id, SubmixID parent);
+		/// <summary>Sets the <paramref name="effects"/> processing the frames of a submix</summary>
+		/// <param name="id">The identifier of the submix</param>
+		/// <param name="effects">The effect chain (it must outlive the submix), nullptr to remove it</param>
+		void setSubmixEffects(SubmixID id, EffectChain* effects);
+		/// <summary>Routes a voice to a <paramref name="submix"/></summary>
+		/// <param name="id">The identifier of the voice</param>
+		/// <param name="submix">The identifier of the submix, 0 for the output</param>
+		void setVoiceSubmix(VoiceID id, SubmixID submix);
+		/// <summary>Sets the <paramref name="effects"/> processing the frames of a single voice before they're added to its submix</summary>
+		/// <param name="id">The identifier of the voice</param>
+		/// <param name="effects">The effect chain (it must outlive the voice), nullptr to remove it</param>
+		void setVoiceEffects(VoiceID id, EffectChain* effects);
+		/// <summary>Sets the cutoff frequency of the one-pole low-pass filter applied to a single voice before its effects</summary>
+		/// <param name="id">The identifier of the voice</param>
+		/// <param name="cutoff">The cutoff frequency in Hz, 0 to remove the filter</param>
+		void setVoiceLowPass(VoiceID id, float cutoff);
+		/// <summary>Retrieves the 3D position of the listener used to spatialize the voices</summary>
+		/// <returns>The 3D position of the listener</returns>
+		/// <seealso cref="setListenerPosition"/>
+		sf::Vector3f getListenerPosition() const;
+		/// <summary>
+		/// Renders the next <paramref name="frameCount"/> stereo frames of all the playing voices<para/>
+		///
+		/// Voices that reach their end are stopped and rewound.
+		/// </summary>
+		/// <param name="output">The interleaved stereo frames (at least 2 * <paramref name="frameCount"/> floats)</param>
+		/// <param name="frameCount">The amount of frames to render</param>
+		void render(float* output, std::size_t frameCount);
+		/// <summary>Retrieves the amount of frames per second rendered</summary>
+		/// <returns>The output's sample rate</returns>
+		unsigned int getSampleRate() const;
+		/// <summary>
+		/// Retrieves the mixer's clock, the time of the frames rendered since the mixer was created<para/>
+		///
+		/// It may be called from any thread.
+		/// </summary>
+		/// <returns>The current time of the mixer's clock</returns>
+		/// <seealso cref="playAt"/>
+		sf::Time getClock() const;
+		/// <summary>Retrieves the amount of existing voices, whatever their status</summary>
+		/// <returns>The amount of voices</returns>
+		std::size_t getVoiceCount() const;
+		/// <summary>
+		/// Retrieves the time taken by the last call to <see cref="render"/><para/>
+		///
+		/// Dividing it by <see cref="getLastRenderedVoiceCount"/> gives the mixing cost per voice per block.
+		/// </summary>
+		/// <returns>The duration of the last render</returns>
+		/// <seealso cref="getLastRenderedVoiceCount"/>
+		sf::Time getLastRenderTime() const;
+		/// <summary>Retrieves the amount of voices that were mixed by the last call to <see cref="render"/></summary>
+		/// <returns>The amount of voices mixed by the last render</returns>
+		/// <seealso cref="getLastRenderTime"/>
+		std::size_t getLastRenderedVoiceCount() const;
+
+	private:
+		/// <summary>Struct used to represent a voice being mixed</summary>
+		struct Voice {
+			const sf::SoundBuffer*        buffer;             ///< The sound buffer played (nullptr if the voice streams a sample source)
+			std::unique_ptr<SampleSource> source;             ///< The sample source streamed (nullptr if the voice plays a sound buffer)
+			std::vector<sf::Int16>        window;             ///< The frames of the sample source read in advance
+			sf::Uint64                    windowStart;        ///< The index of the first frame of the window
+			sf::Uint64                    frameCount;         ///< The amount of frames of the sound buffer or sample source
+			unsigned int                  channelCount;       ///< The amount of channels
+			unsigned int                  sampleRate;         ///< The sample rate of the sound buffer or sample source
+			VoiceID                       id;                 ///< The voice's identifier
+			sf::Vector3f                  position;           ///< The 3D position of the voice's source
+			float                         volume;             ///< The volume (0 - 100)
+			float                         fadeGain;           ///< The fade gain reached at the end of the last block
+			float                         fadeTarget;         ///< The fade gain reached at the end of the ramp
+			sf::Uint64                    fadeFrames;         ///< The amount of output frames left in the ramp
+			bool                          stopAfterFade;      ///< Is the voice stopped once the ramp ends?
+			float                         pitch;              ///< The pitch
+			float                         attenuation;        ///< The attenuation factor
+			float                         minDistance;        ///< The minimum 3D distance where the voice is heard at full volume
+			bool                          relativeToListener; ///< Is the voice's source relative to the listener?
+			bool                          loop;               ///< Is the voice on loop?
+			sf::SoundSource::Status       status;             ///< The voice's status
+			sf::Uint64                    startFrame;         ///< The frame of the mixer's clock at which the playing voice starts
+			VoiceID                       next;               ///< The voice started on the frame following the end of the voice (0 if none)
+			double                        cursor;             ///< The fractional position in the voice's frames
+			float                         gainLeft;           ///< The left gain applied at the end of the last block
+			float                         gainRight;          ///< The right gain applied at the end of the last block
+			bool                          rendered;           ///< Has the voice been rendered since it started? (its gains can be ramped)
+			SubmixID                      submix;             ///< The submix the voice is routed to (0 for the output)
+			EffectChain*                  effects;            ///< The effects processing the voice's frames (nullptr if none)
+			float                         lowPassCutoff;      ///< The cutoff frequency of the low-pass filter (0 if none)
+			float                         lowPassState[2];    ///< The last output of the low-pass filter for each channel
+			std::vector<sf::Uint64>       markers;            ///< The frames of the markers, sorted
+
+			/// <summary>Constructs the stopped <see cref="Voice"/> by providing its identifier, its amount of frames, channels and frames per second</summary>
+			/// <param name="id">The voice's identifier</param>
+			/// <param name="frameCount">The amount of frames</param>
+			/// <param name="channelCount">The amount of channels</param>
+			/// <param name="sampleRate">The sample rate</param>
+			Voice(VoiceID id, sf::Uint64 frameCount, unsigned int channelCount, unsigned int sampleRate);
+		};
+		/// <summary>Struct used to represent a submix</summary>
+		struct Submix {
+			SubmixID           id;      ///< The submix's identifier
+			SubmixID           parent;  ///< The parent submix (0 for the output)
+			EffectChain*       effects; ///< The effects processing the submix's frames (nullptr if none)
+			std::size_t        depth;   ///< The amount of submixes between the submix and the output
+			std::vector<float> frames;  ///< The frames rendered by the submix
+		};
+		/// <summary>Struct used to represent a marker mixed by a voice</summary>
+		struct MarkerEvent {
+			VoiceID     voice;      ///< The voice that mixed the marker
+			std::size_t index;      ///< The index of the marker in the voice's markers
+			sf::Uint64  clockFrame; ///< The frame of the mixer's clock at which the marker is mixed
+		};
+
+	private:
+		/// <summary>Adds a new <paramref name="voice"/> and gives it an identifier</summary>
+		/// <param name="voice">The voice to add</param>
+		/// <returns>The identifier of the voice</returns>
+		VoiceID addVoice(Voice&& voice);
+		/// <summary>Retrieves the voice associated with the <paramref name="id"/> provided</summary>
+		/// <param name="id">The identifier of the voice</param>
+		/// <returns>The voice, nullptr if it couldn't be found</returns>
+		Voice* findVoice(VoiceID id);
+		/// <summary>Retrieves the voice associated with the <paramref name="id"/> provided</summary>
+		/// <param name="id">The identifier of the voice</param>
+		/// <returns>The voice, nullptr if it couldn't be found</returns>
+		const Voice* findVoice(VoiceID id) const;
+		/// <summary>Retrieves the submix associated with the <paramref name="id"/> provided</summary>
+		/// <param name="id">The identifier of the submix</param>
+		/// <returns>The submix, nullptr if it couldn't be found (or for the output)</returns>
+		Submix* findSubmix(SubmixID id);
+		/// <summary>Sorts the submixes from the deepest to the shallowest so that the children are rendered before their parent</summary>
+		void sortSubmixes();
+		/// <summary>Computes the left and right gains of a <paramref name="voice"/> from its volume, its distance attenuation and its panning</summary>
+		/// <param name="voice">The voice</param>
+		/// <param name="gainLeft">The resulting left gain</param>
+		/// <param name="gainRight">The resulting right gain</param>
+		void computeGains(const Voice& voice, float& gainLeft, float& gainRight) const;
+		/// <summary>
+		/// Retrieves <paramref name="frameCount"/> contiguous frames of a <paramref name="voice"/> starting at the <paramref name="firstFrame"/><para/>
+		///
+		/// Sample sources are read ahead into the voice's window, the frames past the end of the source are silent.
+		/// </summary>
+		/// <param name="voice">The voice</param>
+		/// <param name="firstFrame">The index of the first frame</param>
+		/// <param name="frameCount">The amount of frames (never past the end of the voice)</param>
+		/// <returns>The interleaved samples of the frames</returns>
+		const sf::Int16* fetchFrames(Voice& voice, sf::Uint64 firstFrame, std::size_t frameCount);
+		/// <summary>Starts the voices chained to the voices ending inside the block on the frame following their end</summary>
+		/// <param name="blockStart">The frame of the mixer's clock at which the block starts</param>
+		/// <param name="frameCount">The amount of frames of the block</param>
+		void startChainedVoices(sf::Uint64 blockStart, std::size_t frameCount);
+		/// <summary>Adds the next <paramref name="frameCount"/> frames of the <paramref name="voice"/> to the <paramref name="output"/></summary>
+		/// <param name="voice">The voice to mix</param>
+		/// <param name="output">The interleaved stereo frames accumulating the result</param>
+		/// <param name="frameCount">The amount of frames to mix</param>
+		/// <param name="clockFrame">The frame of the mixer's clock of the first frame mixed</param>
+		void mixVoice(Voice& voice, float* output, std::size_t frameCount, sf::Uint64 clockFrame);
+		/// <summary>Pushes the markers of a <paramref name="voice"/> lying in the source frames about to be mixed from its cursor, wrapping around its end if it loops</summary>
+		/// <param name="voice">The voice being mixed</param>
+		/// <param name="step">The amount of source frames per output frame</param>
+		/// <param name="outputFrames">The amount of output frames mixed</param>
+		/// <param name="clockFrame">The frame of the mixer's clock of the first frame mixed</param>
+		void pushMarkers(const Voice& voice, double step, std::size_t outputFrames, sf::Uint64 clockFrame);
+		/// <summary>Applies the low-pass filter of the <paramref name="voice"/> to its mixed <paramref name="frames"/> in place</summary>
+		/// <param name="voice">The voice whose filter is applied</param>
+		/// <param name="frames">The interleaved stereo frames of the voice</param>
+		/// <param name="frameCount">The amount of frames to filter</param>
+		void filterVoice(Voice& voice, float* frames, std::size_t frameCount) const;
+
+	private:
+		const unsigned int       SAMPLE_RATE;       ///< The output's sample rate
+		std::vector<Voice>       voices_;           ///< The existing voices
+		sf::Vector3f             listenerPosition_; ///< The 3D position of the listener
+		VoiceID                  nextId_;           ///< The identifier given to the next voice
+		std::vector<float>       sourceBlock_;      ///< The converted source frames of the voice being mixed
+		std::vector<float>       resampledBlock_;   ///< The resampled frames of the voice being mixed
+		std::vector<float>       voiceBlock_;       ///< The stereo frames of the voice being processed by its effects
+		std::vector<Submix>      submixes_;         ///< The existing submixes, the deepest first
+		SubmixID                 nextSubmixId_;     ///< The identifier given to the next submix
+		std::atomic<sf::Uint64>  clockFrames_;      ///< The amount of frames rendered since the mixer was created
+		std::atomic<sf::Int64>   lastRenderTime_;   ///< The duration of the last render in microseconds
+		std::atomic<std::size_t> lastVoiceCount_;   ///< The amount of voices mixed by the last render
+		RingBuffer<MarkerEvent>  markerEvents_;     ///< The markers mixed, waiting to be polled
+		mutable std::mutex       mutex_;            ///< Mutex protecting the voices between the game and the audio thread
+	};
+}
+#endif
\ No newline at end of file
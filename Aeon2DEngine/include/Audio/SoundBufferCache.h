@@ -0,0 +1,82 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+
+#ifndef Aeon2D_Audio_SoundBufferCache_H_
+#define Aeon2D_Audio_SoundBufferCache_H_
+
+#include <string>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include <SFML/Audio/SoundBuffer.hpp>
+
+namespace ae
+{
+	/// <summary>
+	/// Reference-counted cache of the sound buffers shared by all the <see cref="SoundPlayer"/>s<para/>
+	///
+	/// A sound file is decoded once, the players loading it again share the same buffer which is destroyed once the last of them unloads it.<br/>
+	/// Buffers are identified by their filepath and by their content, different files with the same samples are therefore stored once.<br/>
+	/// The cache can be used from several threads at once.
+	/// </summary>
+	/// <code>
+	/// std::shared_ptr&lt;const sf::SoundBuffer&gt; buffer = ae::SoundBufferCache::getGlobal().acquire("Assets/Sounds/Click.wav");
+	/// </code>
+	class SoundBufferCache
+	{
+	public:
+		/// <summary>Default constructor</summary>
+		SoundBufferCache();
+		/// <summary>Deleted copy constructor</summary>
+		/// <param name="copy">The <see cref="SoundBufferCache"/> to be copied</param>
+		SoundBufferCache(const SoundBufferCache& copy) = delete;
+	public:
+		/// <summary>Deleted assignment operator</summary>
+		/// <param name="other">The <see cref="SoundBufferCache"/> to be copied</param>
+		/// <returns>The caller <see cref="SoundBufferCache"/></returns>
+		SoundBufferCache& operator=(const SoundBufferCache& other) = delete;
+	public:
+		/// <summary>Retrieves the process-wide cache used by the sound players by default</summary>
+		/// <returns>The global cache</returns>
+		static SoundBufferCache& getGlobal();
+		/// <summary>Retrieves the buffer of the sound file located at the <paramref name="filepath"/> provided, loading it if no one holds it</summary>
+		/// <param name="filepath">The sound file's filepath</param>
+		/// <returns>The shared buffer (released by destroying the last reference), nullptr if the file couldn't be loaded</returns>
+		std::shared_ptr<const sf::SoundBuffer> acquire(const std::string& filepath);
+		/// <summary>Retrieves the amount of buffers held</summary>
+		/// <returns>The amount of buffers</returns>
+		std::size_t getBufferCount() const;
+		/// <summary>Retrieves the memory taken by the samples of the buffers held</summary>
+		/// <returns>The size in bytes</returns>
+		std::size_t getSize() const;
+
+	private:
+		/// <summary>Removes the entries of the buffers that have been released</summary>
+		void prune();
+
+	private:
+		std::unordered_map<std::string, std::weak_ptr<const sf::SoundBuffer>>     paths_;    ///< The buffers by normalized filepath
+		std::unordered_multimap<sf::Uint64, std::weak_ptr<const sf::SoundBuffer>> contents_; ///< The buffers by hash of their samples
+		mutable std::mutex                                                        mutex_;    ///< The mutex protecting the entries
+	};
+}
+#endif
\ No newline at end of file
@@ -21,29 +21,64 @@
 #ifndef Aeon2D_Audio_SoundPlayer_H_
 #define Aeon2D_Audio_SoundPlayer_H_
 
+#include <map>
 #include <list>
+#include <unordered_map>
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include <cmath>
 
-#include <SFML/Audio/Sound.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/Audio/InputSoundFile.hpp>
 
-#include "../Utils/ResourceHolder.h"
+#include "../Utils/DebugLogger.h"
 #include "AudioPlayer.h"
+#include "OcclusionMap.h"
+#include "CompressedSoundBuffer.h"
+#include "DecodedSoundCache.h"
+#include "SoundBufferCache.h"
+#include "FileSampleSource.h"
 
 namespace ae
 {
-	/// <summary>Class that facilitates loading in sound effects, playing them, and generally managing them</summary>
+	/// <summary>
+	/// Class that facilitates loading in sound effects, playing them, and generally managing them<para/>
+	///
+	/// Active sound effects are voices that may either be real (they own a source of the <see cref="AudioBackend"/>) or virtual (they only advance their playback cursor).<br/>
+	/// Only the most important and audible voices are given a real sound source, up to the maximum amount of real voices.<br/>
+	/// Sound effects whose decoded size exceeds the streaming threshold are streamed from their file instead of being loaded in memory.<br/>
+	/// The buffers of the other sound effects are drawn from the global <see cref="SoundBufferCache"/>, a sound file loaded by several sound players is only stored once.
+	/// </summary>
 	/// <param name="T">The ID type (i.e. an enumeration type)</param>
 	template <typename T>
 	class SoundPlayer : public AudioPlayer<T>
 	{
+	public:
+		/// <summary>Handle to an active sound effect returned when playing it (0 is never a valid handle)</summary>
+		using SoundHandle = unsigned int;
+
 	public:
 		/// <summary>
 		/// Default constructor<para/>
 		///
 		/// The global volume is set to 100% and the listener's position to (0, 0, 300).<br/>
-		/// The listener's position is the same for both the <see cref="SoundPlayer"/> and the <see cref="MusicPlayer"/>.
+		/// The listener's position is the same for both the <see cref="SoundPlayer"/> and the <see cref="MusicPlayer"/>.<br/>
+		/// The maximum amount of real voices is set to 128, the audibility threshold to 0.001 (-60dB), the occlusion budget to 500 microseconds and the streaming threshold to 2 MB.
 		/// </summary>
-		SoundPlayer() = default;
+		SoundPlayer();
+		/// <summary>
+		/// Constructs the <see cref="SoundPlayer"/> by providing the <paramref name="backend"/> that will play its sound effects<para/>
+		///
+		/// The maximum amount of real voices is set to the maximum amount of sources of the <paramref name="backend"/>, the audibility threshold to 0.001 (-60dB), the occlusion budget to 500 microseconds and the streaming threshold to 2 MB.<br/>
+		/// The <paramref name="backend"/> must outlive the <see cref="SoundPlayer"/>.
+		/// </summary>
+		/// <param name="backend">The <see cref="AudioBackend"/> that will play the sound effects</param>
+		/// <code>
+		/// ae::SoftwareAudioBackend backend;
+		/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer(backend);
+		/// </code>
+		explicit SoundPlayer(AudioBackend& backend);
 		/// <summary>Deleted copy constructor</summary>
 		/// <param name="copy">The <see cref="SoundPlayer"/> to be copied</param>
 		SoundPlayer(const SoundPlayer<T>& copy) = delete;
@@ -59,6 +94,7 @@ namespace ae
 		/// The sound effect's source will be the position of the listener.
 		/// </summary>
 		/// <param name="id">The id associated with the desired sound effect</param>
+		/// <returns>The handle of the new active sound effect, 0 if it couldn't be played</returns>
 		/// <code>
 		/// enum class SoundID { ID1, ID2, ID3 };
 		/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
@@ -68,10 +104,11 @@ namespace ae
 		/// <seealso cref="pause"/>
 		/// <seealso cref="stop"/>
 		/// <seealso cref="load"/>
-		void play(T id);
+		SoundHandle play(T id);
 		/// <summary>Plays a pre-loaded sound effect by providing a <paramref name="position"/> indicating the sound effect's source, and an <paramref name="id"/> associated with the desired sound effect</summary>
 		/// <param name="position">The position of the sound effect's source</param>
 		/// <param name="id">The id associated with the desired sound effect</param>
+		/// <returns>The handle of the new active sound effect, 0 if it couldn't be played</returns>
 		/// <code>
 		/// enum class SoundID { ID1, ID2, ID3 };
 		/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
@@ -81,7 +118,63 @@ namespace ae
 		/// <seealso cref="pause"/>
 		/// <seealso cref="stop"/>
 		/// <seealso cref="load"/>
-		void play(const sf::Vector2f& position, T id);
+		SoundHandle play(const sf::Vector2f& position, T id);
+		/// <summary>
+		/// Plays a pre-loaded sound effect by providing a <paramref name="position"/> indicating the sound effect's source, an <paramref name="id"/> associated with the desired sound effect, and if it should be on <paramref name="loop"/><para/>
+		///
+		/// Looping sound effects (i.e. ambient sounds) will remain active until they're stopped with <see cref="stopSound"/> or <see cref="stop"/>.
+		/// </summary>
+		/// <param name="position">The position of the sound effect's source</param>
+		/// <param name="id">The id associated with the desired sound effect</param>
+		/// <param name="loop">True to put the sound effect on loop, false otherwise</param>
+		/// <returns>The handle of the new active sound effect, 0 if it couldn't be played</returns>
+		/// <code>
+		/// enum class SoundID { ID1, ID2, ID3 };
+		/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+		/// ...
+		/// ae::SoundPlayer&lt;SoundID&gt;::SoundHandle waterfall = soundPlayer.play(sf::Vector2f(2500.f, 100.f), SoundID::ID3, true);
+		/// </code>
+		/// <seealso cref="stopSound"/>
+		/// <seealso cref="load"/>
+		SoundHandle play(const sf::Vector2f& position, T id, bool loop);
+		/// <summary>
+		/// Plays a pre-loaded sound effect that fades in over a <paramref name="fadeIn"/> duration<para/>
+		///
+		/// The fade is ramped by the audio backend, no call is needed on the game thread while it lasts.
+		/// </summary>
+		/// <param name="position">The position of the sound effect's source</param>
+		/// <param name="id">The id associated with the desired sound effect</param>
+		/// <param name="loop">True to put the sound effect on loop, false otherwise</param>
+		/// <param name="fadeIn">The duration of the fade-in</param>
+		/// <returns>The handle of the new active sound effect, 0 if it couldn't be played</returns>
+		/// <code>
+		/// enum class SoundID { ID1, ID2, ID3 };
+		/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+		/// ...
+		/// ae::SoundPlayer&lt;SoundID&gt;::SoundHandle rain = soundPlayer.play(sf::Vector2f(0.f, 0.f), SoundID::ID2, true, sf::seconds(3.f));
+		/// </code>
+		/// <seealso cref="fadeOutSound"/>
+		/// <seealso cref="crossfadeSound"/>
+		SoundHandle play(const sf::Vector2f& position, T id, bool loop, sf::Time fadeIn);
+		/// <summary>
+		/// Plays a pre-loaded sound effect when the audio clock reaches the <paramref name="clockTime"/> provided<para/>
+		///
+		/// The start is scheduled on the audio backend, a <see cref="SoftwareAudioBackend"/> starts the sound effect on the exact sample.<br/>
+		/// The sound effect is active (and reported as playing) while it waits, a <paramref name="clockTime"/> that has already passed plays it straight away.
+		/// </summary>
+		/// <param name="position">The position of the sound effect's source</param>
+		/// <param name="id">The id associated with the desired sound effect</param>
+		/// <param name="loop">True to put the sound effect on loop, false otherwise</param>
+		/// <param name="clockTime">The time of the audio clock at which the sound effect starts</param>
+		/// <returns>The handle of the new active sound effect, 0 if it couldn't be played</returns>
+		/// <code>
+		/// enum class SoundID { ID1, ID2, ID3 };
+		/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+		/// ...
+		/// soundPlayer.playAt(sf::Vector2f(0.f, 0.f), SoundID::ID1, false, soundPlayer.getAudioClock() + sf::milliseconds(500));
+		/// </code>
+		/// <seealso cref="getAudioClock"/>
+		SoundHandle playAt(const sf::Vector2f& position, T id, bool loop, sf::Time clockTime);
 		/// <summary>
 		/// (Un)Pauses all active sound effects<para/>
 		///
@@ -107,10 +200,248 @@ namespace ae
 		/// <seealso cref="pause"/>
 		/// <seealso cref="play"/>
 		void stop();
+		/// <summary>Stops an active sound effect by providing the <paramref name="handle"/> returned when it was played (the sound effect will be removed)</summary>
+		/// <param name="handle">The handle of the active sound effect to stop</param>
+		/// <code>
+		/// enum class SoundID { ID1, ID2, ID3 };
+		/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+		/// ...
+		/// soundPlayer.stopSound(waterfall);
+		/// </code>
+		/// <seealso cref="stop"/>
+		/// <seealso cref="play"/>
+		void stopSound(SoundHandle handle);
+		/// <summary>
+		/// Fades out all active sound effects over a <paramref name="duration"/>, they're removed once faded out<para/>
+		///
+		/// The fades are ramped by the audio backend, no call is needed on the game thread while they last.
+		/// </summary>
+		/// <param name="duration">The duration of the fade-out</param>
+		/// <code>
+		/// enum class SoundID { ID1, ID2, ID3 };
+		/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+		/// ...
+		/// soundPlayer.fadeOut(sf::seconds(1.f));
+		/// </code>
+		/// <seealso cref="fadeOutSound"/>
+		/// <seealso cref="stop"/>
+		void fadeOut(sf::Time duration);
+		/// <summary>
+		/// Fades out an active sound effect over a <paramref name="duration"/>, it's removed once faded out<para/>
+		///
+		/// The fade is ramped by the audio backend, no call is needed on the game thread while it lasts.
+		/// </summary>
+		/// <param name="handle">The handle of the active sound effect to fade out</param>
+		/// <param name="duration">The duration of the fade-out</param>
+		/// <code>
+		/// enum class SoundID { ID1, ID2, ID3 };
+		/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+		/// ...
+		/// soundPlayer.fadeOutSound(rain, sf::seconds(2.f));
+		/// </code>
+		/// <seealso cref="stopSound"/>
+		/// <seealso cref="crossfadeSound"/>
+		void fadeOutSound(SoundHandle handle, sf::Time duration);
+		/// <summary>
+		/// Fades out an active sound effect while the sound effect associated with the <paramref name="id"/> provided fades in at the same position over a <paramref name="duration"/><para/>
+		///
+		/// The new sound effect is on loop if the faded out one is.
+		/// </summary>
+		/// <param name="handle">The handle of the active sound effect to fade out</param>
+		/// <param name="id">The id associated with the sound effect to fade in</param>
+		/// <param name="duration">The duration of the crossfade</param>
+		/// <returns>The handle of the new active sound effect, 0 if it couldn't be played</returns>
+		/// <code>
+		/// enum class SoundID { ID1, ID2, ID3 };
+		/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+		/// ...
+		/// rain = soundPlayer.crossfadeSound(rain, SoundID::ID3, sf::seconds(4.f));
+		/// </code>
+		/// <seealso cref="fadeOutSound"/>
+		SoundHandle crossfadeSound(SoundHandle handle, T id, sf::Time duration);
+		/// <summary>Sets the <paramref name="position"/> of an active sound effect's source</summary>
+		/// <param name="position">The new position of the sound effect's source</param>
+		/// <param name="handle">The handle of the active sound effect</param>
+		/// <code>
+		/// enum class SoundID { ID1, ID2, ID3 };
+		/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+		/// ...
+		/// soundPlayer.setSoundSourcePosition(campfire.getPosition(), campfireSound);
+		/// </code>
+		void setSoundSourcePosition(const sf::Vector2f& position, SoundHandle handle);
+		/// <summary>
+		/// Sets the <paramref name="effects"/> processing an active sound effect alone (i.e. the occlusion of a source behind a wall)<para/>
+		///
+		/// The effects are only processed by backends mixing in software (i.e. a <see cref="SoftwareAudioBackend"/>).<br/>
+		/// An effect chain keeps the state of a single signal, it shouldn't be shared by several active sound effects.
+		/// </summary>
+		/// <param name="effects">The effect chain (it must outlive the sound effect), nullptr to remove it</param>
+		/// <param name="handle">The handle of the active sound effect</param>
+		/// <code>
+		/// enum class SoundID { ID1, ID2, ID3 };
+		/// ae::BiquadFilter occlusion(ae::BiquadFilter::Type::LowPass, 800.f);
+		/// ae::EffectChain behindWall;
+		/// behindWall.add(occlusion);
+		/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer(backend);
+		/// ...
+		/// soundPlayer.setSoundEffects(&amp;behindWall, waterfall);
+		/// </code>
+		void setSoundEffects(EffectChain* effects, SoundHandle handle);
+		/// <summary>
+		/// Retrieves the status of an active sound effect<para/>
+		///
+		/// Virtual sound effects are reported as playing as they're still advancing.
+		/// </summary>
+		/// <param name="handle">The handle of the active sound effect</param>
+		/// <returns>The status of the sound effect, sf::SoundSource::Status::Stopped if it's no longer active</returns>
+		/// <code>
+		/// enum class SoundID { ID1, ID2, ID3 };
+		/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+		/// ...
+		/// if (soundPlayer.getSoundStatus(waterfall) == sf::SoundSource::Status::Stopped) {
+		///		...
+		/// }
+		/// </code>
+		sf::SoundSource::Status getSoundStatus(SoundHandle handle) const;
+		/// <summary>
+		/// Updates the active sound effects, should be called once per frame<para/>
+		///
+		/// The playback cursor of virtual sound effects is advanced, finished sound effects are removed, their occlusion is updated,
+		/// and the real sound sources are redistributed to the most important and audible sound effects.<br/>
+		/// Sound effects that are promoted to real voices resume at the offset reached while they were virtual.<br/>
+		/// The ducking ramps of the buses the sound effects play on are advanced.
+		/// </summary>
+		/// <code>
+		/// enum class SoundID { ID1, ID2, ID3 };
+		/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+		/// ...
+		/// while (window.isOpen()) {
+		///		soundPlayer.setListenerPosition(player.getPosition());
+		///		soundPlayer.update();
+		///		...
+		/// }
+		/// </code>
+		/// <seealso cref="setMaxRealVoices"/>
+		/// <seealso cref="setAudibilityThreshold"/>
+		void update();
+		/// <summary>
+		/// Sets the maximum amount of sound effects that may own a real sound source at the same time<para/>
+		///
+		/// The remaining active sound effects are virtual and only keep track of their playback cursor.
+		/// </summary>
+		/// <param name="count">The maximum amount of real voices</param>
+		/// <code>
+		/// enum class SoundID { ID1, ID2, ID3 };
+		/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+		/// soundPlayer.setMaxRealVoices(32);
+		/// </code>
+		/// <seealso cref="getMaxRealVoices"/>
+		/// <seealso cref="update"/>
+		void setMaxRealVoices(std::size_t count);
+		/// <summary>Retrieves the maximum amount of sound effects that may own a real sound source at the same time</summary>
+		/// <returns>The maximum amount of real voices</returns>
+		/// <seealso cref="setMaxRealVoices"/>
+		std::size_t getMaxRealVoices() const;
+		/// <summary>
+		/// Sets the gain (0 - 1) under which a sound effect is considered inaudible<para/>
+		///
+		/// The gain is estimated from the sound effect's volume, the gain of its bus, its fade, the distance attenuation and the occlusion by the walls.<br/>
+		/// Inaudible sound effects are never given a real sound source.
+		/// </summary>
+		/// <param name="threshold">The audibility threshold</param>
+		/// <code>
+		/// enum class SoundID { ID1, ID2, ID3 };
+		/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+		/// soundPlayer.setAudibilityThreshold(0.01f); // -40dB
+		/// </code>
+		/// <seealso cref="getAudibilityThreshold"/>
+		void setAudibilityThreshold(float threshold);
+		/// <summary>Retrieves the gain (0 - 1) under which a sound effect is considered inaudible</summary>
+		/// <returns>The audibility threshold</returns>
+		/// <seealso cref="setAudibilityThreshold"/>
+		float getAudibilityThreshold() const;
+		/// <summary>
+		/// Sets the walls muffling the sound effects heard through them, nullptr to stop occluding them<para/>
+		///
+		/// The occlusion of the sound effects is updated by <see cref="update"/> from the listener's position, within the occlusion budget.<br/>
+		/// An occluded sound effect is quieter by the fraction of the sound going through the walls and muffled by a low-pass filter (only by backends mixing in software).<br/>
+		/// The sound effects relative to the listener are never occluded.
+		/// </summary>
+		/// <param name="map">The occlusion map (it must outlive the sound player or be removed first)</param>
+		/// <code>
+		/// enum class SoundID { ID1, ID2, ID3 };
+		/// ae::OcclusionMap occlusion;
+		/// occlusion.addWall(sf::Vector2f(0.f, 0.f), sf::Vector2f(0.f, 500.f), 0.2f);
+		/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+		/// soundPlayer.setOcclusionMap(&amp;occlusion);
+		/// </code>
+		/// <seealso cref="getOcclusionMap"/>
+		/// <seealso cref="setOcclusionBudget"/>
+		void setOcclusionMap(OcclusionMap* map);
+		/// <summary>Retrieves the walls muffling the sound effects heard through them</summary>
+		/// <returns>The occlusion map, nullptr if there's none</returns>
+		/// <seealso cref="setOcclusionMap"/>
+		OcclusionMap* getOcclusionMap() const;
+		/// <summary>
+		/// Sets the time that <see cref="update"/> may spend updating the occlusion of the sound effects<para/>
+		///
+		/// The sound effects are updated in turns, those left once the budget runs out keep their occlusion until the next update.
+		/// </summary>
+		/// <param name="budget">The time budget per update (zero for no limit)</param>
+		/// <code>
+		/// enum class SoundID { ID1, ID2, ID3 };
+		/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+		/// soundPlayer.setOcclusionBudget(sf::microseconds(250));
+		/// </code>
+		/// <seealso cref="getOcclusionBudget"/>
+		void setOcclusionBudget(sf::Time budget);
+		/// <summary>Retrieves the time that <see cref="update"/> may spend updating the occlusion of the sound effects</summary>
+		/// <returns>The time budget per update</returns>
+		/// <seealso cref="setOcclusionBudget"/>
+		sf::Time getOcclusionBudget() const;
+		/// <summary>
+		/// Sets the decoded size above which the sound effects loaded are streamed from their file instead of being loaded in memory<para/>
+		///
+		/// Streamed sound effects only keep a small buffer decoded ahead per active sound effect, capping the memory taken by long sounds (i.e. ambience loops).<br/>
+		/// The threshold only applies to the sound effects loaded afterwards, playing them is unchanged.
+		/// </summary>
+		/// <param name="size">The decoded size in bytes (16-bit samples)</param>
+		/// <code>
+		/// enum class SoundID { ID1, ID2, ID3 };
+		/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+		/// soundPlayer.setStreamingThreshold(512 * 1024);
+		/// soundPlayer.load("Assets/Sounds/Forest.ogg", SoundID::ID1);
+		/// </code>
+		/// <seealso cref="getStreamingThreshold"/>
+		void setStreamingThreshold(std::size_t size);
+		/// <summary>Retrieves the decoded size above which the sound effects loaded are streamed from their file</summary>
+		/// <returns>The decoded size in bytes</returns>
+		/// <seealso cref="setStreamingThreshold"/>
+		std::size_t getStreamingThreshold() const;
+		/// <summary>
+		/// Retrieves the cache of the decoded copies of the compressed sound effects<para/>
+		///
+		/// Its capacity may be adjusted to trade memory for decoding time, the copies played are never evicted.
+		/// </summary>
+		/// <returns>The cache of the decoded copies</returns>
+		/// <code>
+		/// soundPlayer.getDecodedCache().setCapacity(8 * 1024 * 1024);
+		/// </code>
+		/// <seealso cref="loadCompressed"/>
+		DecodedSoundCache& getDecodedCache();
+		/// <summary>Retrieves the amount of active sound effects that own a real sound source</summary>
+		/// <returns>The amount of real voices</returns>
+		/// <seealso cref="getVirtualVoiceCount"/>
+		std::size_t getRealVoiceCount() const;
+		/// <summary>Retrieves the amount of active sound effects that are virtual</summary>
+		/// <returns>The amount of virtual voices</returns>
+		/// <seealso cref="getRealVoiceCount"/>
+		std::size_t getVirtualVoiceCount() const;
 		/// <summary>
 		/// Sets the sound player's global volume (0% - 100%)<para/>
 		///
-		/// A global volume of 50% will reduce the sound player's effects' volume by half of their current volume.
+		/// A global volume of 50% will reduce the sound player's effects' volume by half of their current volume.<br/>
+		/// Only the real voices on the sound player's bus and its sub-buses are updated.
 		/// </summary>
 		/// <param name="globalVolume">The sound player's global volume</param>
 		/// <code>
@@ -120,11 +451,27 @@ namespace ae
 		/// </code>
 		virtual void setGlobalVolume(float globalVolume) override final;
 		/// <summary>
+		/// Routes a loaded-in sound effect to a <paramref name="bus"/> by providing the associated <paramref name="id"/><para/>
+		///
+		/// The sound effects are on the sound player's bus by default, the active sound effects associated with this <paramref name="id"/> are moved to the new <paramref name="bus"/>.
+		/// </summary>
+		/// <param name="bus">The bus of the sound effect (it must outlive the sound player)</param>
+		/// <param name="id">The ID associated with the sound effect</param>
+		/// <code>
+		/// enum class SoundID { ID1, ID2, ID3 };
+		/// ae::AudioBus ui;
+		/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+		/// ui.setParent(&amp;soundPlayer.getBus());
+		/// soundPlayer.setBus(ui, SoundID::ID1);
+		/// </code>
+		void setBus(AudioBus& bus, T id);
+		/// <summary>
 		/// Loads in a sound effect by providing a <paramref name="filepath"/> and an <paramref name="id"/> to associate it with<para/>
 		///
 		/// The <see cref="AudioProperties"/> of the sound effect will be those by default.<para/>
 		///
-		/// Only sound effects with one channel (mono sounds) can be spatialized.
+		/// Only sound effects with one channel (mono sounds) can be spatialized.<br/>
+		/// The sound effect is streamed from its file if its decoded size exceeds the streaming threshold, otherwise its buffer is shared with the other sound players that loaded it.
 		/// </summary>
 		/// <param name="filepath">The sound effect's filepath</param>
 		/// <param name="id">An ID with which to associate the sound effect (i.e. an enum value)</param>
@@ -139,7 +486,8 @@ namespace ae
 		/// <summary>
 		/// Loads in a sound effect by providing a <paramref name="filepath"/>, an <see cref="AudioProperties"/> that contain the sound effect's properties, and an <paramref name="id"/> to associate it with<para/>
 		///
-		/// Only sound effects with one channel (mono sounds) can be spatialized.
+		/// Only sound effects with one channel (mono sounds) can be spatialized.<br/>
+		/// The sound effect is streamed from its file if its decoded size exceeds the streaming threshold, otherwise its buffer is shared with the other sound players that loaded it.
 		/// </summary>
 		/// <param name="filepath">The sound effect's filepath</param>
 		/// <param name="properties">The <see cref="AudioProperties"/> that contain the sound effect's properties</param>
@@ -153,6 +501,38 @@ namespace ae
 		/// <seealso cref="play"/>
 		virtual void load(const std::string& filepath, const AudioProperties& properties, T id) override final;
 		/// <summary>
+		/// Loads in a sound effect by providing a <paramref name="filepath"/> and an <paramref name="id"/> to associate it with, keeping it compressed in memory<para/>
+		///
+		/// The sound effect takes about a fourth of its decoded size, it's decoded when played and its decoded copy is kept in the decoded cache while it's used.<br/>
+		/// The <see cref="AudioProperties"/> of the sound effect will be those by default.
+		/// </summary>
+		/// <param name="filepath">The sound effect's filepath</param>
+		/// <param name="id">An ID with which to associate the sound effect (i.e. an enum value)</param>
+		/// <code>
+		/// enum class SoundID { ID1, ID2, ID3 };
+		/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+		/// soundPlayer.loadCompressed("Assets/Sounds/Ambience.wav", SoundID::ID1);
+		/// </code>
+		/// <seealso cref="load"/>
+		/// <seealso cref="getDecodedCache"/>
+		void loadCompressed(const std::string& filepath, T id);
+		/// <summary>
+		/// Loads in a sound effect by providing a <paramref name="filepath"/>, an <see cref="AudioProperties"/> that contain the sound effect's properties, and an <paramref name="id"/> to associate it with, keeping it compressed in memory<para/>
+		///
+		/// The sound effect takes about a fourth of its decoded size, it's decoded when played and its decoded copy is kept in the decoded cache while it's used.
+		/// </summary>
+		/// <param name="filepath">The sound effect's filepath</param>
+		/// <param name="properties">The <see cref="AudioProperties"/> that contain the sound effect's properties</param>
+		/// <param name="id">An ID with which to associate the sound effect (i.e. an enum value)</param>
+		/// <code>
+		/// enum class SoundID { ID1, ID2, ID3 };
+		/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+		/// soundPlayer.loadCompressed("Assets/Sounds/Ambience.wav", ae::AudioProperties(100.f, 35.f, 1.f, 250.f), SoundID::ID1);
+		/// </code>
+		/// <seealso cref="load"/>
+		/// <seealso cref="getDecodedCache"/>
+		void loadCompressed(const std::string& filepath, const AudioProperties& properties, T id);
+		/// <summary>
 		/// Unloads a loaded-in sound effect by providing the associated <paramref name="id"/><para/>
 		///
 		/// The sound effects associated with this <paramref name="id"/> that are currently being played will be removed.
@@ -166,6 +546,60 @@ namespace ae
 		/// </code>
 		/// <seealso cref="load"/>
 		virtual void unload(T id) override final;
+	private:
+		/// <summary>Struct used to represent a sound effect streamed from its file</summary>
+		struct SoundStream {
+			std::string filepath; ///< The sound effect's filepath
+			sf::Time    duration; ///< The sound effect's duration
+		};
+		/// <summary>Struct used to represent an active sound effect (a real or virtual voice)</summary>
+		struct SoundEffect {
+			AudioBackend*                backend;    ///< The audio backend playing the sound effect
+			AudioBus*                    bus;        ///< The bus of the sound effect
+			AudioBackend::SourceID       source;     ///< The backend's source (0 if the voice is virtual)
+			const sf::SoundBuffer*       buffer;     ///< The sound effect's buffer (nullptr if it's streamed)
+			const std::string*           filepath;   ///< The file of the streamed sound effect (nullptr if it's played from its buffer)
+			sf::Time                     duration;   ///< The sound effect's duration
+			const AudioProperties*       properties; ///< The sound effect's properties
+			sf::Vector2f                 position;   ///< The position of the sound effect's source
+			sf::Time                     offset;     ///< The playback cursor while the voice is virtual
+			sf::Time                     startTime;  ///< The time of the audio clock at which the scheduled sound effect starts (zero once started)
+			EffectChain*                 effects;    ///< The effects processing the sound effect alone (nullptr if none)
+			DecodedSoundCache*           cache;      ///< The cache holding the decoded copy of the compressed sound effect (nullptr if it isn't compressed)
+			const CompressedSoundBuffer* compressed; ///< The compressed sound effect whose decoded copy is played (nullptr if it isn't compressed)
+			float                        audibility; ///< The estimated gain heard by the listener
+			float                        occlusion;  ///< The fraction of the sound going through the walls to the listener (1 if unoccluded)
+			std::size_t                  underruns;  ///< The underruns of the sound effect's stream already counted
+			float                        fadeGain;   ///< The fade gain (0 - 1), estimated on the game side for the real voices
+			float                        fadeTarget; ///< The fade gain reached at the end of the fade
+			sf::Time                     fadeLeft;   ///< The duration left in the fade
+			bool                         fadeStop;   ///< Is the sound effect removed once the fade ends?
+			SoundHandle                  handle;     ///< The handle returned to the user
+			T                            id;         ///< The ID associated with the sound effect
+			bool                         loop;       ///< Is the sound effect on loop?
+			bool                         paused;     ///< Is the sound effect paused?
+			bool                         finished;   ///< Has the virtual voice reached its end?
+
+			/// <summary>Constructs the virtual <see cref="SoundEffect"/> by providing the audio backend, its bus, a sound buffer, the sound effect's properties, its position, its ID, its handle and if it's on loop</summary>
+			/// <param name="backend">The audio backend playing the sound effect</param>
+			/// <param name="bus">The bus of the sound effect</param>
+			/// <param name="buffer">The sound effect's buffer (nullptr if it's streamed)</param>
+			/// <param name="properties">The sound effect's properties</param>
+			/// <param name="position">The position of the sound effect's source</param>
+			/// <param name="id">The ID with which the sound effect will be associated with</param>
+			/// <param name="handle">The handle returned to the user</param>
+			/// <param name="loop">True if the sound effect is on loop, false otherwise</param>
+			SoundEffect(AudioBackend& backend, AudioBus& bus, const sf::SoundBuffer* buffer, const AudioProperties& properties,
+			            const sf::Vector2f& position, T id, SoundHandle handle, bool loop);
+			/// <summary>Detaches the sound effect's source from its bus, destroys it and releases the decoded copy of the compressed sound effect</summary>
+			~SoundEffect();
+			/// <summary>Checks if the sound effect is a real voice (it owns a source of the audio backend)</summary>
+			/// <returns>True if the sound effect is a real voice, false if it's virtual</returns>
+			bool isReal() const;
+		};
+		/// <summary>The position of an active sound effect in the list of the active sound effects</summary>
+		using SoundIterator = typename std::list<SoundEffect>::iterator;
+
 	private:
 		/// <summary>
 		/// Removes all stopped sound effects<para/>
@@ -173,22 +607,104 @@ namespace ae
 		/// This method is called every time a new sound effect is played.
 		/// </summary>
 		void removeStoppedSounds();
+		/// <summary>Removes an active sound <paramref name="effect"/>, dropping its handle from the index and its real voice from the count</summary>
+		/// <param name="effect">The active sound effect to remove</param>
+		/// <returns>The active sound effect following the one removed</returns>
+		SoundIterator removeSound(SoundIterator effect);
+		/// <summary>
+		/// Advances the playback cursor of the virtual voices and the fades of all voices by the time elapsed since the last call<para/>
+		///
+		/// The time elapsed is measured on the audio clock, the virtual voices thus stay in step with the mix even when it's rendered faster than real time.<br/>
+		/// Virtual voices that aren't on loop are flagged as finished once they reach their end (or the end of their fade-out).<br/>
+		/// The fades of the real voices are ramped by the audio backend, their progress is only kept to hand them over when they're demoted.<br/>
+		/// Scheduled voices don't advance until the audio clock reaches their start time.
+		/// </summary>
+		void advanceVirtualVoices();
+		/// <summary>
+		/// Computes the occlusion of the spatialized sound effects, starting after the last one updated, until the occlusion budget runs out<para/>
+		///
+		/// The real voices whose occlusion changed noticeably are updated straight away.
+		/// </summary>
+		void updateOcclusion();
+		/// <summary>Applies the occlusion of the real sound <paramref name="effect"/> to its volume and to its low-pass filter</summary>
+		/// <param name="effect">The real sound effect</param>
+		void applyOcclusion(SoundEffect& effect);
+		/// <summary>Constructs a new active sound effect and gives it a real sound source straight away if one is available and if it can be heard</summary>
+		/// <param name="position">The position of the sound effect's source</param>
+		/// <param name="id">The id associated with the desired sound effect</param>
+		/// <param name="loop">True to put the sound effect on loop, false otherwise</param>
+		/// <param name="fadeIn">The duration of the fade-in (zero to play it at full volume straight away)</param>
+		/// <param name="clockTime">The time of the audio clock at which the sound effect starts (zero to start it straight away)</param>
+		/// <returns>The handle of the new active sound effect, 0 if it couldn't be played</returns>
+		SoundHandle startSound(const sf::Vector2f& position, T id, bool loop, sf::Time fadeIn, sf::Time clockTime);
+		/// <summary>Retrieves the active sound effect associated with the <paramref name="handle"/> provided</summary>
+		/// <param name="handle">The handle of the active sound effect</param>
+		/// <returns>The active sound effect, nullptr if it couldn't be found</returns>
+		SoundEffect* findSound(SoundHandle handle);
+		/// <summary>Retrieves the active sound effect associated with the <paramref name="handle"/> provided</summary>
+		/// <param name="handle">The handle of the active sound effect</param>
+		/// <returns>The active sound effect, nullptr if it couldn't be found</returns>
+		const SoundEffect* findSound(SoundHandle handle) const;
+		/// <summary>
+		/// Estimates the gain (0 - 1) at which the listener hears the sound <paramref name="effect"/><para/>
+		///
+		/// The estimation follows the inverse distance clamped model used by the audio backend and includes the occlusion by the walls.
+		/// </summary>
+		/// <param name="effect">The active sound effect</param>
+		/// <returns>The estimated gain</returns>
+		float computeAudibility(const SoundEffect& effect) const;
+		/// <summary>Starts fading out the sound <paramref name="effect"/>, it's removed once faded out</summary>
+		/// <param name="effect">The active sound effect</param>
+		/// <param name="duration">The duration of the fade-out</param>
+		void startFadeOut(SoundEffect& effect, sf::Time duration);
+		/// <summary>Gives a real sound source to the virtual sound <paramref name="effect"/>, starting at its current playback cursor</summary>
+		/// <param name="effect">The virtual sound effect to promote</param>
+		/// <seealso cref="demote"/>
+		void promote(SoundEffect& effect);
+		/// <summary>Releases the real sound source of the sound <paramref name="effect"/>, keeping its playback cursor</summary>
+		/// <param name="effect">The real sound effect to demote</param>
+		/// <seealso cref="promote"/>
+		void demote(SoundEffect& effect);
+		/// <summary>
+		/// Folds the gain bringing a sound effect to the target loudness into its volume, measuring its loudness unless the loudness cache knows it<para/>
+		///
+		/// The <paramref name="properties"/> are returned unchanged if the loudness normalization is disabled.
+		/// </summary>
+		/// <param name="filepath">The sound effect's filepath</param>
+		/// <param name="buffer">The sound effect's buffer (nullptr to measure it from its file)</param>
+		/// <param name="properties">The sound effect's properties</param>
+		/// <returns>The properties played</returns>
+		AudioProperties normalizeLoudness(const std::string& filepath, const sf::SoundBuffer* buffer, const AudioProperties& properties);
+		/// <summary>Accumulates the underruns of the stream of the real sound <paramref name="effect"/> since they were last counted</summary>
+		/// <param name="effect">The real sound effect</param>
+		/// <param name="fill">The fill level (0 - 1) of the stream's buffer</param>
+		/// <returns>True if the stream reports its buffer, false otherwise</returns>
+		bool countUnderruns(SoundEffect& effect, float& fill);
+		/// <summary>Fills in the voice counts and the state of the streamed sound effects, and accumulates the underruns of their streams</summary>
+		/// <param name="stats">The sound player's statistics</param>
+		virtual void collectStats(AudioStats& stats) override final;
 
 	private:
-		/// <summary>Struct used to represent a sound effect</summary>
-		struct SoundEffect {
-			sf::Sound sound; ///< The sf::Sound object
-			T         id;    ///< The ID associated with the sound effect
-
-			/// <summary>Constructs the <see cref="SoundEffect"/> by providing a sound buffer and an ID</summary>
-			/// <param name="buffer">The sound effect's buffer</param>
-			/// <param name="id">The ID with which the sound effect will be associated with</param>
-			SoundEffect(const sf::SoundBuffer& buffer, T id);
-		};
-	private:
-		SoundBufferHolder<T>         soundBuffers_;    ///< The loaded-in sound effects' buffers
-		std::map<T, AudioProperties> soundProperties_; ///< The loaded-in sound effects' properties
-		std::list<SoundEffect>       sounds_;          ///< The list of all active sound effects
+		std::map<T, std::shared_ptr<const sf::SoundBuffer>> soundBuffers_;        ///< The loaded-in sound effects' buffers, shared through the global buffer cache
+		std::map<T, AudioProperties>                        soundProperties_;     ///< The loaded-in sound effects' properties
+		std::map<T, AudioBus*>                              soundBuses_;          ///< The buses of the sound effects that aren't on the sound player's bus
+		std::map<T, std::unique_ptr<CompressedSoundBuffer>> compressedBuffers_;   ///< The sound effects kept compressed in memory
+		DecodedSoundCache                                   decodedCache_;        ///< The decoded copies of the compressed sound effects played
+		std::map<T, SoundStream>                            soundStreams_;        ///< The sound effects streamed from their file
+		std::size_t                                         streamingThreshold_;  ///< The decoded size above which the sound effects loaded are streamed
+		std::list<SoundEffect>                              sounds_;              ///< The list of all active sound effects
+		std::unordered_map<SoundHandle, SoundIterator>      soundIndex_;          ///< The active sound effect of each handle
+		std::size_t                                         realVoices_;          ///< The amount of active sound effects owning a real sound source
+		sf::Time                                            virtualClock_;        ///< The audio clock's time at which the virtual voices were last advanced
+		std::size_t                                         maxRealVoices_;       ///< The maximum amount of real voices
+		float                                               audibilityThreshold_; ///< The gain under which a sound effect is inaudible
+		OcclusionMap*                                       occlusionMap_;        ///< The walls occluding the sound effects (nullptr if none)
+		sf::Time                                            occlusionBudget_;     ///< The time available to update the occlusion per update
+		std::size_t                                         occlusionCursor_;     ///< The turn of the next sound effect whose occlusion is updated
+		std::vector<SoundEffect*>                           occluded_;            ///< The sound effects whose occlusion is being updated
+		std::vector<sf::Vector2f>                           occludedPositions_;   ///< The positions of the sound effects whose occlusion is being updated
+		std::vector<float>                                  transmissions_;       ///< The occlusion computed for the sound effects being updated
+		SoundHandle                                         nextHandle_;          ///< The handle given to the next sound effect played
 	};
 }
 #include "SoundPlayer.inl"
@@ -20,12 +20,83 @@
 
 namespace ae
 {
+	/// <summary>
+	/// Default constructor<para/>
+	///
+	/// The global volume is set to 100% and the listener's position to (0, 0, 300).<br/>
+	/// The listener's position is the same for both the <see cref="SoundPlayer"/> and the <see cref="MusicPlayer"/>.<br/>
+	/// The maximum amount of real voices is set to 128, the audibility threshold to 0.001 (-60dB), the occlusion budget to 500 microseconds and the streaming threshold to 2 MB.
+	/// </summary>
+	template <typename T>
+	SoundPlayer<T>::SoundPlayer()
+		: AudioPlayer<T>()
+		, soundBuffers_()
+		, soundProperties_()
+		, soundBuses_()
+		, compressedBuffers_()
+		, decodedCache_()
+		, soundStreams_()
+		, streamingThreshold_(2 * 1024 * 1024)
+		, sounds_()
+		, soundIndex_()
+		, realVoices_(0)
+		, virtualClock_(AudioPlayer<T>::getAudioClock())
+		, maxRealVoices_(128)
+		, audibilityThreshold_(0.001f)
+		, occlusionMap_(nullptr)
+		, occlusionBudget_(sf::microseconds(500))
+		, occlusionCursor_(0)
+		, occluded_()
+		, occludedPositions_()
+		, transmissions_()
+		, nextHandle_(1)
+	{
+	}
+
+	/// <summary>
+	/// Constructs the <see cref="SoundPlayer"/> by providing the <paramref name="backend"/> that will play its sound effects<para/>
+	///
+	/// The maximum amount of real voices is set to the maximum amount of sources of the <paramref name="backend"/>, the audibility threshold to 0.001 (-60dB), the occlusion budget to 500 microseconds and the streaming threshold to 2 MB.<br/>
+	/// The <paramref name="backend"/> must outlive the <see cref="SoundPlayer"/>.
+	/// </summary>
+	/// <param name="backend">The <see cref="AudioBackend"/> that will play the sound effects</param>
+	/// <code>
+	/// ae::SoftwareAudioBackend backend;
+	/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer(backend);
+	/// </code>
+	template <typename T>
+	SoundPlayer<T>::SoundPlayer(AudioBackend& backend)
+		: AudioPlayer<T>(backend)
+		, soundBuffers_()
+		, soundProperties_()
+		, soundBuses_()
+		, compressedBuffers_()
+		, decodedCache_()
+		, soundStreams_()
+		, streamingThreshold_(2 * 1024 * 1024)
+		, sounds_()
+		, soundIndex_()
+		, realVoices_(0)
+		, virtualClock_(AudioPlayer<T>::getAudioClock())
+		, maxRealVoices_(backend.getMaxSources())
+		, audibilityThreshold_(0.001f)
+		, occlusionMap_(nullptr)
+		, occlusionBudget_(sf::microseconds(500))
+		, occlusionCursor_(0)
+		, occluded_()
+		, occludedPositions_()
+		, transmissions_()
+		, nextHandle_(1)
+	{
+	}
+
 	/// <summary>
 	/// Plays a pre-loaded sound effect by providing an <paramref name="id"/> associated with the desired sound effect<para/>
 	///
 	/// The sound effect's source will be the position of the listener.
 	/// </summary>
 	/// <param name="id">The id associated with the desired sound effect</param>
+	/// <returns>The handle of the new active sound effect, 0 if it couldn't be played</returns>
 	/// <code>
 	/// enum class SoundID { ID1, ID2, ID3 };
 	/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
@@ -36,14 +107,15 @@ namespace ae
 	/// <seealso cref="stop"/>
 	/// <seealso cref="load"/>
 	template <typename T>
-	void SoundPlayer<T>::play(T id)
+	typename SoundPlayer<T>::SoundHandle SoundPlayer<T>::play(T id)
 	{
-		play(AudioPlayer<T>::getListenerPosition(), id);
+		return play(AudioPlayer<T>::getListenerPosition(), id, false);
 	}
 
 	/// <summary>Plays a pre-loaded sound effect by providing a <paramref name="position"/> indicating the sound effect's source, and an <paramref name="id"/> associated with the desired sound effect</summary>
 	/// <param name="position">The position of the sound effect's source</param>
 	/// <param name="id">The id associated with the desired sound effect</param>
+	/// <returns>The handle of the new active sound effect, 0 if it couldn't be played</returns>
 	/// <code>
 	/// enum class SoundID { ID1, ID2, ID3 };
 	/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
@@ -54,31 +126,80 @@ namespace ae
 	/// <seealso cref="stop"/>
 	/// <seealso cref="load"/>
 	template <typename T>
-	void SoundPlayer<T>::play(const sf::Vector2f& position, T id)
+	typename SoundPlayer<T>::SoundHandle SoundPlayer<T>::play(const sf::Vector2f& position, T id)
 	{
-		// Remove all stopped sound effects before playing the new one
-		removeStoppedSounds();
+		return play(position, id, false);
+	}
 
-		// Construct the new sound effect
-#ifdef _DEBUG
-		auto found = soundProperties_.find(id);
-		if (found == soundProperties_.end()) {
-			DebugLogger::cacheMessage("ae::SoundPlayer<T>::play - Unable to find sound effect");
-			return;
-		}
-		const AudioProperties& props = found->second;
-#else
-		const AudioProperties& props = soundProperties_.find(id)->second;
-#endif
-		sounds_.emplace_back(*soundBuffers_.get(id), id);
-		SoundEffect& effect = sounds_.back();
-		effect.sound.setPosition(position.x, -position.y, 0.f);
-		effect.sound.setVolume(AudioPlayer<T>::getGlobalVolume() * props.getVolume() / 100.f);
-		effect.sound.setAttenuation(props.getAttenuation());
-		effect.sound.setPitch(props.getPitch());
-		effect.sound.setMinDistance(props.getMinDistance3D());
-		effect.sound.setRelativeToListener(props.isRelativeToListener());
-		effect.sound.play();
+	/// <summary>
+	/// Plays a pre-loaded sound effect by providing a <paramref name="position"/> indicating the sound effect's source, an <paramref name="id"/> associated with the desired sound effect, and if it should be on <paramref name="loop"/><para/>
+	///
+	/// Looping sound effects (i.e. ambient sounds) will remain active until they're stopped with <see cref="stopSound"/> or <see cref="stop"/>.
+	/// </summary>
+	/// <param name="position">The position of the sound effect's source</param>
+	/// <param name="id">The id associated with the desired sound effect</param>
+	/// <param name="loop">True to put the sound effect on loop, false otherwise</param>
+	/// <returns>The handle of the new active sound effect, 0 if it couldn't be played</returns>
+	/// <code>
+	/// enum class SoundID { ID1, ID2, ID3 };
+	/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+	/// ...
+	/// ae::SoundPlayer&lt;SoundID&gt;::SoundHandle waterfall = soundPlayer.play(sf::Vector2f(2500.f, 100.f), SoundID::ID3, true);
+	/// </code>
+	/// <seealso cref="stopSound"/>
+	/// <seealso cref="load"/>
+	template <typename T>
+	typename SoundPlayer<T>::SoundHandle SoundPlayer<T>::play(const sf::Vector2f& position, T id, bool loop)
+	{
+		return play(position, id, loop, sf::Time::Zero);
+	}
+
+	/// <summary>
+	/// Plays a pre-loaded sound effect that fades in over a <paramref name="fadeIn"/> duration<para/>
+	///
+	/// The fade is ramped by the audio backend, no call is needed on the game thread while it lasts.
+	/// </summary>
+	/// <param name="position">The position of the sound effect's source</param>
+	/// <param name="id">The id associated with the desired sound effect</param>
+	/// <param name="loop">True to put the sound effect on loop, false otherwise</param>
+	/// <param name="fadeIn">The duration of the fade-in</param>
+	/// <returns>The handle of the new active sound effect, 0 if it couldn't be played</returns>
+	/// <code>
+	/// enum class SoundID { ID1, ID2, ID3 };
+	/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+	/// ...
+	/// ae::SoundPlayer&lt;SoundID&gt;::SoundHandle rain = soundPlayer.play(sf::Vector2f(0.f, 0.f), SoundID::ID2, true, sf::seconds(3.f));
+	/// </code>
+	/// <seealso cref="fadeOutSound"/>
+	/// <seealso cref="crossfadeSound"/>
+	template <typename T>
+	typename SoundPlayer<T>::SoundHandle SoundPlayer<T>::play(const sf::Vector2f& position, T id, bool loop, sf::Time fadeIn)
+	{
+		return startSound(position, id, loop, fadeIn, sf::Time::Zero);
+	}
+
+	/// <summary>
+	/// Plays a pre-loaded sound effect when the audio clock reaches the <paramref name="clockTime"/> provided<para/>
+	///
+	/// The start is scheduled on the audio backend, a <see cref="SoftwareAudioBackend"/> starts the sound effect on the exact sample.<br/>
+	/// The sound effect is active (and reported as playing) while it waits, a <paramref name="clockTime"/> that has already passed plays it straight away.
+	/// </summary>
+	/// <param name="position">The position of the sound effect's source</param>
+	/// <param name="id">The id associated with the desired sound effect</param>
+	/// <param name="loop">True to put the sound effect on loop, false otherwise</param>
+	/// <param name="clockTime">The time of the audio clock at which the sound effect starts</param>
+	/// <returns>The handle of the new active sound effect, 0 if it couldn't be played</returns>
+	/// <code>
+	/// enum class SoundID { ID1, ID2, ID3 };
+	/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+	/// ...
+	/// soundPlayer.playAt(sf::Vector2f(0.f, 0.f), SoundID::ID1, false, soundPlayer.getAudioClock() + sf::milliseconds(500));
+	/// </code>
+	/// <seealso cref="getAudioClock"/>
+	template <typename T>
+	typename SoundPlayer<T>::SoundHandle SoundPlayer<T>::playAt(const sf::Vector2f& position, T id, bool loop, sf::Time clockTime)
+	{
+		return startSound(position, id, loop, sf::Time::Zero, clockTime);
 	}
 
 	/// <summary>
@@ -98,13 +219,19 @@ namespace ae
 	template <typename T>
 	void SoundPlayer<T>::pause(bool flag)
 	{
-		if (flag)
-			for (SoundEffect& effect : sounds_)
-				effect.sound.pause();
-		else
-			for (SoundEffect& effect : sounds_)
-				if (effect.sound.getStatus() == sf::SoundSource::Status::Paused)
-					effect.sound.play();
+		// Bring the virtual voices' cursors up to date so that the paused time isn't accounted for
+		advanceVirtualVoices();
+
+		AudioBackend& backend = AudioPlayer<T>::getBackend();
+		for (SoundEffect& effect : sounds_) {
+			if (flag && !effect.paused && effect.isReal())
+				backend.pause(effect.source);
+			else if (!flag && effect.paused && effect.isReal() && effect.startTime > sf::Time::Zero)
+				backend.playAt(effect.source, effect.startTime);
+			else if (!flag && effect.paused && effect.isReal())
+				backend.play(effect.source);
+			effect.paused = flag;
+		}
 	}
 
 	/// <summary>Stops all active sound effects (the sound effects will be removed)</summary>
@@ -118,17 +245,466 @@ namespace ae
 	/// <seealso cref="play"/>
 	template <typename T>
 	void SoundPlayer<T>::stop()
+	{
+		sounds_.clear();
+		soundIndex_.clear();
+		realVoices_ = 0;
+	}
+
+	/// <summary>Stops an active sound effect by providing the <paramref name="handle"/> returned when it was played (the sound effect will be removed)</summary>
+	/// <param name="handle">The handle of the active sound effect to stop</param>
+	/// <code>
+	/// enum class SoundID { ID1, ID2, ID3 };
+	/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+	/// ...
+	/// soundPlayer.stopSound(waterfall);
+	/// </code>
+	/// <seealso cref="stop"/>
+	/// <seealso cref="play"/>
+	template <typename T>
+	void SoundPlayer<T>::stopSound(SoundHandle handle)
+	{
+		auto found = soundIndex_.find(handle);
+		if (found != soundIndex_.end())
+			removeSound(found->second);
+	}
+
+	/// <summary>
+	/// Fades out all active sound effects over a <paramref name="duration"/>, they're removed once faded out<para/>
+	///
+	/// The fades are ramped by the audio backend, no call is needed on the game thread while they last.
+	/// </summary>
+	/// <param name="duration">The duration of the fade-out</param>
+	/// <code>
+	/// enum class SoundID { ID1, ID2, ID3 };
+	/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+	/// ...
+	/// soundPlayer.fadeOut(sf::seconds(1.f));
+	/// </code>
+	/// <seealso cref="fadeOutSound"/>
+	/// <seealso cref="stop"/>
+	template <typename T>
+	void SoundPlayer<T>::fadeOut(sf::Time duration)
 	{
 		for (SoundEffect& effect : sounds_)
-			effect.sound.stop();
+			startFadeOut(effect, duration);
+	}
 
+	/// <summary>
+	/// Fades out an active sound effect over a <paramref name="duration"/>, it's removed once faded out<para/>
+	///
+	/// The fade is ramped by the audio backend, no call is needed on the game thread while it lasts.
+	/// </summary>
+	/// <param name="handle">The handle of the active sound effect to fade out</param>
+	/// <param name="duration">The duration of the fade-out</param>
+	/// <code>
+	/// enum class SoundID { ID1, ID2, ID3 };
+	/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+	/// ...
+	/// soundPlayer.fadeOutSound(rain, sf::seconds(2.f));
+	/// </code>
+	/// <seealso cref="stopSound"/>
+	/// <seealso cref="crossfadeSound"/>
+	template <typename T>
+	void SoundPlayer<T>::fadeOutSound(SoundHandle handle, sf::Time duration)
+	{
+		SoundEffect* effect = findSound(handle);
+		if (!effect) {
+#ifdef _DEBUG
+			DebugLogger::cacheMessage("ae::SoundPlayer<T>::fadeOutSound - Unable to find active sound effect");
+#endif
+			return;
+		}
+
+		startFadeOut(*effect, duration);
+	}
+
+	/// <summary>
+	/// Fades out an active sound effect while the sound effect associated with the <paramref name="id"/> provided fades in at the same position over a <paramref name="duration"/><para/>
+	///
+	/// The new sound effect is on loop if the faded out one is.
+	/// </summary>
+	/// <param name="handle">The handle of the active sound effect to fade out</param>
+	/// <param name="id">The id associated with the sound effect to fade in</param>
+	/// <param name="duration">The duration of the crossfade</param>
+	/// <returns>The handle of the new active sound effect, 0 if it couldn't be played</returns>
+	/// <code>
+	/// enum class SoundID { ID1, ID2, ID3 };
+	/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+	/// ...
+	/// rain = soundPlayer.crossfadeSound(rain, SoundID::ID3, sf::seconds(4.f));
+	/// </code>
+	/// <seealso cref="fadeOutSound"/>
+	template <typename T>
+	typename SoundPlayer<T>::SoundHandle SoundPlayer<T>::crossfadeSound(SoundHandle handle, T id, sf::Time duration)
+	{
+		const SoundEffect* effect = findSound(handle);
+		if (!effect) {
+#ifdef _DEBUG
+			DebugLogger::cacheMessage("ae::SoundPlayer<T>::crossfadeSound - Unable to find active sound effect");
+#endif
+			return 0;
+		}
+
+		const sf::Vector2f POSITION = effect->position;
+		const bool LOOP = effect->loop;
+		fadeOutSound(handle, duration);
+
+		return play(POSITION, id, LOOP, duration);
+	}
+
+	/// <summary>Sets the <paramref name="position"/> of an active sound effect's source</summary>
+	/// <param name="position">The new position of the sound effect's source</param>
+	/// <param name="handle">The handle of the active sound effect</param>
+	/// <code>
+	/// enum class SoundID { ID1, ID2, ID3 };
+	/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+	/// ...
+	/// soundPlayer.setSoundSourcePosition(campfire.getPosition(), campfireSound);
+	/// </code>
+	template <typename T>
+	void SoundPlayer<T>::setSoundSourcePosition(const sf::Vector2f& position, SoundHandle handle)
+	{
+		SoundEffect* effect = findSound(handle);
+		if (!effect) {
+#ifdef _DEBUG
+			DebugLogger::cacheMessage("ae::SoundPlayer<T>::setSoundSourcePosition - Unable to find active sound effect");
+#endif
+			return;
+		}
+
+		effect->position = position;
+		if (effect->isReal())
+			AudioPlayer<T>::getBackend().setPosition(effect->source, sf::Vector3f(position.x, -position.y, 0.f));
+	}
+
+	/// <summary>
+	/// Sets the <paramref name="effects"/> processing an active sound effect alone (i.e. the occlusion of a source behind a wall)<para/>
+	///
+	/// The effects are only processed by backends mixing in software (i.e. a <see cref="SoftwareAudioBackend"/>).<br/>
+	/// An effect chain keeps the state of a single signal, it shouldn't be shared by several active sound effects.
+	/// </summary>
+	/// <param name="effects">The effect chain (it must outlive the sound effect), nullptr to remove it</param>
+	/// <param name="handle">The handle of the active sound effect</param>
+	/// <code>
+	/// enum class SoundID { ID1, ID2, ID3 };
+	/// ae::BiquadFilter occlusion(ae::BiquadFilter::Type::LowPass, 800.f);
+	/// ae::EffectChain behindWall;
+	/// behindWall.add(occlusion);
+	/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer(backend);
+	/// ...
+	/// soundPlayer.setSoundEffects(&amp;behindWall, waterfall);
+	/// </code>
+	template <typename T>
+	void SoundPlayer<T>::setSoundEffects(EffectChain* effects, SoundHandle handle)
+	{
+		SoundEffect* effect = findSound(handle);
+		if (!effect) {
+#ifdef _DEBUG
+			DebugLogger::cacheMessage("ae::SoundPlayer<T>::setSoundEffects - Unable to find active sound effect");
+#endif
+			return;
+		}
+
+		effect->effects = effects;
+		if (effect->isReal())
+			AudioPlayer<T>::getBackend().setSourceEffects(effect->source, effects);
+	}
+
+	/// <summary>
+	/// Retrieves the status of an active sound effect<para/>
+	///
+	/// Virtual sound effects are reported as playing as they're still advancing.
+	/// </summary>
+	/// <param name="handle">The handle of the active sound effect</param>
+	/// <returns>The status of the sound effect, sf::SoundSource::Status::Stopped if it's no longer active</returns>
+	/// <code>
+	/// enum class SoundID { ID1, ID2, ID3 };
+	/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+	/// ...
+	/// if (soundPlayer.getSoundStatus(waterfall) == sf::SoundSource::Status::Stopped) {
+	///		...
+	/// }
+	/// </code>
+	template <typename T>
+	sf::SoundSource::Status SoundPlayer<T>::getSoundStatus(SoundHandle handle) const
+	{
+		const SoundEffect* effect = findSound(handle);
+		if (!effect || effect->finished)
+			return sf::SoundSource::Status::Stopped;
+		else if (effect->isReal())
+			return AudioPlayer<T>::getBackend().getStatus(effect->source);
+		else
+			return effect->paused ? sf::SoundSource::Status::Paused : sf::SoundSource::Status::Playing;
+	}
+
+	/// <summary>
+	/// Updates the active sound effects, should be called once per frame<para/>
+	///
+	/// The playback cursor of virtual sound effects is advanced, finished sound effects are removed, their occlusion is updated,
+	/// and the real sound sources are redistributed to the most important and audible sound effects.<br/>
+	/// Sound effects that are promoted to real voices resume at the offset reached while they were virtual.<br/>
+	/// The ducking ramps of the buses the sound effects play on are advanced.
+	/// </summary>
+	/// <code>
+	/// enum class SoundID { ID1, ID2, ID3 };
+	/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+	/// ...
+	/// while (window.isOpen()) {
+	///		soundPlayer.setListenerPosition(player.getPosition());
+	///		soundPlayer.update();
+	///		...
+	/// }
+	/// </code>
+	/// <seealso cref="setMaxRealVoices"/>
+	/// <seealso cref="setAudibilityThreshold"/>
+	template <typename T>
+	void SoundPlayer<T>::update()
+	{
+		const sf::Time CLOCK = AudioPlayer<T>::getAudioClock();
+		AudioPlayer<T>::getBus().update(CLOCK);
+		for (auto& bus : soundBuses_)
+			bus.second->update(CLOCK);
+
+		advanceVirtualVoices();
 		removeStoppedSounds();
+		updateOcclusion();
+
+		// Rank the voices by priority and audibility, paused voices aren't worth a real sound source
+		std::vector<SoundEffect*> ranking;
+		ranking.reserve(sounds_.size());
+		for (SoundEffect& effect : sounds_) {
+			effect.audibility = computeAudibility(effect);
+			ranking.push_back(&effect);
+		}
+
+		const std::size_t REAL_COUNT = std::min(maxRealVoices_, ranking.size());
+		if (REAL_COUNT < ranking.size()) {
+			std::nth_element(ranking.begin(), ranking.begin() + REAL_COUNT, ranking.end(),
+				[](const SoundEffect* e1, const SoundEffect* e2) {
+					if (e1->paused != e2->paused)
+						return !e1->paused;
+					if (e1->properties->getPriority() != e2->properties->getPriority())
+						return e1->properties->getPriority() > e2->properties->getPriority();
+					return e1->audibility > e2->audibility;
+				});
+		}
+
+		// Release the sound sources first so that they're available for the promoted voices
+		// The real voices still playing that are demoted are counted as stolen or culled
+		AudioStats& counters = AudioPlayer<T>::getStatsCounters();
+		for (std::size_t i = REAL_COUNT; i < ranking.size(); ++i) {
+			if (ranking[i]->isReal()) {
+				demote(*ranking[i]);
+				counters.stolenVoices += !ranking[i]->finished;
+			}
+		}
+		for (std::size_t i = 0; i < REAL_COUNT; ++i) {
+			SoundEffect& effect = *ranking[i];
+			const bool AUDIBLE = effect.audibility >= audibilityThreshold_;
+			if (effect.isReal() && !AUDIBLE) {
+				demote(effect);
+				counters.culledVoices += !effect.finished;
+			}
+			else if (!effect.isReal() && AUDIBLE && !effect.paused)
+				promote(effect);
+		}
+	}
+
+	/// <summary>
+	/// Sets the maximum amount of sound effects that may own a real sound source at the same time<para/>
+	///
+	/// The remaining active sound effects are virtual and only keep track of their playback cursor.
+	/// </summary>
+	/// <param name="count">The maximum amount of real voices</param>
+	/// <code>
+	/// enum class SoundID { ID1, ID2, ID3 };
+	/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+	/// soundPlayer.setMaxRealVoices(32);
+	/// </code>
+	/// <seealso cref="getMaxRealVoices"/>
+	/// <seealso cref="update"/>
+	template <typename T>
+	void SoundPlayer<T>::setMaxRealVoices(std::size_t count)
+	{
+		maxRealVoices_ = count;
+	}
+
+	/// <summary>Retrieves the maximum amount of sound effects that may own a real sound source at the same time</summary>
+	/// <returns>The maximum amount of real voices</returns>
+	/// <seealso cref="setMaxRealVoices"/>
+	template <typename T>
+	std::size_t SoundPlayer<T>::getMaxRealVoices() const
+	{
+		return maxRealVoices_;
+	}
+
+	/// <summary>
+	/// Sets the gain (0 - 1) under which a sound effect is considered inaudible<para/>
+	///
+	/// The gain is estimated from the sound effect's volume, the gain of its bus, its fade, the distance attenuation and the occlusion by the walls.<br/>
+	/// Inaudible sound effects are never given a real sound source.
+	/// </summary>
+	/// <param name="threshold">The audibility threshold</param>
+	/// <code>
+	/// enum class SoundID { ID1, ID2, ID3 };
+	/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+	/// soundPlayer.setAudibilityThreshold(0.01f); // -40dB
+	/// </code>
+	/// <seealso cref="getAudibilityThreshold"/>
+	template <typename T>
+	void SoundPlayer<T>::setAudibilityThreshold(float threshold)
+	{
+		audibilityThreshold_ = fmaxf(fminf(threshold, 1.f), 0.f);
+	}
+
+	/// <summary>Retrieves the gain (0 - 1) under which a sound effect is considered inaudible</summary>
+	/// <returns>The audibility threshold</returns>
+	/// <seealso cref="setAudibilityThreshold"/>
+	template <typename T>
+	float SoundPlayer<T>::getAudibilityThreshold() const
+	{
+		return audibilityThreshold_;
+	}
+
+	/// <summary>
+	/// Sets the walls muffling the sound effects heard through them, nullptr to stop occluding them<para/>
+	///
+	/// The occlusion of the sound effects is updated by <see cref="update"/> from the listener's position, within the occlusion budget.<br/>
+	/// An occluded sound effect is quieter by the fraction of the sound going through the walls and muffled by a low-pass filter (only by backends mixing in software).<br/>
+	/// The sound effects relative to the listener are never occluded.
+	/// </summary>
+	/// <param name="map">The occlusion map (it must outlive the sound player or be removed first)</param>
+	/// <code>
+	/// enum class SoundID { ID1, ID2, ID3 };
+	/// ae::OcclusionMap occlusion;
+	/// occlusion.addWall(sf::Vector2f(0.f, 0.f), sf::Vector2f(0.f, 500.f), 0.2f);
+	/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+	/// soundPlayer.setOcclusionMap(&amp;occlusion);
+	/// </code>
+	/// <seealso cref="getOcclusionMap"/>
+	/// <seealso cref="setOcclusionBudget"/>
+	template <typename T>
+	void SoundPlayer<T>::setOcclusionMap(OcclusionMap* map)
+	{
+		occlusionMap_ = map;
+		if (occlusionMap_)
+			return;
+
+		// The sound effects are heard in the clear once there are no more walls
+		for (SoundEffect& effect : sounds_) {
+			if (effect.occlusion != 1.f) {
+				effect.occlusion = 1.f;
+				if (effect.isReal())
+					applyOcclusion(effect);
+			}
+		}
+	}
+
+	/// <summary>Retrieves the walls muffling the sound effects heard through them</summary>
+	/// <returns>The occlusion map, nullptr if there's none</returns>
+	/// <seealso cref="setOcclusionMap"/>
+	template <typename T>
+	OcclusionMap* SoundPlayer<T>::getOcclusionMap() const
+	{
+		return occlusionMap_;
+	}
+
+	/// <summary>
+	/// Sets the time that <see cref="update"/> may spend updating the occlusion of the sound effects<para/>
+	///
+	/// The sound effects are updated in turns, those left once the budget runs out keep their occlusion until the next update.
+	/// </summary>
+	/// <param name="budget">The time budget per update (zero for no limit)</param>
+	/// <code>
+	/// enum class SoundID { ID1, ID2, ID3 };
+	/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+	/// soundPlayer.setOcclusionBudget(sf::microseconds(250));
+	/// </code>
+	/// <seealso cref="getOcclusionBudget"/>
+	template <typename T>
+	void SoundPlayer<T>::setOcclusionBudget(sf::Time budget)
+	{
+		occlusionBudget_ = std::max(budget, sf::Time::Zero);
+	}
+
+	/// <summary>Retrieves the time that <see cref="update"/> may spend updating the occlusion of the sound effects</summary>
+	/// <returns>The time budget per update</returns>
+	/// <seealso cref="setOcclusionBudget"/>
+	template <typename T>
+	sf::Time SoundPlayer<T>::getOcclusionBudget() const
+	{
+		return occlusionBudget_;
+	}
+
+	/// <summary>
+	/// Sets the decoded size above which the sound effects loaded are streamed from their file instead of being loaded in memory<para/>
+	///
+	/// Streamed sound effects only keep a small buffer decoded ahead per active sound effect, capping the memory taken by long sounds (i.e. ambience loops).<br/>
+	/// The threshold only applies to the sound effects loaded afterwards, playing them is unchanged.
+	/// </summary>
+	/// <param name="size">The decoded size in bytes (16-bit samples)</param>
+	/// <code>
+	/// enum class SoundID { ID1, ID2, ID3 };
+	/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+	/// soundPlayer.setStreamingThreshold(512 * 1024);
+	/// soundPlayer.load("Assets/Sounds/Forest.ogg", SoundID::ID1);
+	/// </code>
+	/// <seealso cref="getStreamingThreshold"/>
+	template <typename T>
+	void SoundPlayer<T>::setStreamingThreshold(std::size_t size)
+	{
+		streamingThreshold_ = size;
+	}
+
+	/// <summary>Retrieves the decoded size above which the sound effects loaded are streamed from their file</summary>
+	/// <returns>The decoded size in bytes</returns>
+	/// <seealso cref="setStreamingThreshold"/>
+	template <typename T>
+	std::size_t SoundPlayer<T>::getStreamingThreshold() const
+	{
+		return streamingThreshold_;
+	}
+
+	/// <summary>
+	/// Retrieves the cache of the decoded copies of the compressed sound effects<para/>
+	///
+	/// Its capacity may be adjusted to trade memory for decoding time, the copies played are never evicted.
+	/// </summary>
+	/// <returns>The cache of the decoded copies</returns>
+	/// <code>
+	/// soundPlayer.getDecodedCache().setCapacity(8 * 1024 * 1024);
+	/// </code>
+	/// <seealso cref="loadCompressed"/>
+	template <typename T>
+	DecodedSoundCache& SoundPlayer<T>::getDecodedCache()
+	{
+		return decodedCache_;
+	}
+
+	/// <summary>Retrieves the amount of active sound effects that own a real sound source</summary>
+	/// <returns>The amount of real voices</returns>
+	/// <seealso cref="getVirtualVoiceCount"/>
+	template <typename T>
+	std::size_t SoundPlayer<T>::getRealVoiceCount() const
+	{
+		return realVoices_;
+	}
+
+	/// <summary>Retrieves the amount of active sound effects that are virtual</summary>
+	/// <returns>The amount of virtual voices</returns>
+	/// <seealso cref="getRealVoiceCount"/>
+	template <typename T>
+	std::size_t SoundPlayer<T>::getVirtualVoiceCount() const
+	{
+		return sounds_.size() - realVoices_;
 	}
 
 	/// <summary>
 	/// Sets the sound player's global volume (0% - 100%)<para/>
 	///
-	/// A global volume of 50% will reduce the sound player's effects' volume by half of their current volume.
+	/// A global volume of 50% will reduce the sound player's effects' volume by half of their current volume.<br/>
+	/// Only the real voices on the sound player's bus and its sub-buses are updated.
 	/// </summary>
 	/// <param name="globalVolume">The sound player's global volume</param>
 	/// <code>
@@ -139,20 +715,39 @@ namespace ae
 	template <typename T>
 	void SoundPlayer<T>::setGlobalVolume(float globalVolume)
 	{
+		// The bus applies its new gain to the real voices attached to it
 		AudioPlayer<T>::setGlobalVolume(globalVolume);
+	}
 
-		const float GLOBAL_VOLUME = AudioPlayer<T>::getGlobalVolume();
+	/// <summary>
+	/// Routes a loaded-in sound effect to a <paramref name="bus"/> by providing the associated <paramref name="id"/><para/>
+	///
+	/// The sound effects are on the sound player's bus by default, the active sound effects associated with this <paramref name="id"/> are moved to the new <paramref name="bus"/>.
+	/// </summary>
+	/// <param name="bus">The bus of the sound effect (it must outlive the sound player)</param>
+	/// <param name="id">The ID associated with the sound effect</param>
+	/// <code>
+	/// enum class SoundID { ID1, ID2, ID3 };
+	/// ae::AudioBus ui;
+	/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+	/// ui.setParent(&amp;soundPlayer.getBus());
+	/// soundPlayer.setBus(ui, SoundID::ID1);
+	/// </code>
+	template <typename T>
+	void SoundPlayer<T>::setBus(AudioBus& bus, T id)
+	{
+		soundBuses_[id] = &bus;
+
+		AudioBackend& backend = AudioPlayer<T>::getBackend();
 		for (SoundEffect& effect : sounds_) {
-#ifdef _DEBUG
-			auto found = soundProperties_.find(effect.id);
-			if (found == soundProperties_.end()) {
-				DebugLogger::cacheMessage("ae::SoundPlayer<T>::setGlobalVolume - Unable to find a sound effect");
-				return;
+			if (effect.id != id || effect.bus == &bus)
+				continue;
+
+			if (effect.isReal()) {
+				effect.bus->detach(backend, effect.source);
+				bus.attach(backend, effect.source, effect.properties->getVolume());
 			}
-			effect.sound.setVolume(GLOBAL_VOLUME * found->second.getVolume() / 100.f);
-#else
-			effect.sound.setVolume(GLOBAL_VOLUME * soundProperties_.find(effect.id)->second.getVolume() / 100.f);
-#endif
+			effect.bus = &bus;
 		}
 	}
 
@@ -161,7 +756,8 @@ namespace ae
 	///
 	/// The <see cref="AudioProperties"/> of the sound effect will be those by default.<para/>
 	///
-	/// Only sound effects with one channel (mono sounds) can be spatialized.
+	/// Only sound effects with one channel (mono sounds) can be spatialized.<br/>
+	/// The sound effect is streamed from its file if its decoded size exceeds the streaming threshold, otherwise its buffer is shared with the other sound players that loaded it.
 	/// </summary>
 	/// <param name="filepath">The sound effect's filepath</param>
 	/// <param name="id">An ID with which to associate the sound effect (i.e. an enum value)</param>
@@ -175,14 +771,14 @@ namespace ae
 	template <typename T>
 	void SoundPlayer<T>::load(const std::string& filepath, T id)
 	{
-		soundBuffers_.load(filepath, id);
-		soundProperties_.insert(std::make_pair(id, AudioProperties()));
+		load(filepath, AudioProperties(), id);
 	}
 
 	/// <summary>
 	/// Loads in a sound effect by providing a <paramref name="filepath"/>, an <see cref="AudioProperties"/> that contain the sound effect's properties, and an <paramref name="id"/> to associate it with<para/>
 	///
-	/// Only sound effects with one channel (mono sounds) can be spatialized.
+	/// Only sound effects with one channel (mono sounds) can be spatialized.<br/>
+	/// The sound effect is streamed from its file if its decoded size exceeds the streaming threshold, otherwise its buffer is shared with the other sound players that loaded it.
 	/// </summary>
 	/// <param name="filepath">The sound effect's filepath</param>
 	/// <param name="properties">The <see cref="AudioProperties"/> that contain the sound effect's properties</param>
@@ -197,8 +793,88 @@ namespace ae
 	template <typename T>
 	void SoundPlayer<T>::load(const std::string& filepath, const AudioProperties& properties, T id)
 	{
-		soundBuffers_.load(filepath, id);
-		soundProperties_.insert(std::make_pair(id, properties));
+		if (soundProperties_.find(id) != soundProperties_.end()) {
+#ifdef _DEBUG
+			DebugLogger::cacheMessage("ae::SoundPlayer<T>::load - Attempt to load in sound effect that's already loaded in");
+#endif
+			return;
+		}
+
+		// Only open the file to measure its decoded size, the long sound effects are streamed by the audio backend
+		sf::InputSoundFile file;
+		if (file.openFromFile(filepath) && file.getSampleCount() * sizeof(sf::Int16) > streamingThreshold_) {
+			soundStreams_[id] = SoundStream{ filepath, file.getDuration() };
+			soundProperties_.insert(std::make_pair(id, normalizeLoudness(filepath, nullptr, properties)));
+		}
+		else {
+			// The buffer is shared with the other sound players that loaded the same file
+			std::shared_ptr<const sf::SoundBuffer> buffer = SoundBufferCache::getGlobal().acquire(filepath);
+			if (!buffer) {
+#ifdef _DEBUG
+				DebugLogger::cacheMessage("ae::SoundPlayer<T>::load - Failed to load " + filepath);
+#endif
+				return;
+			}
+			soundProperties_.insert(std::make_pair(id, normalizeLoudness(filepath, buffer.get(), properties)));
+			soundBuffers_[id] = std::move(buffer);
+		}
+	}
+
+	/// <summary>
+	/// Loads in a sound effect by providing a <paramref name="filepath"/> and an <paramref name="id"/> to associate it with, keeping it compressed in memory<para/>
+	///
+	/// The sound effect takes about a fourth of its decoded size, it's decoded when played and its decoded copy is kept in the decoded cache while it's used.<br/>
+	/// The <see cref="AudioProperties"/> of the sound effect will be those by default.
+	/// </summary>
+	/// <param name="filepath">The sound effect's filepath</param>
+	/// <param name="id">An ID with which to associate the sound effect (i.e. an enum value)</param>
+	/// <code>
+	/// enum class SoundID { ID1, ID2, ID3 };
+	/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+	/// soundPlayer.loadCompressed("Assets/Sounds/Ambience.wav", SoundID::ID1);
+	/// </code>
+	/// <seealso cref="load"/>
+	/// <seealso cref="getDecodedCache"/>
+	template <typename T>
+	void SoundPlayer<T>::loadCompressed(const std::string& filepath, T id)
+	{
+		loadCompressed(filepath, AudioProperties(), id);
+	}
+
+	/// <summary>
+	/// Loads in a sound effect by providing a <paramref name="filepath"/>, an <see cref="AudioProperties"/> that contain the sound effect's properties, and an <paramref name="id"/> to associate it with, keeping it compressed in memory<para/>
+	///
+	/// The sound effect takes about a fourth of its decoded size, it's decoded when played and its decoded copy is kept in the decoded cache while it's used.
+	/// </summary>
+	/// <param name="filepath">The sound effect's filepath</param>
+	/// <param name="properties">The <see cref="AudioProperties"/> that contain the sound effect's properties</param>
+	/// <param name="id">An ID with which to associate the sound effect (i.e. an enum value)</param>
+	/// <code>
+	/// enum class SoundID { ID1, ID2, ID3 };
+	/// ae::SoundPlayer&lt;SoundID&gt; soundPlayer;
+	/// soundPlayer.loadCompressed("Assets/Sounds/Ambience.wav", ae::AudioProperties(100.f, 35.f, 1.f, 250.f), SoundID::ID1);
+	/// </code>
+	/// <seealso cref="load"/>
+	/// <seealso cref="getDecodedCache"/>
+	template <typename T>
+	void SoundPlayer<T>::loadCompressed(const std::string& filepath, const AudioProperties& properties, T id)
+	{
+		if (soundProperties_.find(id) != soundProperties_.end()) {
+#ifdef _DEBUG
+			DebugLogger::cacheMessage("ae::SoundPlayer<T>::loadCompressed - Attempt to load in sound effect that's already loaded in");
+#endif
+			return;
+		}
+
+		std::unique_ptr<CompressedSoundBuffer> sound(new CompressedSoundBuffer());
+		if (!sound->loadFromFile(filepath)) {
+#ifdef _DEBUG
+			DebugLogger::cacheMessage("ae::SoundPlayer<T>::loadCompressed - Failed to load " + filepath);
+#endif
+			return;
+		}
+		compressedBuffers_[id] = std::move(sound);
+		soundProperties_.insert(std::make_pair(id, normalizeLoudness(filepath, nullptr, properties)));
 	}
 
 	/// <summary>
@@ -227,8 +903,24 @@ namespace ae
 #else
 		soundProperties_.erase(soundProperties_.find(id));
 #endif
-		sounds_.remove_if([&id](const SoundEffect& e) { return e.id == id; });
-		soundBuffers_.unload(id);
+		for (auto itr = sounds_.begin(); itr != sounds_.end();) {
+			if (itr->id == id)
+				itr = removeSound(itr);
+			else
+				++itr;
+		}
+		soundBuses_.erase(id);
+
+		// Compressed sound effects also drop their decoded copy
+		auto compressed = compressedBuffers_.find(id);
+		if (compressed != compressedBuffers_.end()) {
+			decodedCache_.remove(*compressed->second);
+			compressedBuffers_.erase(compressed);
+		}
+		else {
+			soundStreams_.erase(id);
+			soundBuffers_.erase(id);
+		}
 	}
 
 	/// <summary>
@@ -239,16 +931,457 @@ namespace ae
 	template <typename T>
 	void SoundPlayer<T>::removeStoppedSounds()
 	{
-		sounds_.remove_if([](const SoundEffect& e) { return e.sound.getStatus() == sf::Sound::Status::Stopped; });
+		const AudioBackend& backend = AudioPlayer<T>::getBackend();
+		for (auto itr = sounds_.begin(); itr != sounds_.end();) {
+			if (itr->isReal() ? backend.getStatus(itr->source) == sf::SoundSource::Status::Stopped : itr->finished)
+				itr = removeSound(itr);
+			else
+				++itr;
+		}
+	}
+
+	/// <summary>Removes an active sound <paramref name="effect"/>, dropping its handle from the index and its real voice from the count</summary>
+	/// <param name="effect">The active sound effect to remove</param>
+	/// <returns>The active sound effect following the one removed</returns>
+	template <typename T>
+	typename SoundPlayer<T>::SoundIterator SoundPlayer<T>::removeSound(SoundIterator effect)
+	{
+		realVoices_ -= effect->isReal();
+		soundIndex_.erase(effect->handle);
+		return sounds_.erase(effect);
+	}
+
+	/// <summary>
+	/// Advances the playback cursor of the virtual voices and the fades of all voices by the time elapsed since the last call<para/>
+	///
+	/// The time elapsed is measured on the audio clock, the virtual voices thus stay in step with the mix even when it's rendered faster than real time.<br/>
+	/// Virtual voices that aren't on loop are flagged as finished once they reach their end (or the end of their fade-out).<br/>
+	/// The fades of the real voices are ramped by the audio backend, their progress is only kept to hand them over when they're demoted.<br/>
+	/// Scheduled voices don't advance until the audio clock reaches their start time.
+	/// </summary>
+	template <typename T>
+	void SoundPlayer<T>::advanceVirtualVoices()
+	{
+		const sf::Time CLOCK = AudioPlayer<T>::getAudioClock();
+		const sf::Time ELAPSED = std::max(CLOCK - virtualClock_, sf::Time::Zero);
+		virtualClock_ = CLOCK;
+		for (SoundEffect& effect : sounds_) {
+			if (effect.paused || effect.finished)
+				continue;
+
+			// A scheduled voice waits for the audio clock, a virtual one then resumes at the offset it would have reached
+			sf::Time elapsed = ELAPSED;
+			if (effect.startTime > sf::Time::Zero) {
+				if (CLOCK < effect.startTime)
+					continue;
+				elapsed = std::min(ELAPSED, CLOCK - effect.startTime);
+				effect.startTime = sf::Time::Zero;
+			}
+
+			if (effect.fadeLeft > sf::Time::Zero) {
+				const sf::Time STEP = std::min(elapsed, effect.fadeLeft);
+				effect.fadeGain += (effect.fadeTarget - effect.fadeGain) * (STEP / effect.fadeLeft);
+				effect.fadeLeft -= STEP;
+				if (effect.fadeLeft == sf::Time::Zero && effect.fadeStop && !effect.isReal())
+					effect.finished = true;
+			}
+			if (effect.isReal())
+				continue;
+
+			const sf::Time DURATION = effect.duration;
+			effect.offset += elapsed * effect.properties->getPitch();
+			if (effect.offset >= DURATION) {
+				if (effect.loop && DURATION > sf::Time::Zero)
+					effect.offset %= DURATION;
+				else
+					effect.finished = true;
+			}
+		}
+	}
+
+	/// <summary>
+	/// Computes the occlusion of the spatialized sound effects, starting after the last one updated, until the occlusion budget runs out<para/>
+	///
+	/// The real voices whose occlusion changed noticeably are updated straight away.
+	/// </summary>
+	template <typename T>
+	void SoundPlayer<T>::updateOcclusion()
+	{
+		if (!occlusionMap_)
+			return;
+
+		occluded_.clear();
+		occludedPositions_.clear();
+		for (SoundEffect& effect : sounds_) {
+			if (!effect.properties->isRelativeToListener()) {
+				occluded_.push_back(&effect);
+				occludedPositions_.push_back(effect.position);
+			}
+		}
+		if (occluded_.empty())
+			return;
+
+		// The sound effects take turns so that each of them is eventually updated when the budget doesn't cover them all
+		const std::size_t FIRST = occlusionCursor_ % occluded_.size();
+		std::rotate(occluded_.begin(), occluded_.begin() + FIRST, occluded_.end());
+		std::rotate(occludedPositions_.begin(), occludedPositions_.begin() + FIRST, occludedPositions_.end());
+		transmissions_.resize(occluded_.size());
+		const std::size_t UPDATED = occlusionMap_->computeTransmissions(AudioPlayer<T>::getListenerPosition(), occludedPositions_.data(),
+		                                                                transmissions_.data(), occluded_.size(), occlusionBudget_);
+		occlusionCursor_ = FIRST + UPDATED;
+
+		for (std::size_t i = 0; i < UPDATED; ++i) {
+			SoundEffect& effect = *occluded_[i];
+			const float OCCLUSION = transmissions_[i];
+			if (fabsf(OCCLUSION - effect.occlusion) < 0.01f && (OCCLUSION == 1.f) == (effect.occlusion == 1.f))
+				continue;
+
+			effect.occlusion = OCCLUSION;
+			if (effect.isReal())
+				applyOcclusion(effect);
+		}
+	}
+
+	/// <summary>Applies the occlusion of the real sound <paramref name="effect"/> to its volume and to its low-pass filter</summary>
+	/// <param name="effect">The real sound effect</param>
+	template <typename T>
+	void SoundPlayer<T>::applyOcclusion(SoundEffect& effect)
+	{
+		// The cutoff frequency falls exponentially from 20 kHz (unoccluded) to 400 Hz (fully occluded)
+		AudioBackend& backend = AudioPlayer<T>::getBackend();
+		effect.bus->setSourceVolume(backend, effect.source, effect.properties->getVolume() * effect.occlusion);
+		backend.setLowPass(effect.source, effect.occlusion < 1.f ? 400.f * powf(50.f, effect.occlusion) : 0.f);
+	}
+
+	/// <summary>Constructs a new active sound effect and gives it a real sound source straight away if one is available and if it can be heard</summary>
+	/// <param name="position">The position of the sound effect's source</param>
+	/// <param name="id">The id associated with the desired sound effect</param>
+	/// <param name="loop">True to put the sound effect on loop, false otherwise</param>
+	/// <param name="fadeIn">The duration of the fade-in (zero to play it at full volume straight away)</param>
+	/// <param name="clockTime">The time of the audio clock at which the sound effect starts (zero to start it straight away)</param>
+	/// <returns>The handle of the new active sound effect, 0 if it couldn't be played</returns>
+	template <typename T>
+	typename SoundPlayer<T>::SoundHandle SoundPlayer<T>::startSound(const sf::Vector2f& position, T id, bool loop, sf::Time fadeIn, sf::Time clockTime)
+	{
+		// Remove all stopped sound effects before playing the new one
+		removeStoppedSounds();
+
+		// Construct the new sound effect as a virtual voice
+		AudioStats& counters = AudioPlayer<T>::getStatsCounters();
+#ifdef _DEBUG
+		auto found = soundProperties_.find(id);
+		if (found == soundProperties_.end()) {
+			DebugLogger::cacheMessage("ae::SoundPlayer<T>::startSound - Unable to find sound effect");
+			++counters.droppedPlays;
+			return 0;
+		}
+		const AudioProperties& props = found->second;
+#else
+		const AudioProperties& props = soundProperties_.find(id)->second;
+#endif
+
+		// Compressed sound effects play their decoded copy, pinned in the decoded cache until the sound effect is removed
+		// Streamed sound effects have no buffer, their stream is only opened once they're given a real sound source
+		auto compressed = compressedBuffers_.find(id);
+		auto stream = soundStreams_.find(id);
+		const sf::SoundBuffer* buffer = nullptr;
+		if (compressed != compressedBuffers_.end()) {
+			buffer = decodedCache_.acquire(*compressed->second);
+			if (!buffer) {
+#ifdef _DEBUG
+				DebugLogger::cacheMessage("ae::SoundPlayer<T>::startSound - Unable to decode the compressed sound effect");
+#endif
+				++counters.droppedPlays;
+				return 0;
+			}
+		}
+		else if (stream == soundStreams_.end())
+			buffer = soundBuffers_.find(id)->second.get();
+
+		auto bus = soundBuses_.find(id);
+		sounds_.emplace_back(AudioPlayer<T>::getBackend(), (bus != soundBuses_.end()) ? *bus->second : AudioPlayer<T>::getBus(),
+		                     buffer, props, position, id, nextHandle_++, loop);
+		SoundEffect& effect = sounds_.back();
+		soundIndex_.emplace(effect.handle, std::prev(sounds_.end()));
+		if (stream != soundStreams_.end()) {
+			effect.filepath = &stream->second.filepath;
+			effect.duration = stream->second.duration;
+		}
+		else if (compressed != compressedBuffers_.end()) {
+			effect.cache = &decodedCache_;
+			effect.compressed = compressed->second.get();
+		}
+		if (fadeIn > sf::Time::Zero) {
+			effect.fadeGain = 0.f;
+			effect.fadeLeft = fadeIn;
+		}
+		if (clockTime > AudioPlayer<T>::getAudioClock())
+			effect.startTime = clockTime;
+		++counters.plays;
+		counters.peakVoices = std::max(counters.peakVoices, sounds_.size());
+
+		// Give it a real sound source straight away if one is available and if it can be heard
+		effect.audibility = computeAudibility(effect);
+		if (effect.audibility >= audibilityThreshold_ && realVoices_ < maxRealVoices_)
+			promote(effect);
+
+		return effect.handle;
+	}
+
+	/// <summary>Retrieves the active sound effect associated with the <paramref name="handle"/> provided</summary>
+	/// <param name="handle">The handle of the active sound effect</param>
+	/// <returns>The active sound effect, nullptr if it couldn't be found</returns>
+	template <typename T>
+	typename SoundPlayer<T>::SoundEffect* SoundPlayer<T>::findSound(SoundHandle handle)
+	{
+		auto found = soundIndex_.find(handle);
+		return found != soundIndex_.end() ? &*found->second : nullptr;
+	}
+
+	/// <summary>Retrieves the active sound effect associated with the <paramref name="handle"/> provided</summary>
+	/// <param name="handle">The handle of the active sound effect</param>
+	/// <returns>The active sound effect, nullptr if it couldn't be found</returns>
+	template <typename T>
+	const typename SoundPlayer<T>::SoundEffect* SoundPlayer<T>::findSound(SoundHandle handle) const
+	{
+		auto found = soundIndex_.find(handle);
+		return found != soundIndex_.end() ? &*found->second : nullptr;
+	}
+
+	/// <summary>
+	/// Estimates the gain (0 - 1) at which the listener hears the sound <paramref name="effect"/><para/>
+	///
+	/// The estimation follows the inverse distance clamped model used by the audio backend and includes the occlusion by the walls.
+	/// </summary>
+	/// <param name="effect">The active sound effect</param>
+	/// <returns>The estimated gain</returns>
+	template <typename T>
+	float SoundPlayer<T>::computeAudibility(const SoundEffect& effect) const
+	{
+		const AudioProperties& props = *effect.properties;
+		// A fading sound effect is ranked by the louder end of its fade so that it isn't cut before fading in or out
+		const float GAIN = effect.bus->getGain() * props.getVolume() / 100.f * fmaxf(effect.fadeGain, effect.fadeTarget) * effect.occlusion;
+
+		// Retrieve the distance between the listener and the sound effect's source (the source is at z = 0)
+		const sf::Vector3f LISTENER_POS = AudioPlayer<T>::getBackend().getListenerPosition();
+		const sf::Vector3f SOURCE_POS(effect.position.x, -effect.position.y, 0.f);
+		const sf::Vector3f DIFF = props.isRelativeToListener() ? SOURCE_POS : SOURCE_POS - LISTENER_POS;
+		const float DISTANCE = sqrtf(DIFF.x * DIFF.x + DIFF.y * DIFF.y + DIFF.z * DIFF.z);
+
+		const float MIN_DISTANCE = props.getMinDistance3D();
+		const float ATTENUATION = props.getAttenuation();
+		return GAIN * MIN_DISTANCE / (MIN_DISTANCE + ATTENUATION * (fmaxf(DISTANCE, MIN_DISTANCE) - MIN_DISTANCE));
+	}
+
+	/// <summary>Starts fading out the sound <paramref name="effect"/>, it's removed once faded out</summary>
+	/// <param name="effect">The active sound effect</param>
+	/// <param name="duration">The duration of the fade-out</param>
+	template <typename T>
+	void SoundPlayer<T>::startFadeOut(SoundEffect& effect, sf::Time duration)
+	{
+		effect.fadeTarget = 0.f;
+		effect.fadeLeft = std::max(duration, sf::Time::Zero);
+		effect.fadeStop = true;
+		if (effect.isReal())
+			AudioPlayer<T>::getBackend().fade(effect.source, 0.f, effect.fadeLeft, true);
+		else if (effect.fadeLeft == sf::Time::Zero)
+			effect.finished = true;
+	}
+
+	/// <summary>Gives a real sound source to the virtual sound <paramref name="effect"/>, starting at its current playback cursor</summary>
+	/// <param name="effect">The virtual sound effect to promote</param>
+	/// <seealso cref="demote"/>
+	template <typename T>
+	void SoundPlayer<T>::promote(SoundEffect& effect)
+	{
+		const AudioProperties& props = *effect.properties;
+		AudioBackend& backend = AudioPlayer<T>::getBackend();
+
+		effect.source = effect.buffer ? backend.createSound(*effect.buffer) : backend.createStream(*effect.filepath);
+		if (!effect.source) {
+#ifdef _DEBUG
+			DebugLogger::cacheMessage("ae::SoundPlayer<T>::promote - Unable to stream the sound effect");
+#endif
+			++AudioPlayer<T>::getStatsCounters().droppedPlays;
+			effect.finished = true;
+			return;
+		}
+		++realVoices_;
+		backend.setPosition(effect.source, sf::Vector3f(effect.position.x, -effect.position.y, 0.f));
+		backend.setProperties(effect.source, props);
+		effect.bus->attach(backend, effect.source, props.getVolume());
+		if (effect.occlusion != 1.f)
+			applyOcclusion(effect);
+		if (effect.effects)
+			backend.setSourceEffects(effect.source, effect.effects);
+		if (effect.fadeGain != 1.f)
+			backend.fade(effect.source, effect.fadeGain, sf::Time::Zero, false);
+		if (effect.fadeLeft > sf::Time::Zero)
+			backend.fade(effect.source, effect.fadeTarget, effect.fadeLeft, effect.fadeStop);
+		backend.setLoop(effect.source, effect.loop);
+		if (effect.offset > sf::Time::Zero)
+			backend.setPlayingOffset(effect.source, effect.offset);
+		if (effect.startTime > sf::Time::Zero)
+			backend.playAt(effect.source, effect.startTime);
+		else
+			backend.play(effect.source);
+	}
+
+	/// <summary>Releases the real sound source of the sound <paramref name="effect"/>, keeping its playback cursor</summary>
+	/// <param name="effect">The real sound effect to demote</param>
+	/// <seealso cref="promote"/>
+	template <typename T>
+	void SoundPlayer<T>::demote(SoundEffect& effect)
+	{
+		AudioBackend& backend = AudioPlayer<T>::getBackend();
+
+		// A real voice that stopped on its own has reached its end, a scheduled one keeps waiting for its start time
+		if (effect.startTime > sf::Time::Zero && AudioPlayer<T>::getAudioClock() >= effect.startTime)
+			effect.startTime = sf::Time::Zero;
+		effect.finished = backend.getStatus(effect.source) == sf::SoundSource::Status::Stopped;
+		effect.offset = backend.getPlayingOffset(effect.source);
+		if (!effect.buffer) {
+			// The next stream of the sound effect counts its underruns from zero
+			float fill = 1.f;
+			countUnderruns(effect, fill);
+			effect.underruns = 0;
+		}
+		effect.bus->detach(backend, effect.source);
+		backend.destroySource(effect.source);
+		effect.source = 0;
+		--realVoices_;
 	}
 
-	/// <summary>Constructs the <see cref="SoundEffect"/> by providing a sound buffer and an ID</summary>
-	/// <param name="buffer">The sound effect's buffer</param>
+	/// <summary>
+	/// Folds the gain bringing a sound effect to the target loudness into its volume, measuring its loudness unless the loudness cache knows it<para/>
+	///
+	/// The <paramref name="properties"/> are returned unchanged if the loudness normalization is disabled.
+	/// </summary>
+	/// <param name="filepath">The sound effect's filepath</param>
+	/// <param name="buffer">The sound effect's buffer (nullptr to measure it from its file)</param>
+	/// <param name="properties">The sound effect's properties</param>
+	/// <returns>The properties played</returns>
+	template <typename T>
+	AudioProperties SoundPlayer<T>::normalizeLoudness(const std::string& filepath, const sf::SoundBuffer* buffer, const AudioProperties& properties)
+	{
+		if (AudioPlayer<T>::getLoudnessTarget() == 0.f)
+			return properties;
+
+		LoudnessCache* cache = AudioPlayer<T>::getLoudnessCache();
+		float loudness = 0.f;
+		if (!cache || !cache->find(filepath, loudness)) {
+			FileSampleSource source;
+			if (buffer)
+				loudness = LoudnessMeter::measure(*buffer);
+			else if (source.openFromFile(filepath))
+				loudness = LoudnessMeter::measure(source);
+			else
+				return properties;
+
+			if (cache)
+				cache->store(filepath, loudness);
+		}
+
+		AudioProperties normalized(properties);
+		normalized.setVolume(properties.getVolume() * AudioPlayer<T>::computeLoudnessGain(loudness));
+		return normalized;
+	}
+
+	/// <summary>Accumulates the underruns of the stream of the real sound <paramref name="effect"/> since they were last counted</summary>
+	/// <param name="effect">The real sound effect</param>
+	/// <param name="fill">The fill level (0 - 1) of the stream's buffer</param>
+	/// <returns>True if the stream reports its buffer, false otherwise</returns>
+	template <typename T>
+	bool SoundPlayer<T>::countUnderruns(SoundEffect& effect, float& fill)
+	{
+		std::size_t underruns = 0;
+		if (!AudioPlayer<T>::getBackend().getStreamState(effect.source, fill, underruns))
+			return false;
+
+		AudioPlayer<T>::getStatsCounters().underruns += underruns - std::min(effect.underruns, underruns);
+		effect.underruns = underruns;
+		return true;
+	}
+
+	/// <summary>Fills in the voice counts and the state of the streamed sound effects, and accumulates the underruns of their streams</summary>
+	/// <param name="stats">The sound player's statistics</param>
+	template <typename T>
+	void SoundPlayer<T>::collectStats(AudioStats& stats)
+	{
+		stats.activeVoices = sounds_.size();
+		stats.realVoices = realVoices_;
+		stats.streams = 0;
+		stats.minStreamFill = 1.f;
+		for (SoundEffect& effect : sounds_) {
+			if (!effect.isReal())
+				continue;
+
+			float fill = 1.f;
+			if (!effect.buffer) {
+				++stats.streams;
+				if (countUnderruns(effect, fill))
+					stats.minStreamFill = std::min(stats.minStreamFill, fill);
+			}
+		}
+	}
+
+	/// <summary>Constructs the virtual <see cref="SoundEffect"/> by providing the audio backend, its bus, a sound buffer, the sound effect's properties, its position, its ID, its handle and if it's on loop</summary>
+	/// <param name="backend">The audio backend playing the sound effect</param>
+	/// <param name="bus">The bus of the sound effect</param>
+	/// <param name="buffer">The sound effect's buffer (nullptr if it's streamed)</param>
+	/// <param name="properties">The sound effect's properties</param>
+	/// <param name="position">The position of the sound effect's source</param>
 	/// <param name="id">The ID with which the sound effect will be associated with</param>
+	/// <param name="handle">The handle returned to the user</param>
+	/// <param name="loop">True if the sound effect is on loop, false otherwise</param>
 	template <typename T>
-	SoundPlayer<T>::SoundEffect::SoundEffect(const sf::SoundBuffer& buffer, T id)
-		: sound(buffer)
+	SoundPlayer<T>::SoundEffect::SoundEffect(AudioBackend& backend, AudioBus& bus, const sf::SoundBuffer* buffer, const AudioProperties& properties,
+	                                         const sf::Vector2f& position, T id, SoundHandle handle, bool loop)
+		: backend(&backend)
+		, bus(&bus)
+		, source(0)
+		, buffer(buffer)
+		, filepath(nullptr)
+		, duration(buffer ? buffer->getDuration() : sf::Time::Zero)
+		, properties(&properties)
+		, position(position)
+		, offset(sf::Time::Zero)
+		, startTime(sf::Time::Zero)
+		, effects(nullptr)
+		, cache(nullptr)
+		, compressed(nullptr)
+		, audibility(0.f)
+		, occlusion(1.f)
+		, underruns(0)
+		, fadeGain(1.f)
+		, fadeTarget(1.f)
+		, fadeLeft(sf::Time::Zero)
+		, fadeStop(false)
+		, handle(handle)
 		, id(id)
+		, loop(loop)
+		, paused(false)
+		, finished(false)
+	{
+	}
+
+	/// <summary>Detaches the sound effect's source from its bus, destroys it and releases the decoded copy of the compressed sound effect</summary>
+	template <typename T>
+	SoundPlayer<T>::SoundEffect::~SoundEffect()
+	{
+		if (source) {
+			bus->detach(*backend, source);
+			backend->destroySource(source);
+		}
+		if (cache)
+			cache->release(*compressed);
+	}
+
+	/// <summary>Checks if the sound effect is a real voice (it owns a source of the audio backend)</summary>
+	/// <returns>True if the sound effect is a real voice, false if it's virtual</returns>
+	template <typename T>
+	bool SoundPlayer<T>::SoundEffect::isReal() const
 	{
+		return source != 0;
 	}
 }
\ No newline at end of file
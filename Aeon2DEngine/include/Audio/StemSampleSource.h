@@ -0,0 +1,101 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+
+#ifndef Aeon2D_Audio_StemSampleSource_H_
+#define Aeon2D_Audio_StemSampleSource_H_
+
+#include <vector>
+#include <string>
+#include <memory>
+
+#include "FileSampleSource.h"
+
+namespace ae
+{
+	/// <summary>
+	/// Sample source decoding the stems of a music track (i.e. drums, bass and strings) in lockstep, their frames placed side by side<para/>
+	///
+	/// Each frame holds the channels of every stem in turn, the stems therefore share a single read position and can't drift apart.<br/>
+	/// It's decoded ahead like any other stream and mixed down by a <see cref="LayeredSampleSource"/>.
+	/// </summary>
+	class StemSampleSource : public SampleSource
+	{
+	public:
+		/// <summary>Default constructor</summary>
+		StemSampleSource();
+		/// <summary>Deleted copy constructor</summary>
+		/// <param name="copy">The <see cref="StemSampleSource"/> to be copied</param>
+		StemSampleSource(const StemSampleSource& copy) = delete;
+	public:
+		/// <summary>Deleted assignment operator</summary>
+		/// <param name="other">The <see cref="StemSampleSource"/> to be copied</param>
+		/// <returns>The caller <see cref="StemSampleSource"/></returns>
+		StemSampleSource& operator=(const StemSampleSource& other) = delete;
+	public:
+		/// <summary>
+		/// Opens the stems located at the <paramref name="filepaths"/> provided<para/>
+		///
+		/// The stems must have the same amount of channels and the same sample rate, the shorter ones are padded with silence.
+		/// </summary>
+		/// <param name="filepaths">The stems' filepaths</param>
+		/// <returns>True if all the stems could be opened and match, false otherwise</returns>
+		/// <code>
+		/// auto stems = std::make_unique&lt;ae::StemSampleSource&gt;();
+		/// if (stems->openFromFiles({ "Assets/Music/Drums.ogg", "Assets/Music/Bass.ogg", "Assets/Music/Strings.ogg" }))
+		///		...
+		/// </code>
+		bool openFromFiles(const std::vector<std::string>& filepaths);
+		/// <summary>Retrieves the amount of stems opened</summary>
+		/// <returns>The amount of stems</returns>
+		std::size_t getStemCount() const;
+		/// <summary>Retrieves the amount of channels of each stem</summary>
+		/// <returns>The amount of channels of a stem</returns>
+		unsigned int getStemChannelCount() const;
+		/// <summary>
+		/// Reads the next frames of all the stems<para/>
+		///
+		/// Less frames than requested are only read once the end of the longest stem has been reached.
+		/// </summary>
+		/// <param name="samples">The interleaved samples read, the stems side by side (at least <paramref name="frameCount"/> * channel count)</param>
+		/// <param name="frameCount">The maximum amount of frames to read</param>
+		/// <returns>The amount of frames read</returns>
+		virtual std::size_t read(sf::Int16* samples, std::size_t frameCount) override;
+		/// <summary>Changes the position of the next frame to read, for all the stems</summary>
+		/// <param name="frame">The index of the next frame to read</param>
+		virtual void seek(sf::Uint64 frame) override;
+		/// <summary>Retrieves the total amount of frames of the longest stem</summary>
+		/// <returns>The amount of frames</returns>
+		virtual sf::Uint64 getFrameCount() const override;
+		/// <summary>Retrieves the amount of channels of a frame, the channels of all the stems</summary>
+		/// <returns>The amount of channels</returns>
+		virtual unsigned int getChannelCount() const override;
+		/// <summary>Retrieves the amount of frames per second of the stems</summary>
+		/// <returns>The sample rate</returns>
+		virtual unsigned int getSampleRate() const override;
+
+	private:
+		std::vector<std::unique_ptr<FileSampleSource>> stems_;       ///< The stems' decoders
+		std::vector<sf::Int16>                         stemSamples_; ///< The samples read from a stem
+		sf::Uint64                                     position_;    ///< The shared read position of the stems
+		sf::Uint64                                     frameCount_;  ///< The amount of frames of the longest stem
+	};
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,80 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#ifndef Aeon2D_Utils_RingBuffer_H_
+#define Aeon2D_Utils_RingBuffer_H_
+
+#include <vector>
+#include <atomic>
+
+namespace ae
+{
+	/// <summary>
+	/// Wait-free single-producer single-consumer queue with a fixed capacity<para/>
+	///
+	/// The items are preallocated at construction, pushing and popping only copy them and publish an index.<br/>
+	/// One thread may push while another pops, without any lock.
+	/// </summary>
+	/// <param name="T">The item type (it must be default constructible and copy assignable)</param>
+	template <typename T>
+	class RingBuffer
+	{
+	public:
+		/// <summary>Constructs the <see cref="RingBuffer"/> by providing its <paramref name="capacity"/></summary>
+		/// <param name="capacity">The maximum amount of items (rounded up to the next power of two)</param>
+		/// <code>
+		/// ae::RingBuffer&lt;Command&gt; commands(1024);
+		/// </code>
+		explicit RingBuffer(std::size_t capacity);
+		/// <summary>Deleted copy constructor</summary>
+		/// <param name="copy">The <see cref="RingBuffer"/> to be copied</param>
+		RingBuffer(const RingBuffer<T>& copy) = delete;
+	public:
+		/// <summary>Deleted assignment operator</summary>
+		/// <param name="other">The <see cref="RingBuffer"/> to be copied</param>
+		/// <returns>The caller <see cref="RingBuffer"/></returns>
+		RingBuffer<T>& operator=(const RingBuffer<T>& other) = delete;
+	public:
+		/// <summary>Pushes an <paramref name="item"/> at the back of the queue (producer thread only)</summary>
+		/// <param name="item">The item to push</param>
+		/// <returns>True if the item was pushed, false if the queue is full</returns>
+		/// <seealso cref="pop"/>
+		bool push(const T& item);
+		/// <summary>Pops the item at the front of the queue (consumer thread only)</summary>
+		/// <param name="item">The item popped</param>
+		/// <returns>True if an item was popped, false if the queue is empty</returns>
+		/// <seealso cref="push"/>
+		bool pop(T& item);
+		/// <summary>Checks if the queue is empty</summary>
+		/// <returns>True if the queue is empty, false otherwise</returns>
+		bool isEmpty() const;
+		/// <summary>Retrieves the maximum amount of items</summary>
+		/// <returns>The capacity of the queue</returns>
+		std::size_t getCapacity() const;
+
+	private:
+		std::vector<T>                       items_; ///< The preallocated items
+		const std::size_t                    MASK;   ///< The mask wrapping the indices around the capacity
+		alignas(64) std::atomic<std::size_t> head_;  ///< The index of the next item to pop (written by the consumer)
+		alignas(64) std::atomic<std::size_t> tail_;  ///< The index of the next item to push (written by the producer)
+	};
+}
+#include "RingBuffer.inl"
+#endif
\ No newline at end of file
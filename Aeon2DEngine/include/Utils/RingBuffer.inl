@@ -0,0 +1,90 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+namespace ae
+{
+	/// <summary>Constructs the <see cref="RingBuffer"/> by providing its <paramref name="capacity"/></summary>
+	/// <param name="capacity">The maximum amount of items (rounded up to the next power of two)</param>
+	/// <code>
+	/// ae::RingBuffer&lt;Command&gt; commands(1024);
+	/// </code>
+	template <typename T>
+	RingBuffer<T>::RingBuffer(std::size_t capacity)
+		: items_()
+		, MASK([capacity]() {
+			std::size_t powerOfTwo = 1;
+			while (powerOfTwo < capacity)
+				powerOfTwo <<= 1;
+			return powerOfTwo - 1;
+		}())
+		, head_(0)
+		, tail_(0)
+	{
+		items_.resize(MASK + 1);
+	}
+
+	/// <summary>Pushes an <paramref name="item"/> at the back of the queue (producer thread only)</summary>
+	/// <param name="item">The item to push</param>
+	/// <returns>True if the item was pushed, false if the queue is full</returns>
+	/// <seealso cref="pop"/>
+	template <typename T>
+	bool RingBuffer<T>::push(const T& item)
+	{
+		const std::size_t TAIL = tail_.load(std::memory_order_relaxed);
+		if (TAIL - head_.load(std::memory_order_acquire) > MASK)
+			return false;
+
+		items_[TAIL & MASK] = item;
+		tail_.store(TAIL + 1, std::memory_order_release);
+		return true;
+	}
+
+	/// <summary>Pops the item at the front of the queue (consumer thread only)</summary>
+	/// <param name="item">The item popped</param>
+	/// <returns>True if an item was popped, false if the queue is empty</returns>
+	/// <seealso cref="push"/>
+	template <typename T>
+	bool RingBuffer<T>::pop(T& item)
+	{
+		const std::size_t HEAD = head_.load(std::memory_order_relaxed);
+		if (HEAD == tail_.load(std::memory_order_acquire))
+			return false;
+
+		item = items_[HEAD & MASK];
+		head_.store(HEAD + 1, std::memory_order_release);
+		return true;
+	}
+
+	/// <summary>Checks if the queue is empty</summary>
+	/// <returns>True if the queue is empty, false otherwise</returns>
+	template <typename T>
+	bool RingBuffer<T>::isEmpty() const
+	{
+		return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+	}
+
+	/// <summary>Retrieves the maximum amount of items</summary>
+	/// <returns>The capacity of the queue</returns>
+	template <typename T>
+	std::size_t RingBuffer<T>::getCapacity() const
+	{
+		return MASK + 1;
+	}
+}
\ No newline at end of file
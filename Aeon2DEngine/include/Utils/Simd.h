@@ -0,0 +1,41 @@
+// Aeon2DEngine - 2D Game Engine Powered by SFML
+// Copyright (C) 2018 Filippos Gleglakos (gleglakos.filippos@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#ifndef Aeon2D_Utils_Simd_H_
+#define Aeon2D_Utils_Simd_H_
+
+// Detects the SIMD instruction sets enabled at compile time
+// (/arch:AVX and /arch:AVX2 with MSVC, -mavx and -mavx2 with GCC and Clang; SSE2 is always available on x64)
+#if defined(__AVX2__)
+	#define AE_SIMD_AVX2
+#endif
+#if defined(__AVX__)
+	#define AE_SIMD_AVX
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define AE_SIMD_SSE
+#endif
+
+#if defined(AE_SIMD_AVX)
+	#include <immintrin.h>
+#elif defined(AE_SIMD_SSE)
+	#include <emmintrin.h>
+#endif
+#endif
\ No newline at end of file
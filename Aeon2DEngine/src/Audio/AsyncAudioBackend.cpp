@@ -0,0 +1,775 @@
+#include <algorithm>
+#include <chrono>
+
+#include "../../include/Audio/AsyncAudioBackend.h"
+
+namespace ae
+{
+	namespace
+	{
+		const unsigned int SLOT_BITS = 20;
+		const sf::Uint32   SLOT_MASK = (1u << SLOT_BITS) - 1;
+		const sf::Uint32   GENERATION_MASK = (1u << (32 - SLOT_BITS)) - 1;
+		const sf::Uint32   SEQUENCE_MASK = (1u << 29) - 1;
+		const sf::Uint32   PUBLISHED = 1u << 2;
+
+		sf::Uint32 packState(sf::SoundSource::Status status, sf::Uint32 sequence)
+		{
+			return ((sequence & SEQUENCE_MASK) << 3) | static_cast<sf::Uint32>(status);
+		}
+
+		sf::Uint32 unpackSequence(sf::Uint32 state)
+		{
+			return state >> 3;
+		}
+
+		sf::SoundSource::Status unpackStatus(sf::Uint32 state)
+		{
+			return static_cast<sf::SoundSource::Status>(state & 3);
+		}
+	}
+
+	AsyncAudioBackend::Command::Command()
+		: type(Type::Play)
+		, slot(0)
+		, next(0)
+		, layer(0)
+		, sequence(0)
+		, buffer(nullptr)
+		, properties()
+		, position()
+		, offset()
+		, chunk()
+		, volume(100.f)
+		, flag(false)
+		, submix(0)
+		, parent(0)
+		, effects(nullptr)
+		, source(0)
+		, markers(nullptr)
+	{
+	}
+
+	AsyncAudioBackend::Slot::Slot()
+		: state(packState(sf::SoundSource::Status::Stopped, 0))
+		, offset(0)
+		, published(0)
+		, fill(-1.f)
+		, underruns(0)
+		, filepath()
+		, data(nullptr)
+		, size(0)
+		, stream()
+		, layers()
+		, generation(1)
+		, sequence(0)
+	{
+	}
+
+	AsyncAudioBackend::AsyncAudioBackend(AudioBackend& backend, std::size_t maxSources, std::size_t commandCapacity)
+		: AudioBackend()
+		, backend_(backend)
+		, MAX_SOURCES(std::min<std::size_t>(std::max<std::size_t>(maxSources, 1), SLOT_MASK))
+		, slots_(new Slot[MAX_SOURCES])
+		, freeSlots_()
+		, releasedSlots_(MAX_SOURCES)
+		, commands_(commandCapacity)
+		, overflow_()
+		, listenerPosition_(backend.getListenerPosition())
+		, nextSubmix_(1)
+		, innerSubmixes_(1, 0)
+		, innerSources_(MAX_SOURCES, 0)
+		, appliedSequences_(MAX_SOURCES, 0)
+		, liveSlots_()
+		, markedSources_(MAX_SOURCES, 0)
+		, markerEvents_(1024)
+		, markerPool_()
+		, freeMarkers_()
+		, releasedMarkers_(commandCapacity)
+		, renderTime_(0)
+		, running_(true)
+		, thread_()
+	{
+		freeSlots_.reserve(MAX_SOURCES);
+		for (std::size_t i = MAX_SOURCES; i > 0; --i)
+			freeSlots_.push_back(i - 1);
+		liveSlots_.reserve(MAX_SOURCES);
+
+		thread_ = std::thread(&AsyncAudioBackend::run, this);
+	}
+
+	AsyncAudioBackend::~AsyncAudioBackend()
+	{
+		while (!flushOverflow())
+			std::this_thread::yield();
+
+		running_.store(false, std::memory_order_release);
+		thread_.join();
+
+		for (std::size_t slot : liveSlots_)
+			backend_.destroySource(innerSources_[slot]);
+	}
+
+	AudioBackend::SourceID AsyncAudioBackend::createSound(const sf::SoundBuffer& buffer)
+	{
+		const std::size_t slot = acquireSlot();
+		if (slot == MAX_SOURCES)
+			return 0;
+
+		Command command = makeCommand(Command::Type::CreateSound, slot);
+		command.buffer = &buffer;
+		pushCommand(command);
+
+		return (slots_[slot].generation << SLOT_BITS) | static_cast<sf::Uint32>(slot + 1);
+	}
+
+	AudioBackend::SourceID AsyncAudioBackend::createStream(const std::string& filepath)
+	{
+		const std::size_t slot = acquireSlot();
+		if (slot == MAX_SOURCES)
+			return 0;
+
+		slots_[slot].filepath = filepath;
+		pushCommand(makeCommand(Command::Type::CreateStream, slot));
+
+		return (slots_[slot].generation << SLOT_BITS) | static_cast<sf::Uint32>(slot + 1);
+	}
+
+	AudioBackend::SourceID AsyncAudioBackend::createStream(const void* data, std::size_t size)
+	{
+		const std::size_t slot = acquireSlot();
+		if (slot == MAX_SOURCES)
+			return 0;
+
+		slots_[slot].data = data;
+		slots_[slot].size = size;
+		pushCommand(makeCommand(Command::Type::CreateMemoryStream, slot));
+
+		return (slots_[slot].generation << SLOT_BITS) | static_cast<sf::Uint32>(slot + 1);
+	}
+
+	AudioBackend::SourceID AsyncAudioBackend::createStream(std::unique_ptr<sf::InputStream> stream)
+	{
+		const std::size_t slot = acquireSlot();
+		if (slot == MAX_SOURCES)
+			return 0;
+
+		slots_[slot].stream = std::move(stream);
+		pushCommand(makeCommand(Command::Type::CreateInputStream, slot));
+
+		return (slots_[slot].generation << SLOT_BITS) | static_cast<sf::Uint32>(slot + 1);
+	}
+
+	AudioBackend::SourceID AsyncAudioBackend::createLayeredStream(const std::vector<std::string>& filepaths)
+	{
+		const std::size_t slot = acquireSlot();
+		if (slot == MAX_SOURCES)
+			return 0;
+
+		slots_[slot].layers = filepaths;
+		pushCommand(makeCommand(Command::Type::CreateLayeredStream, slot));
+
+		return (slots_[slot].generation << SLOT_BITS) | static_cast<sf::Uint32>(slot + 1);
+	}
+
+	bool AsyncAudioBackend::supportsLayeredStreams() const
+	{
+		// The owned backend's support never changes, it's safe to query from any thread
+		return backend_.supportsLayeredStreams();
+	}
+
+	void AsyncAudioBackend::destroySource(SourceID source)
+	{
+		const std::size_t slot = findSlot(source);
+		if (slot == MAX_SOURCES)
+			return;
+
+		Slot& found = slots_[slot];
+		found.generation = (found.generation + 1) & GENERATION_MASK;
+		if (found.generation == 0)
+			found.generation = 1;
+
+		pushCommand(makeCommand(Command::Type::Destroy, slot));
+	}
+
+	void AsyncAudioBackend::play(SourceID source)
+	{
+		pushStateCommand(Command::Type::Play, source, sf::SoundSource::Status::Playing);
+	}
+
+	void AsyncAudioBackend::playAt(SourceID source, sf::Time clockTime)
+	{
+		const std::size_t slot = findSlot(source);
+		if (slot == MAX_SOURCES)
+			return;
+
+		storeState(slots_[slot], sf::SoundSource::Status::Playing);
+
+		Command command = makeCommand(Command::Type::PlayAt, slot);
+		command.offset = clockTime;
+		pushCommand(command);
+	}
+
+	bool AsyncAudioBackend::chain(SourceID source, SourceID next)
+	{
+		const std::size_t slot = findSlot(source);
+		if (slot == MAX_SOURCES)
+			return false;
+
+		Command command = makeCommand(Command::Type::Chain, slot);
+		command.next = findSlot(next);
+		pushCommand(command);
+		return true;
+	}
+
+	void AsyncAudioBackend::pause(SourceID source)
+	{
+		const std::size_t slot = findSlot(source);
+		if (slot == MAX_SOURCES)
+			return;
+
+		if (unpackStatus(slots_[slot].state.load(std::memory_order_acquire)) == sf::SoundSource::Status::Playing)
+			pushStateCommand(Command::Type::Pause, source, sf::SoundSource::Status::Paused);
+		else
+			pushCommand(makeCommand(Command::Type::Pause, slot));
+	}
+
+	void AsyncAudioBackend::stop(SourceID source)
+	{
+		const std::size_t slot = findSlot(source);
+		if (slot == MAX_SOURCES)
+			return;
+
+		pushStateCommand(Command::Type::Stop, source, sf::SoundSource::Status::Stopped);
+		slots_[slot].offset.store(0, std::memory_order_relaxed);
+	}
+
+	void AsyncAudioBackend::setLoop(SourceID source, bool flag)
+	{
+		const std::size_t slot = findSlot(source);
+		if (slot == MAX_SOURCES)
+			return;
+
+		Command command = makeCommand(Command::Type::SetLoop, slot);
+		command.flag = flag;
+		pushCommand(command);
+	}
+
+	void AsyncAudioBackend::setVolume(SourceID source, float volume)
+	{
+		const std::size_t slot = findSlot(source);
+		if (slot == MAX_SOURCES)
+			return;
+
+		Command command = makeCommand(Command::Type::SetVolume, slot);
+		command.volume = volume;
+		pushCommand(command);
+	}
+
+	void AsyncAudioBackend::fade(SourceID source, float gain, sf::Time duration, bool stop)
+	{
+		const std::size_t slot = findSlot(source);
+		if (slot == MAX_SOURCES)
+			return;
+
+		Command command = makeCommand(Command::Type::Fade, slot);
+		command.volume = gain;
+		command.offset = duration;
+		command.flag = stop;
+		pushCommand(command);
+	}
+
+	void AsyncAudioBackend::setLayerGain(SourceID source, std::size_t layer, float gain, sf::Time duration)
+	{
+		const std::size_t slot = findSlot(source);
+		if (slot == MAX_SOURCES)
+			return;
+
+		Command command = makeCommand(Command::Type::SetLayerGain, slot);
+		command.layer = layer;
+		command.volume = gain;
+		command.offset = duration;
+		pushCommand(command);
+	}
+
+	void AsyncAudioBackend::setProperties(SourceID source, const AudioProperties& properties)
+	{
+		const std::size_t slot = findSlot(source);
+		if (slot == MAX_SOURCES)
+			return;
+
+		Command command = makeCommand(Command::Type::SetProperties, slot);
+		command.properties = properties;
+		pushCommand(command);
+	}
+
+	void AsyncAudioBackend::setPosition(SourceID source, const sf::Vector3f& position)
+	{
+		const std::size_t slot = findSlot(source);
+		if (slot == MAX_SOURCES)
+			return;
+
+		Command command = makeCommand(Command::Type::SetPosition, slot);
+		command.position = position;
+		pushCommand(command);
+	}
+
+	void AsyncAudioBackend::setPlayingOffset(SourceID source, sf::Time offset)
+	{
+		const std::size_t slot = findSlot(source);
+		if (slot == MAX_SOURCES)
+			return;
+
+		// The offset is a state change so that the position published by the audio thread isn't read until it has applied it
+		Slot& found = slots_[slot];
+		storeState(found, unpackStatus(found.state.load(std::memory_order_acquire)));
+		found.offset.store(offset.asMicroseconds(), std::memory_order_relaxed);
+
+		Command command = makeCommand(Command::Type::SetPlayingOffset, slot);
+		command.offset = offset;
+		pushCommand(command);
+	}
+
+	sf::Time AsyncAudioBackend::getPlayingOffset(SourceID source) const
+	{
+		flushOverflow();
+
+		const std::size_t slot = findSlot(source);
+		if (slot == MAX_SOURCES)
+			return sf::Time::Zero;
+
+		const Slot& found = slots_[slot];
+		const bool PUBLISHED_STATE = (found.state.load(std::memory_order_acquire) & PUBLISHED) != 0;
+		return sf::microseconds((PUBLISHED_STATE ? found.published : found.offset).load(std::memory_order_relaxed));
+	}
+
+	sf::SoundSource::Status AsyncAudioBackend::getStatus(SourceID source) const
+	{
+		flushOverflow();
+
+		const std::size_t slot = findSlot(source);
+		return (slot != MAX_SOURCES) ? unpackStatus(slots_[slot].state.load(std::memory_order_acquire)) : sf::SoundSource::Status::Stopped;
+	}
+
+	void AsyncAudioBackend::setListenerPosition(const sf::Vector3f& position)
+	{
+		listenerPosition_ = position;
+
+		Command command;
+		command.type = Command::Type::SetListenerPosition;
+		command.position = position;
+		pushCommand(command);
+	}
+
+	sf::Vector3f AsyncAudioBackend::getListenerPosition() const
+	{
+		return listenerPosition_;
+	}
+
+	std::size_t AsyncAudioBackend::getMaxSources() const
+	{
+		return std::min(backend_.getMaxSources(), MAX_SOURCES);
+	}
+
+	sf::Time AsyncAudioBackend::getAudioClock() const
+	{
+		// The audio clocks of the backends are safe to read from any thread
+		return backend_.getAudioClock();
+	}
+
+	AudioBackend::SubmixID AsyncAudioBackend::createSubmix(SubmixID parent)
+	{
+		Command command;
+		command.type = Command::Type::CreateSubmix;
+		command.submix = nextSubmix_++;
+		command.parent = parent;
+		pushCommand(command);
+
+		return command.submix;
+	}
+
+	void AsyncAudioBackend::destroySubmix(SubmixID submix)
+	{
+		Command command;
+		command.type = Command::Type::DestroySubmix;
+		command.submix = submix;
+		pushCommand(command);
+	}
+
+	void AsyncAudioBackend::setSubmixParent(SubmixID submix, SubmixID parent)
+	{
+		Command command;
+		command.type = Command::Type::SetSubmixParent;
+		command.submix = submix;
+		command.parent = parent;
+		pushCommand(command);
+	}
+
+	void AsyncAudioBackend::setSubmixEffects(SubmixID submix, EffectChain* effects)
+	{
+		Command command;
+		command.type = Command::Type::SetSubmixEffects;
+		command.submix = submix;
+		command.effects = effects;
+		pushCommand(command);
+	}
+
+	void AsyncAudioBackend::setSourceSubmix(SourceID source, SubmixID submix)
+	{
+		const std::size_t slot = findSlot(source);
+		if (slot == MAX_SOURCES)
+			return;
+
+		Command command = makeCommand(Command::Type::SetSourceSubmix, slot);
+		command.submix = submix;
+		pushCommand(command);
+	}
+
+	void AsyncAudioBackend::setSourceEffects(SourceID source, EffectChain* effects)
+	{
+		const std::size_t slot = findSlot(source);
+		if (slot == MAX_SOURCES)
+			return;
+
+		Command command = makeCommand(Command::Type::SetSourceEffects, slot);
+		command.effects = effects;
+		pushCommand(command);
+	}
+
+	void AsyncAudioBackend::setLowPass(SourceID source, float cutoff)
+	{
+		const std::size_t slot = findSlot(source);
+		if (slot == MAX_SOURCES)
+			return;
+
+		Command command = makeCommand(Command::Type::SetLowPass, slot);
+		command.volume = cutoff;
+		pushCommand(command);
+	}
+
+	void AsyncAudioBackend::setStreamBuffering(SourceID source, sf::Time bufferTime, sf::Time chunkTime)
+	{
+		const std::size_t slot = findSlot(source);
+		if (slot == MAX_SOURCES)
+			return;
+
+		Command command = makeCommand(Command::Type::SetStreamBuffering, slot);
+		command.offset = bufferTime;
+		command.chunk = chunkTime;
+		pushCommand(command);
+	}
+
+	void AsyncAudioBackend::setMarkers(SourceID source, const std::vector<sf::Time>& markers)
+	{
+		const std::size_t slot = findSlot(source);
+		if (slot == MAX_SOURCES)
+			return;
+
+		// The markers are copied in a payload of the pool, which the audio thread hands back once applied
+		Command command = makeCommand(Command::Type::SetMarkers, slot);
+		command.source = source;
+		command.markers = acquireMarkers();
+		command.markers->assign(markers.begin(), markers.end());
+		pushCommand(command);
+	}
+
+	bool AsyncAudioBackend::pollMarker(SourceID& source, std::size_t& index, sf::Time& clockTime)
+	{
+		MarkerEvent event;
+		if (!markerEvents_.pop(event))
+			return false;
+
+		source = event.source;
+		index = event.index;
+		clockTime = event.clockTime;
+		return true;
+	}
+
+	bool AsyncAudioBackend::getStreamState(SourceID source, float& fill, std::size_t& underruns) const
+	{
+		const std::size_t slot = findSlot(source);
+		if (slot == MAX_SOURCES)
+			return false;
+
+		const float FILL = slots_[slot].fill.load(std::memory_order_relaxed);
+		if (FILL < 0.f)
+			return false;
+
+		fill = FILL;
+		underruns = slots_[slot].underruns.load(std::memory_order_relaxed);
+		return true;
+	}
+
+	sf::Time AsyncAudioBackend::getRenderTime() const
+	{
+		return sf::microseconds(renderTime_.load(std::memory_order_relaxed));
+	}
+
+	std::size_t AsyncAudioBackend::acquireSlot()
+	{
+		std::size_t released = 0;
+		while (releasedSlots_.pop(released))
+			freeSlots_.push_back(released);
+
+		if (freeSlots_.empty())
+			return MAX_SOURCES;
+
+		const std::size_t slot = freeSlots_.back();
+		freeSlots_.pop_back();
+
+		Slot& found = slots_[slot];
+		storeState(found, sf::SoundSource::Status::Stopped);
+		found.offset.store(0, std::memory_order_relaxed);
+
+		return slot;
+	}
+
+	std::vector<sf::Time>* AsyncAudioBackend::acquireMarkers()
+	{
+		std::vector<sf::Time>* released = nullptr;
+		while (releasedMarkers_.pop(released))
+			freeMarkers_.push_back(released);
+
+		// The deque never moves its payloads when it grows, the audio thread may still be reading the others
+		if (freeMarkers_.empty()) {
+			markerPool_.emplace_back();
+			return &markerPool_.back();
+		}
+
+		std::vector<sf::Time>* markers = freeMarkers_.back();
+		freeMarkers_.pop_back();
+		return markers;
+	}
+
+	std::size_t AsyncAudioBackend::findSlot(SourceID source) const
+	{
+		const std::size_t slot = static_cast<std::size_t>(source & SLOT_MASK);
+		if (slot == 0 || slot > MAX_SOURCES || slots_[slot - 1].generation != (source >> SLOT_BITS))
+			return MAX_SOURCES;
+
+		return slot - 1;
+	}
+
+	void AsyncAudioBackend::pushCommand(const Command& command)
+	{
+		// The commands that previously overflowed are pushed first to keep the order
+		if (!flushOverflow() || !commands_.push(command))
+			overflow_.push_back(command);
+	}
+
+	bool AsyncAudioBackend::flushOverflow() const
+	{
+		while (!overflow_.empty() && commands_.push(overflow_.front()))
+			overflow_.pop_front();
+
+		return overflow_.empty();
+	}
+
+	void AsyncAudioBackend::pushStateCommand(Command::Type type, SourceID source, sf::SoundSource::Status status)
+	{
+		const std::size_t slot = findSlot(source);
+		if (slot == MAX_SOURCES)
+			return;
+
+		storeState(slots_[slot], status);
+		pushCommand(makeCommand(type, slot));
+	}
+
+	void AsyncAudioBackend::storeState(Slot& slot, sf::SoundSource::Status status)
+	{
+		// The game thread's position takes over from the published one until the audio thread publishes the new state
+		if (slot.state.load(std::memory_order_acquire) & PUBLISHED)
+			slot.offset.store(slot.published.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		slot.state.store(packState(status, ++slot.sequence), std::memory_order_release);
+	}
+
+	AsyncAudioBackend::Command AsyncAudioBackend::makeCommand(Command::Type type, std::size_t slot) const
+	{
+		Command command;
+		command.type = type;
+		command.slot = slot;
+		command.sequence = slots_[slot].sequence;
+
+		return command;
+	}
+
+	void AsyncAudioBackend::run()
+	{
+		Command command;
+		while (running_.load(std::memory_order_acquire))
+		{
+			bool executed = false;
+			while (commands_.pop(command))
+			{
+				execute(command);
+				executed = true;
+			}
+
+			publishStates();
+			forwardMarkers();
+			if (!executed)
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+
+		while (commands_.pop(command))
+			execute(command);
+	}
+
+	void AsyncAudioBackend::execute(const Command& command)
+	{
+		const std::size_t slot = command.slot;
+		SourceID& source = innerSources_[slot];
+
+		// The submixes' identifiers are given by the game thread, they're mapped to those of the owned backend
+		const SubmixID submix = (command.submix < innerSubmixes_.size()) ? innerSubmixes_[command.submix] : 0;
+		const SubmixID parent = (command.parent < innerSubmixes_.size()) ? innerSubmixes_[command.parent] : 0;
+
+		switch (command.type)
+		{
+		case Command::Type::CreateSound:
+			source = backend_.createSound(*command.buffer);
+			liveSlots_.push_back(slot);
+			break;
+		case Command::Type::CreateStream:
+			source = backend_.createStream(slots_[slot].filepath);
+			liveSlots_.push_back(slot);
+			break;
+		case Command::Type::CreateMemoryStream:
+			source = backend_.createStream(slots_[slot].data, slots_[slot].size);
+			liveSlots_.push_back(slot);
+			break;
+		case Command::Type::CreateInputStream:
+			source = backend_.createStream(std::move(slots_[slot].stream));
+			liveSlots_.push_back(slot);
+			break;
+		case Command::Type::CreateLayeredStream:
+			source = backend_.createLayeredStream(slots_[slot].layers);
+			liveSlots_.push_back(slot);
+			break;
+		case Command::Type::Destroy:
+			backend_.destroySource(source);
+			source = 0;
+			markedSources_[slot] = 0;
+			slots_[slot].fill.store(-1.f, std::memory_order_relaxed);
+			slots_[slot].underruns.store(0, std::memory_order_relaxed);
+			liveSlots_.erase(std::find(liveSlots_.begin(), liveSlots_.end(), slot));
+			releasedSlots_.push(slot);
+			return;
+		case Command::Type::Play:
+			backend_.play(source);
+			break;
+		case Command::Type::PlayAt:
+			backend_.playAt(source, command.offset);
+			break;
+		case Command::Type::Chain:
+			backend_.chain(source, (command.next < MAX_SOURCES) ? innerSources_[command.next] : 0);
+			break;
+		case Command::Type::Pause:
+			backend_.pause(source);
+			break;
+		case Command::Type::Stop:
+			backend_.stop(source);
+			break;
+		case Command::Type::SetLoop:
+			backend_.setLoop(source, command.flag);
+			break;
+		case Command::Type::SetVolume:
+			backend_.setVolume(source, command.volume);
+			break;
+		case Command::Type::Fade:
+			backend_.fade(source, command.volume, command.offset, command.flag);
+			break;
+		case Command::Type::SetLayerGain:
+			backend_.setLayerGain(source, command.layer, command.volume, command.offset);
+			break;
+		case Command::Type::SetProperties:
+			backend_.setProperties(source, command.properties);
+			break;
+		case Command::Type::SetPosition:
+			backend_.setPosition(source, command.position);
+			break;
+		case Command::Type::SetPlayingOffset:
+			backend_.setPlayingOffset(source, command.offset);
+			break;
+		case Command::Type::SetListenerPosition:
+			backend_.setListenerPosition(command.position);
+			return;
+		case Command::Type::SetSourceSubmix:
+			backend_.setSourceSubmix(source, submix);
+			break;
+		case Command::Type::SetSourceEffects:
+			backend_.setSourceEffects(source, command.effects);
+			break;
+		case Command::Type::SetLowPass:
+			backend_.setLowPass(source, command.volume);
+			break;
+		case Command::Type::SetStreamBuffering:
+			backend_.setStreamBuffering(source, command.offset, command.chunk);
+			break;
+		case Command::Type::SetMarkers:
+			backend_.setMarkers(source, *command.markers);
+			markedSources_[slot] = command.markers->empty() ? 0 : command.source;
+			releasedMarkers_.push(command.markers);
+			break;
+		case Command::Type::CreateSubmix:
+			if (command.submix >= innerSubmixes_.size())
+				innerSubmixes_.resize(command.submix + 1, 0);
+			innerSubmixes_[command.submix] = backend_.createSubmix(parent);
+			return;
+		case Command::Type::DestroySubmix:
+			backend_.destroySubmix(submix);
+			if (command.submix < innerSubmixes_.size())
+				innerSubmixes_[command.submix] = 0;
+			return;
+		case Command::Type::SetSubmixParent:
+			backend_.setSubmixParent(submix, parent);
+			return;
+		case Command::Type::SetSubmixEffects:
+			backend_.setSubmixEffects(submix, command.effects);
+			return;
+		}
+
+		appliedSequences_[slot] = command.sequence;
+	}
+
+	void AsyncAudioBackend::publishStates()
+	{
+		renderTime_.store(backend_.getRenderTime().asMicroseconds(), std::memory_order_relaxed);
+		for (std::size_t slot : liveSlots_)
+		{
+			Slot& found = slots_[slot];
+			float fill = 0.f;
+			std::size_t underruns = 0;
+			const bool REPORTED = backend_.getStreamState(innerSources_[slot], fill, underruns);
+			found.fill.store(REPORTED ? fill : -1.f, std::memory_order_relaxed);
+			found.underruns.store(underruns, std::memory_order_relaxed);
+
+			// A state change still waiting in the queue takes precedence over the owned backend's state
+			sf::Uint32 expected = found.state.load(std::memory_order_acquire);
+			const sf::Uint32 sequence = appliedSequences_[slot] & SEQUENCE_MASK;
+			if (unpackSequence(expected) != sequence)
+				continue;
+
+			// The position is published before the state, the game thread only reads it if no state change was queued in between
+			const SourceID source = innerSources_[slot];
+			found.published.store(backend_.getPlayingOffset(source).asMicroseconds(), std::memory_order_relaxed);
+			found.state.compare_exchange_strong(expected, packState(backend_.getStatus(source), sequence) | PUBLISHED, std::memory_order_acq_rel);
+		}
+	}
+
+	void AsyncAudioBackend::forwardMarkers()
+	{
+		SourceID inner = 0;
+		std::size_t index = 0;
+		sf::Time clockTime;
+		while (backend_.pollMarker(inner, index, clockTime))
+		{
+			// The owned backend reports its own identifiers, the markers of a source destroyed since are dropped
+			auto slot = std::find_if(liveSlots_.cbegin(), liveSlots_.cend(), [this, inner](std::size_t live) {
+				return innerSources_[live] == inner;
+			});
+			if (slot != liveSlots_.cend() && markedSources_[*slot])
+				markerEvents_.push(MarkerEvent{ markedSources_[*slot], index, clockTime });
+		}
+	}
+}
\ No newline at end of file
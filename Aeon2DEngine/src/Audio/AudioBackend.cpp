@@ -0,0 +1,86 @@
+#include "../../include/Audio/SfmlAudioBackend.h"
+#include "../../include/Audio/AudioBackend.h"
+
+namespace ae
+{
+	AudioBackend::~AudioBackend()
+	{
+	}
+
+	AudioBackend& AudioBackend::getDefault()
+	{
+		static SfmlAudioBackend backend;
+		return backend;
+	}
+
+	AudioBackend::SourceID AudioBackend::createLayeredStream(const std::vector<std::string>&)
+	{
+		return 0;
+	}
+
+	bool AudioBackend::supportsLayeredStreams() const
+	{
+		return false;
+	}
+
+	bool AudioBackend::chain(SourceID, SourceID)
+	{
+		return false;
+	}
+
+	void AudioBackend::setLayerGain(SourceID, std::size_t, float, sf::Time)
+	{
+	}
+
+	AudioBackend::SubmixID AudioBackend::createSubmix(SubmixID)
+	{
+		return 0;
+	}
+
+	void AudioBackend::destroySubmix(SubmixID)
+	{
+	}
+
+	void AudioBackend::setSubmixParent(SubmixID, SubmixID)
+	{
+	}
+
+	void AudioBackend::setSubmixEffects(SubmixID, EffectChain*)
+	{
+	}
+
+	void AudioBackend::setSourceSubmix(SourceID, SubmixID)
+	{
+	}
+
+	void AudioBackend::setSourceEffects(SourceID, EffectChain*)
+	{
+	}
+
+	void AudioBackend::setLowPass(SourceID, float)
+	{
+	}
+
+	void AudioBackend::setStreamBuffering(SourceID, sf::Time, sf::Time)
+	{
+	}
+
+	bool AudioBackend::getStreamState(SourceID, float&, std::size_t&) const
+	{
+		return false;
+	}
+
+	void AudioBackend::setMarkers(SourceID, const std::vector<sf::Time>&)
+	{
+	}
+
+	bool AudioBackend::pollMarker(SourceID&, std::size_t&, sf::Time&)
+	{
+		return false;
+	}
+
+	sf::Time AudioBackend::getRenderTime() const
+	{
+		return sf::Time::Zero;
+	}
+}
\ No newline at end of file
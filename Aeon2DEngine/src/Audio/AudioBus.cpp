@@ -0,0 +1,276 @@
+#include <algorithm>
+#include <cmath>
+
+#include "../../include/Audio/AudioBus.h"
+
+namespace ae
+{
+	AudioBus::AudioBus(AudioBus* parent)
+		: parent_(nullptr)
+		, children_()
+		, sources_()
+		, duckers_()
+		, ducked_()
+		, submixes_()
+		, effects_(nullptr)
+		, sourceCount_(0)
+		, volume_(100.f)
+		, duckVolume_(1.f)
+		, duckTarget_(1.f)
+		, duckLeft_(sf::Time::Zero)
+		, duckRelease_(sf::Time::Zero)
+		, duckClock_(sf::Time::Zero)
+		, gain_(1.f)
+	{
+		setParent(parent);
+	}
+
+	AudioBus::~AudioBus()
+	{
+		setParent(nullptr);
+		for (AudioBus* child : std::vector<AudioBus*>(children_))
+			child->setParent(nullptr);
+		for (AudioBus* target : std::vector<AudioBus*>(ducked_))
+			removeDucking(*target);
+		for (const Ducker& ducker : std::vector<Ducker>(duckers_))
+			ducker.bus->removeDucking(*this);
+		for (const Submix& submix : submixes_)
+			submix.backend->destroySubmix(submix.id);
+	}
+
+	void AudioBus::setParent(AudioBus* parent)
+	{
+		if (parent_ == parent)
+			return;
+
+		if (parent_) {
+			parent_->addSourceCount(-static_cast<long>(sourceCount_));
+			parent_->children_.erase(std::find(parent_->children_.begin(), parent_->children_.end(), this));
+		}
+		parent_ = parent;
+		if (parent_) {
+			parent_->children_.push_back(this);
+			parent_->addSourceCount(static_cast<long>(sourceCount_));
+		}
+
+		updateGain();
+		updateRouting();
+	}
+
+	AudioBus* AudioBus::getParent() const
+	{
+		return parent_;
+	}
+
+	void AudioBus::setVolume(float volume)
+	{
+		// Verifies that the volume is within the range [0, 100]
+		volume_ = fmaxf(fminf(volume, 100.f), 0.f);
+		updateGain();
+	}
+
+	float AudioBus::getVolume() const
+	{
+		return volume_;
+	}
+
+	float AudioBus::getGain() const
+	{
+		return gain_;
+	}
+
+	void AudioBus::setDucking(AudioBus& target, float volume, sf::Time attack, sf::Time release)
+	{
+		volume = fmaxf(fminf(volume, 100.f), 0.f) / 100.f;
+		attack = std::max(attack, sf::Time::Zero);
+		release = std::max(release, sf::Time::Zero);
+
+		auto found = std::find_if(target.duckers_.begin(), target.duckers_.end(), [this](const Ducker& d) { return d.bus == this; });
+		if (found != target.duckers_.end())
+			*found = Ducker{ this, volume, attack, release };
+		else {
+			target.duckers_.push_back(Ducker{ this, volume, attack, release });
+			ducked_.push_back(&target);
+		}
+
+		target.updateDucking();
+	}
+
+	void AudioBus::removeDucking(AudioBus& target)
+	{
+		auto found = std::find(ducked_.begin(), ducked_.end(), &target);
+		if (found == ducked_.end())
+			return;
+
+		ducked_.erase(found);
+		target.duckers_.erase(std::find_if(target.duckers_.begin(), target.duckers_.end(), [this](const Ducker& d) { return d.bus == this; }));
+		target.updateDucking();
+	}
+
+	void AudioBus::setEffects(EffectChain* effects)
+	{
+		effects_ = effects;
+		updateRouting();
+	}
+
+	EffectChain* AudioBus::getEffects() const
+	{
+		return effects_;
+	}
+
+	void AudioBus::attach(AudioBackend& backend, AudioBackend::SourceID source, float volume)
+	{
+		sources_.push_back(Source{ &backend, source, volume });
+		backend.setVolume(source, volume * gain_);
+		backend.setSourceSubmix(source, getRoute(backend));
+		addSourceCount(1);
+	}
+
+	void AudioBus::detach(AudioBackend& backend, AudioBackend::SourceID source)
+	{
+		auto found = std::find_if(sources_.begin(), sources_.end(), [&backend, source](const Source& s) {
+			return s.backend == &backend && s.id == source;
+		});
+		if (found == sources_.end())
+			return;
+
+		// The order of the sources doesn't matter, the last one takes the place of the detached one
+		*found = sources_.back();
+		sources_.pop_back();
+		addSourceCount(-1);
+	}
+
+	void AudioBus::setSourceVolume(AudioBackend& backend, AudioBackend::SourceID source, float volume)
+	{
+		auto found = std::find_if(sources_.begin(), sources_.end(), [&backend, source](const Source& s) {
+			return s.backend == &backend && s.id == source;
+		});
+		if (found == sources_.end())
+			return;
+
+		found->volume = volume;
+		backend.setVolume(source, volume * gain_);
+	}
+
+	std::size_t AudioBus::getSourceCount() const
+	{
+		return sourceCount_;
+	}
+
+	void AudioBus::update(sf::Time clockTime)
+	{
+		for (AudioBus* bus = this; bus; bus = bus->parent_)
+			bus->advanceDucking(clockTime);
+	}
+
+	void AudioBus::updateGain()
+	{
+		gain_ = (parent_ ? parent_->gain_ : 1.f) * volume_ / 100.f * duckVolume_;
+
+		for (const Source& source : sources_)
+			source.backend->setVolume(source.id, source.volume * gain_);
+		for (AudioBus* child : children_)
+			child->updateGain();
+	}
+
+	void AudioBus::updateDucking()
+	{
+		float duckTarget = 1.f;
+		const Ducker* applying = nullptr;
+		for (const Ducker& ducker : duckers_) {
+			if (ducker.bus->sourceCount_ > 0 && ducker.volume < duckTarget) {
+				duckTarget = ducker.volume;
+				applying = &ducker;
+			}
+		}
+		if (duckTarget == duckTarget_)
+			return;
+
+		// Ramp down over the attack of the ducker now applied, back up over the release of the one applied until now
+		duckTarget_ = duckTarget;
+		duckLeft_ = (duckTarget < duckVolume_) ? applying->attack : duckRelease_;
+		duckRelease_ = applying ? applying->release : sf::Time::Zero;
+		duckClock_ = sf::Time::Zero;
+		if (duckLeft_ == sf::Time::Zero && duckVolume_ != duckTarget_) {
+			duckVolume_ = duckTarget_;
+			updateGain();
+		}
+	}
+
+	void AudioBus::advanceDucking(sf::Time clockTime)
+	{
+		if (duckLeft_ == sf::Time::Zero)
+			return;
+
+		// The ramp starts from the first time it's advanced, the clock of the audio players isn't known before
+		const sf::Time ELAPSED = (duckClock_ > sf::Time::Zero && clockTime > duckClock_) ? clockTime - duckClock_ : sf::Time::Zero;
+		duckClock_ = clockTime;
+		if (ELAPSED == sf::Time::Zero)
+			return;
+
+		const sf::Time STEP = std::min(ELAPSED, duckLeft_);
+		duckVolume_ += (duckTarget_ - duckVolume_) * (STEP / duckLeft_);
+		duckLeft_ -= STEP;
+		updateGain();
+	}
+
+	void AudioBus::addSourceCount(long count)
+	{
+		if (count == 0)
+			return;
+
+		// The buses ducked are only updated when the bus becomes active or inactive
+		const bool WAS_ACTIVE = sourceCount_ > 0;
+		sourceCount_ = static_cast<std::size_t>(static_cast<long>(sourceCount_) + count);
+		if (WAS_ACTIVE != (sourceCount_ > 0))
+			for (AudioBus* target : ducked_)
+				target->updateDucking();
+
+		if (parent_)
+			parent_->addSourceCount(count);
+	}
+
+	AudioBackend::SubmixID AudioBus::getRoute(AudioBackend& backend)
+	{
+		for (AudioBus* bus = this; bus; bus = bus->parent_)
+			if (bus->effects_)
+				return bus->getSubmix(backend);
+		return 0;
+	}
+
+	AudioBackend::SubmixID AudioBus::getSubmix(AudioBackend& backend)
+	{
+		auto found = std::find_if(submixes_.begin(), submixes_.end(), [&backend](const Submix& s) { return s.backend == &backend; });
+		if (found != submixes_.end())
+			return found->id;
+
+		// The submix is created the first time a source of the backend is routed to the bus
+		const AudioBackend::SubmixID ID = backend.createSubmix(parent_ ? parent_->getRoute(backend) : 0);
+		if (ID) {
+			backend.setSubmixEffects(ID, effects_);
+			submixes_.push_back(Submix{ &backend, ID });
+		}
+		return ID;
+	}
+
+	void AudioBus::updateRouting()
+	{
+		for (const Submix& submix : submixes_) {
+			if (effects_) {
+				submix.backend->setSubmixEffects(submix.id, effects_);
+				submix.backend->setSubmixParent(submix.id, parent_ ? parent_->getRoute(*submix.backend) : 0);
+			}
+		}
+		for (const Source& source : sources_)
+			source.backend->setSourceSubmix(source.id, getRoute(*source.backend));
+		for (AudioBus* child : children_)
+			child->updateRouting();
+
+		// A bus without effects no longer needs its submixes once everything is rerouted around them
+		if (!effects_) {
+			for (const Submix& submix : submixes_)
+				submix.backend->destroySubmix(submix.id);
+			submixes_.clear();
+		}
+	}
+}
\ No newline at end of file
@@ -11,6 +11,7 @@ namespace ae
 		                             float minDistance2d, bool relativeToListener)
 		: pitch_(pitch)
 		, relativeToListener_(relativeToListener)
+		, priority_(0)
 	{
 		setVolume(volume);
 		setAttenuation(attenuation);
@@ -24,6 +25,7 @@ namespace ae
 		, minDistance2d_(copy.minDistance2d_)
 		, minDistance3d_(copy.minDistance3d_)
 		, relativeToListener_(copy.relativeToListener_)
+		, priority_(copy.priority_)
 	{
 	}
 
@@ -34,6 +36,7 @@ namespace ae
 		, minDistance2d_(std::move(other.minDistance2d_))
 		, minDistance3d_(std::move(other.minDistance3d_))
 		, relativeToListener_(std::move(other.relativeToListener_))
+		, priority_(std::move(other.priority_))
 	{
 	}
 
@@ -45,6 +48,7 @@ namespace ae
 		minDistance2d_ = other.minDistance2d_;
 		minDistance3d_ = other.minDistance3d_;
 		relativeToListener_ = other.relativeToListener_;
+		priority_ = other.priority_;
 
 		return *this;
 	}
@@ -57,6 +61,7 @@ namespace ae
 		minDistance2d_ = std::move(other.minDistance2d_);
 		minDistance3d_ = std::move(other.minDistance3d_);
 		relativeToListener_ = std::move(other.relativeToListener_);
+		priority_ = std::move(other.priority_);
 
 		return *this;
 	}
@@ -65,14 +70,16 @@ namespace ae
 	{
 		return ap1.volume_ == ap2.volume_ && ap1.attenuation_ == ap2.attenuation_
 			&& ap1.pitch_ == ap2.pitch_ && ap1.minDistance2d_ == ap2.minDistance2d_
-			&& ap1.minDistance3d_ == ap2.minDistance3d_ && ap1.relativeToListener_ == ap2.relativeToListener_;
+			&& ap1.minDistance3d_ == ap2.minDistance3d_ && ap1.relativeToListener_ == ap2.relativeToListener_
+			&& ap1.priority_ == ap2.priority_;
 	}
 
 	bool operator!=(const AudioProperties& ap1, const AudioProperties& ap2)
 	{
 		return ap1.volume_ != ap2.volume_ || ap1.attenuation_ != ap2.attenuation_
 			|| ap1.pitch_ != ap2.pitch_ || ap1.minDistance2d_ != ap2.minDistance2d_
-			|| ap1.minDistance3d_ != ap2.minDistance3d_ || ap1.relativeToListener_ != ap2.relativeToListener_;
+			|| ap1.minDistance3d_ != ap2.minDistance3d_ || ap1.relativeToListener_ != ap2.relativeToListener_
+			|| ap1.priority_ != ap2.priority_;
 	}
 
 	void AudioProperties::setVolume(float volume)
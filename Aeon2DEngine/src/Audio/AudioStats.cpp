@@ -0,0 +1,20 @@
+#include "../../include/Audio/AudioStats.h"
+
+namespace ae
+{
+	AudioStats::AudioStats()
+		: activeVoices(0)
+		, realVoices(0)
+		, peakVoices(0)
+		, plays(0)
+		, playsPerSecond(0.f)
+		, droppedPlays(0)
+		, culledVoices(0)
+		, stolenVoices(0)
+		, streams(0)
+		, minStreamFill(1.f)
+		, underruns(0)
+		, renderTime(sf::Time::Zero)
+	{
+	}
+}
\ No newline at end of file
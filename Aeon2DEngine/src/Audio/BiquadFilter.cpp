@@ -0,0 +1,140 @@
+#include <cmath>
+
+#include "../../include/Utils/Simd.h"
+#include "../../include/Audio/BiquadFilter.h"
+
+namespace ae
+{
+	BiquadFilter::BiquadFilter(Type type, float cutoff, float q)
+		: AudioEffect()
+		, type_(type)
+		, cutoff_(fmaxf(cutoff, 1.f))
+		, q_(fmaxf(q, 0.01f))
+		, dirty_(true)
+		, sampleRate_(0)
+		, b0_(1.f)
+		, b1_(0.f)
+		, b2_(0.f)
+		, a1_(0.f)
+		, a2_(0.f)
+		, z1_{ 0.f, 0.f }
+		, z2_{ 0.f, 0.f }
+	{
+	}
+
+	void BiquadFilter::process(float* frames, std::size_t frameCount, unsigned int sampleRate)
+	{
+		updateCoefficients(sampleRate);
+		std::size_t i = 0;
+
+#if defined(AE_SIMD_SSE)
+		// The recursion forbids processing several frames at once, the left and right channels share the register instead
+		const __m128 B0 = _mm_set1_ps(b0_), B1 = _mm_set1_ps(b1_), B2 = _mm_set1_ps(b2_);
+		const __m128 A1 = _mm_set1_ps(a1_), A2 = _mm_set1_ps(a2_);
+		__m128 z1 = _mm_setr_ps(z1_[0], z1_[1], 0.f, 0.f);
+		__m128 z2 = _mm_setr_ps(z2_[0], z2_[1], 0.f, 0.f);
+		for (; i < frameCount; ++i) {
+			double* frame = reinterpret_cast<double*>(frames + i * 2);
+			const __m128 X = _mm_castpd_ps(_mm_load_sd(frame));
+			const __m128 Y = _mm_add_ps(_mm_mul_ps(B0, X), z1);
+			z1 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(B1, X), _mm_mul_ps(A1, Y)), z2);
+			z2 = _mm_sub_ps(_mm_mul_ps(B2, X), _mm_mul_ps(A2, Y));
+			_mm_store_sd(frame, _mm_castps_pd(Y));
+		}
+
+		alignas(16) float state[4];
+		_mm_store_ps(state, z1);
+		z1_[0] = state[0];
+		z1_[1] = state[1];
+		_mm_store_ps(state, z2);
+		z2_[0] = state[0];
+		z2_[1] = state[1];
+#endif
+		for (; i < frameCount; ++i) {
+			for (unsigned int c = 0; c < 2; ++c) {
+				const float X = frames[i * 2 + c];
+				const float Y = b0_ * X + z1_[c];
+				z1_[c] = b1_ * X - a1_ * Y + z2_[c];
+				z2_[c] = b2_ * X - a2_ * Y;
+				frames[i * 2 + c] = Y;
+			}
+		}
+	}
+
+	void BiquadFilter::reset()
+	{
+		z1_[0] = z1_[1] = 0.f;
+		z2_[0] = z2_[1] = 0.f;
+	}
+
+	void BiquadFilter::setType(Type type)
+	{
+		type_ = type;
+		dirty_ = true;
+	}
+
+	BiquadFilter::Type BiquadFilter::getType() const
+	{
+		return type_;
+	}
+
+	void BiquadFilter::setCutoff(float cutoff)
+	{
+		cutoff_ = fmaxf(cutoff, 1.f);
+		dirty_ = true;
+	}
+
+	float BiquadFilter::getCutoff() const
+	{
+		return cutoff_;
+	}
+
+	void BiquadFilter::setQ(float q)
+	{
+		q_ = fmaxf(q, 0.01f);
+		dirty_ = true;
+	}
+
+	float BiquadFilter::getQ() const
+	{
+		return q_;
+	}
+
+	void BiquadFilter::updateCoefficients(unsigned int sampleRate)
+	{
+		if (!dirty_.exchange(false) && sampleRate == sampleRate_)
+			return;
+
+		// RBJ Audio EQ Cookbook, normalized by a0
+		sampleRate_ = sampleRate;
+		const double PI = 3.14159265358979323846;
+		const double CUTOFF = std::fmin(cutoff_.load(), sampleRate * 0.49);
+		const double OMEGA = 2.0 * PI * CUTOFF / sampleRate;
+		const double COS = std::cos(OMEGA);
+		const double ALPHA = std::sin(OMEGA) / (2.0 * q_.load());
+		const double A0 = 1.0 + ALPHA;
+
+		double b0 = 0.0, b1 = 0.0, b2 = 0.0;
+		switch (type_.load())
+		{
+		case Type::LowPass:
+			b0 = b2 = (1.0 - COS) / 2.0;
+			b1 = 1.0 - COS;
+			break;
+		case Type::HighPass:
+			b0 = b2 = (1.0 + COS) / 2.0;
+			b1 = -(1.0 + COS);
+			break;
+		case Type::BandPass:
+			b0 = ALPHA;
+			b2 = -ALPHA;
+			break;
+		}
+
+		b0_ = static_cast<float>(b0 / A0);
+		b1_ = static_cast<float>(b1 / A0);
+		b2_ = static_cast<float>(b2 / A0);
+		a1_ = static_cast<float>(-2.0 * COS / A0);
+		a2_ = static_cast<float>((1.0 - ALPHA) / A0);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,175 @@
+#include <algorithm>
+
+#include <SFML/Audio/InputSoundFile.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+
+#include "../../include/Audio/CompressedSoundBuffer.h"
+
+namespace ae
+{
+	namespace
+	{
+		// IMA-ADPCM's quantizer steps and the step index adjustment of each code
+		const int STEPS[89] = {
+			7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143,
+			157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552,
+			1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487,
+			12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+		};
+		const int INDEX_ADJUSTMENTS[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+		// Applies a 4-bit code to the decoder's state and returns the new sample (the encoder runs the same to stay in sync)
+		int decodeCode(unsigned int code, int& predictor, int& stepIndex)
+		{
+			const int STEP = STEPS[stepIndex];
+			int delta = STEP >> 3;
+			if (code & 4)
+				delta += STEP;
+			if (code & 2)
+				delta += STEP >> 1;
+			if (code & 1)
+				delta += STEP >> 2;
+			predictor = std::min(std::max(predictor + ((code & 8) ? -delta : delta), -32768), 32767);
+			stepIndex = std::min(std::max(stepIndex + INDEX_ADJUSTMENTS[code & 7], 0), 88);
+			return predictor;
+		}
+
+		unsigned int encodeSample(int sample, int& predictor, int& stepIndex)
+		{
+			int difference = sample - predictor;
+			unsigned int code = 0;
+			if (difference < 0) {
+				code = 8;
+				difference = -difference;
+			}
+
+			int step = STEPS[stepIndex];
+			for (unsigned int bit = 4; bit > 0; bit >>= 1, step >>= 1) {
+				if (difference >= step) {
+					code |= bit;
+					difference -= step;
+				}
+			}
+
+			decodeCode(code, predictor, stepIndex);
+			return code;
+		}
+	}
+
+	CompressedSoundBuffer::CompressedSoundBuffer()
+		: data_()
+		, states_()
+		, frameCount_(0)
+		, channelCount_(0)
+		, sampleRate_(0)
+	{
+	}
+
+	bool CompressedSoundBuffer::loadFromFile(const std::string& filepath)
+	{
+		sf::InputSoundFile file;
+		if (!file.openFromFile(filepath) || file.getChannelCount() == 0)
+			return false;
+
+		std::vector<sf::Int16> samples(static_cast<std::size_t>(file.getSampleCount()));
+		samples.resize(static_cast<std::size_t>(file.read(samples.data(), samples.size())));
+		return loadFromSamples(samples.data(), samples.size(), file.getChannelCount(), file.getSampleRate());
+	}
+
+	bool CompressedSoundBuffer::loadFromSamples(const sf::Int16* samples, sf::Uint64 sampleCount, unsigned int channelCount, unsigned int sampleRate)
+	{
+		data_.clear();
+		states_.clear();
+		frameCount_ = 0;
+		channelCount_ = channelCount;
+		sampleRate_ = sampleRate;
+		if (channelCount == 0 || sampleCount < channelCount)
+			return false;
+
+		frameCount_ = sampleCount / channelCount;
+		const std::size_t SAMPLE_COUNT = static_cast<std::size_t>(frameCount_ * channelCount);
+		data_.assign((SAMPLE_COUNT + 1) / 2, 0);
+		states_.reserve(static_cast<std::size_t>((frameCount_ + BLOCK_FRAMES - 1) / BLOCK_FRAMES) * channelCount);
+
+		// Each channel has its own encoder, its state is saved at the start of each block
+		std::vector<int> predictors(channelCount, 0), stepIndices(channelCount, 0);
+		for (std::size_t i = 0; i < SAMPLE_COUNT; ++i) {
+			const unsigned int CHANNEL = i % channelCount;
+			if ((i / channelCount) % BLOCK_FRAMES == 0)
+				states_.push_back(BlockState{ static_cast<sf::Int16>(predictors[CHANNEL]), static_cast<sf::Uint8>(stepIndices[CHANNEL]) });
+
+			const unsigned int CODE = encodeSample(samples[i], predictors[CHANNEL], stepIndices[CHANNEL]);
+			data_[i / 2] |= static_cast<sf::Uint8>((i & 1) ? CODE << 4 : CODE);
+		}
+		return true;
+	}
+
+	std::size_t CompressedSoundBuffer::read(sf::Int16* samples, sf::Uint64 firstFrame, std::size_t frameCount) const
+	{
+		if (firstFrame >= frameCount_)
+			return 0;
+		frameCount = static_cast<std::size_t>(std::min<sf::Uint64>(frameCount, frameCount_ - firstFrame));
+
+		// The decoding starts at the block containing the first frame, the frames before it are skipped
+		const std::size_t BLOCK = static_cast<std::size_t>(firstFrame / BLOCK_FRAMES);
+		std::vector<int> predictors(channelCount_), stepIndices(channelCount_);
+		for (unsigned int c = 0; c < channelCount_; ++c) {
+			predictors[c] = states_[BLOCK * channelCount_ + c].predictor;
+			stepIndices[c] = states_[BLOCK * channelCount_ + c].stepIndex;
+		}
+
+		const std::size_t START = BLOCK * BLOCK_FRAMES * channelCount_;
+		const std::size_t FIRST = static_cast<std::size_t>(firstFrame * channelCount_);
+		const std::size_t END = FIRST + frameCount * channelCount_;
+		unsigned int channel = 0;
+		for (std::size_t i = START; i < END; ++i) {
+			const unsigned int CODE = (data_[i / 2] >> ((i & 1) * 4)) & 0xF;
+			const int SAMPLE = decodeCode(CODE, predictors[channel], stepIndices[channel]);
+			if (i >= FIRST)
+				samples[i - FIRST] = static_cast<sf::Int16>(SAMPLE);
+			if (++channel == channelCount_)
+				channel = 0;
+		}
+		return frameCount;
+	}
+
+	bool CompressedSoundBuffer::decode(sf::SoundBuffer& buffer) const
+	{
+		if (frameCount_ == 0)
+			return false;
+
+		std::vector<sf::Int16> samples(static_cast<std::size_t>(frameCount_ * channelCount_));
+		read(samples.data(), 0, static_cast<std::size_t>(frameCount_));
+		return buffer.loadFromSamples(samples.data(), samples.size(), channelCount_, sampleRate_);
+	}
+
+	sf::Uint64 CompressedSoundBuffer::getFrameCount() const
+	{
+		return frameCount_;
+	}
+
+	unsigned int CompressedSoundBuffer::getChannelCount() const
+	{
+		return channelCount_;
+	}
+
+	unsigned int CompressedSoundBuffer::getSampleRate() const
+	{
+		return sampleRate_;
+	}
+
+	sf::Time CompressedSoundBuffer::getDuration() const
+	{
+		return sampleRate_ ? sf::microseconds(static_cast<sf::Int64>(frameCount_ * 1000000 / sampleRate_)) : sf::Time::Zero;
+	}
+
+	std::size_t CompressedSoundBuffer::getSize() const
+	{
+		return data_.size() + states_.size() * sizeof(BlockState);
+	}
+
+	std::size_t CompressedSoundBuffer::getDecodedSize() const
+	{
+		return static_cast<std::size_t>(frameCount_ * channelCount_ * sizeof(sf::Int16));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,173 @@
+#include <algorithm>
+#include <cmath>
+
+#include "../../include/Utils/Simd.h"
+#include "../../include/Audio/Compressor.h"
+
+namespace ae
+{
+	namespace
+	{
+		// The amount of frames sharing an envelope and a gain target
+		const std::size_t RUN_FRAMES = 16;
+
+		float detectPeak(const float* samples, std::size_t count)
+		{
+			std::size_t i = 0;
+			float peak = 0.f;
+#if defined(AE_SIMD_AVX)
+			const __m256 ABS_MASK_8 = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+			__m256 peak8 = _mm256_setzero_ps();
+			for (; i + 8 <= count; i += 8)
+				peak8 = _mm256_max_ps(peak8, _mm256_and_ps(_mm256_loadu_ps(samples + i), ABS_MASK_8));
+			const __m128 PEAK_4 = _mm_max_ps(_mm256_castps256_ps128(peak8), _mm256_extractf128_ps(peak8, 1));
+			alignas(16) float peaks[4];
+			_mm_store_ps(peaks, PEAK_4);
+			peak = std::max(std::max(peaks[0], peaks[1]), std::max(peaks[2], peaks[3]));
+#elif defined(AE_SIMD_SSE)
+			const __m128 ABS_MASK_4 = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+			__m128 peak4 = _mm_setzero_ps();
+			for (; i + 4 <= count; i += 4)
+				peak4 = _mm_max_ps(peak4, _mm_and_ps(_mm_loadu_ps(samples + i), ABS_MASK_4));
+			alignas(16) float peaks[4];
+			_mm_store_ps(peaks, peak4);
+			peak = std::max(std::max(peaks[0], peaks[1]), std::max(peaks[2], peaks[3]));
+#endif
+			for (; i < count; ++i)
+				peak = std::max(peak, std::fabs(samples[i]));
+			return peak;
+		}
+
+		void applyGain(float* samples, std::size_t count, float startGain, float endGain)
+		{
+			// The gain is ramped per frame, both samples of a frame sharing it
+			const float DELTA = (endGain - startGain) / static_cast<float>(count / 2);
+			std::size_t i = 0;
+#if defined(AE_SIMD_AVX)
+			const __m256 OFFSETS_8 = _mm256_setr_ps(0.f, 0.f, 1.f, 1.f, 2.f, 2.f, 3.f, 3.f);
+			const __m256 START_8 = _mm256_set1_ps(startGain);
+			const __m256 DELTA_8 = _mm256_set1_ps(DELTA);
+			for (; i + 8 <= count; i += 8) {
+				const __m256 GAINS = _mm256_add_ps(START_8, _mm256_mul_ps(DELTA_8, _mm256_add_ps(_mm256_set1_ps(static_cast<float>(i / 2)), OFFSETS_8)));
+				_mm256_storeu_ps(samples + i, _mm256_mul_ps(_mm256_loadu_ps(samples + i), GAINS));
+			}
+#elif defined(AE_SIMD_SSE)
+			const __m128 OFFSETS_4 = _mm_setr_ps(0.f, 0.f, 1.f, 1.f);
+			const __m128 START_4 = _mm_set1_ps(startGain);
+			const __m128 DELTA_4 = _mm_set1_ps(DELTA);
+			for (; i + 4 <= count; i += 4) {
+				const __m128 GAINS = _mm_add_ps(START_4, _mm_mul_ps(DELTA_4, _mm_add_ps(_mm_set1_ps(static_cast<float>(i / 2)), OFFSETS_4)));
+				_mm_storeu_ps(samples + i, _mm_mul_ps(_mm_loadu_ps(samples + i), GAINS));
+			}
+#endif
+			for (; i < count; ++i)
+				samples[i] *= startGain + DELTA * static_cast<float>(i / 2);
+		}
+	}
+
+	Compressor::Compressor(float threshold, float ratio)
+		: AudioEffect()
+		, threshold_(threshold)
+		, ratio_(std::max(ratio, 1.f))
+		, attack_(10000)
+		, release_(100000)
+		, makeupGain_(0.f)
+		, reduction_(0.f)
+		, envelope_(0.f)
+		, gain_(1.f)
+	{
+	}
+
+	void Compressor::process(float* frames, std::size_t frameCount, unsigned int sampleRate)
+	{
+		const float THRESHOLD = threshold_;
+		const float SLOPE = 1.f - 1.f / ratio_;
+		const float MAKEUP = std::pow(10.f, makeupGain_ / 20.f);
+
+		// One-pole coefficients of the envelope, per run of frames
+		const float RUN_TIME = static_cast<float>(RUN_FRAMES) / sampleRate;
+		const float ATTACK = std::exp(-RUN_TIME / std::max(attack_ / 1000000.f, 1e-6f));
+		const float RELEASE = std::exp(-RUN_TIME / std::max(release_ / 1000000.f, 1e-6f));
+
+		float reduction = 0.f;
+		for (std::size_t i = 0; i < frameCount; i += RUN_FRAMES) {
+			const std::size_t RUN = std::min(RUN_FRAMES, frameCount - i);
+			float* run = frames + i * 2;
+
+			const float PEAK = detectPeak(run, RUN * 2);
+			const float COEFFICIENT = (PEAK > envelope_) ? ATTACK : RELEASE;
+			envelope_ = PEAK + COEFFICIENT * (envelope_ - PEAK);
+
+			const float OVER = 20.f * std::log10(std::max(envelope_, 1e-9f)) - THRESHOLD;
+			reduction = (OVER > 0.f) ? OVER * SLOPE : 0.f;
+			const float GAIN = std::pow(10.f, -reduction / 20.f) * MAKEUP;
+
+			applyGain(run, RUN * 2, gain_, GAIN);
+			gain_ = GAIN;
+		}
+
+		reduction_ = reduction;
+	}
+
+	void Compressor::reset()
+	{
+		envelope_ = 0.f;
+		gain_ = std::pow(10.f, makeupGain_ / 20.f);
+		reduction_ = 0.f;
+	}
+
+	void Compressor::setThreshold(float threshold)
+	{
+		threshold_ = threshold;
+	}
+
+	float Compressor::getThreshold() const
+	{
+		return threshold_;
+	}
+
+	void Compressor::setRatio(float ratio)
+	{
+		ratio_ = std::max(ratio, 1.f);
+	}
+
+	float Compressor::getRatio() const
+	{
+		return ratio_;
+	}
+
+	void Compressor::setAttack(sf::Time attack)
+	{
+		attack_ = std::max(attack, sf::Time::Zero).asMicroseconds();
+	}
+
+	sf::Time Compressor::getAttack() const
+	{
+		return sf::microseconds(attack_);
+	}
+
+	void Compressor::setRelease(sf::Time release)
+	{
+		release_ = std::max(release, sf::Time::Zero).asMicroseconds();
+	}
+
+	sf::Time Compressor::getRelease() const
+	{
+		return sf::microseconds(release_);
+	}
+
+	void Compressor::setMakeupGain(float makeupGain)
+	{
+		makeupGain_ = makeupGain;
+	}
+
+	float Compressor::getMakeupGain() const
+	{
+		return makeupGain_;
+	}
+
+	float Compressor::getGainReduction() const
+	{
+		return reduction_;
+	}
+}
\ No newline at end of file
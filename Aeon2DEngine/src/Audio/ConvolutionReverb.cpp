@@ -0,0 +1,310 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include <SFML/Audio/InputSoundFile.hpp>
+
+#include "../../include/Utils/Simd.h"
+#include "../../include/Audio/ConvolutionReverb.h"
+
+namespace ae
+{
+	namespace
+	{
+		// Accumulates the complex products of an input spectrum and a partition's spectrum (split format)
+		void multiplyAccumulate(const float* xRe, const float* xIm, const float* hRe, const float* hIm, float* sumRe, float* sumIm, std::size_t binCount)
+		{
+			std::size_t k = 0;
+#if defined(AE_SIMD_AVX)
+			for (; k + 8 <= binCount; k += 8) {
+				const __m256 XR = _mm256_loadu_ps(xRe + k), XI = _mm256_loadu_ps(xIm + k);
+				const __m256 HR = _mm256_loadu_ps(hRe + k), HI = _mm256_loadu_ps(hIm + k);
+				const __m256 RE = _mm256_sub_ps(_mm256_mul_ps(XR, HR), _mm256_mul_ps(XI, HI));
+				const __m256 IM = _mm256_add_ps(_mm256_mul_ps(XR, HI), _mm256_mul_ps(XI, HR));
+				_mm256_storeu_ps(sumRe + k, _mm256_add_ps(_mm256_loadu_ps(sumRe + k), RE));
+				_mm256_storeu_ps(sumIm + k, _mm256_add_ps(_mm256_loadu_ps(sumIm + k), IM));
+			}
+#elif defined(AE_SIMD_SSE)
+			for (; k + 4 <= binCount; k += 4) {
+				const __m128 XR = _mm_loadu_ps(xRe + k), XI = _mm_loadu_ps(xIm + k);
+				const __m128 HR = _mm_loadu_ps(hRe + k), HI = _mm_loadu_ps(hIm + k);
+				const __m128 RE = _mm_sub_ps(_mm_mul_ps(XR, HR), _mm_mul_ps(XI, HI));
+				const __m128 IM = _mm_add_ps(_mm_mul_ps(XR, HI), _mm_mul_ps(XI, HR));
+				_mm_storeu_ps(sumRe + k, _mm_add_ps(_mm_loadu_ps(sumRe + k), RE));
+				_mm_storeu_ps(sumIm + k, _mm_add_ps(_mm_loadu_ps(sumIm + k), IM));
+			}
+#endif
+			for (; k < binCount; ++k) {
+				sumRe[k] += xRe[k] * hRe[k] - xIm[k] * hIm[k];
+				sumIm[k] += xRe[k] * hIm[k] + xIm[k] * hRe[k];
+			}
+		}
+	}
+
+	ConvolutionReverb::Stage::Stage(std::size_t blockSize, std::size_t offset)
+		: blockSize(blockSize)
+		, offset(offset)
+		, partitionCount(0)
+		, cursor(0)
+		, fft(blockSize * 2)
+		, filterRe()
+		, filterIm()
+		, historyRe()
+		, historyIm()
+		, input()
+	{
+	}
+
+	ConvolutionReverb::ConvolutionReverb()
+		: AudioEffect()
+		, wet_(0.3f)
+		, dry_(1.f)
+		, dirty_(false)
+		, mutex_()
+		, response_()
+		, responseChannels_(0)
+		, responseRate_(0)
+		, sampleRate_(0)
+		, filterChannels_(0)
+		, stages_()
+		, output_()
+		, outputMask_(0)
+		, position_(0)
+		, sumRe_()
+		, sumIm_()
+		, block_()
+	{
+	}
+
+	bool ConvolutionReverb::loadFromFile(const std::string& filepath)
+	{
+		sf::InputSoundFile file;
+		if (!file.openFromFile(filepath) || file.getChannelCount() == 0 || file.getSampleCount() == 0)
+			return false;
+
+		std::vector<sf::Int16> samples(static_cast<std::size_t>(file.getSampleCount()));
+		samples.resize(static_cast<std::size_t>(file.read(samples.data(), samples.size())));
+		std::vector<float> converted(samples.size());
+		for (std::size_t i = 0; i < samples.size(); ++i)
+			converted[i] = samples[i] / 32768.f;
+
+		setImpulseResponse(converted.data(), converted.size() / file.getChannelCount(), file.getChannelCount(), file.getSampleRate());
+		return true;
+	}
+
+	void ConvolutionReverb::setImpulseResponse(const float* samples, std::size_t frameCount, unsigned int channelCount, unsigned int sampleRate)
+	{
+		// Only the first two channels are kept
+		const unsigned int CHANNELS = std::min(channelCount, 2u);
+		std::vector<float> response(frameCount * CHANNELS);
+		for (std::size_t i = 0; i < frameCount; ++i)
+			for (unsigned int c = 0; c < CHANNELS; ++c)
+				response[i * CHANNELS + c] = samples[i * channelCount + c];
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		response_.swap(response);
+		responseChannels_ = CHANNELS;
+		responseRate_ = sampleRate;
+		dirty_ = true;
+	}
+
+	void ConvolutionReverb::process(float* frames, std::size_t frameCount, unsigned int sampleRate)
+	{
+		if (dirty_ || sampleRate != sampleRate_)
+			prepare(sampleRate);
+
+		const float WET = wet_;
+		const float DRY = dry_;
+		if (stages_.empty()) {
+			for (std::size_t i = 0; i < frameCount * 2; ++i)
+				frames[i] *= DRY;
+			return;
+		}
+
+		// The input is consumed up to the end of the first stage's blocks, where the completed blocks are convolved
+		std::size_t i = 0;
+		while (i < frameCount) {
+			const std::size_t CHUNK = std::min(frameCount - i, FIRST_BLOCK_SIZE - position_ % FIRST_BLOCK_SIZE);
+			float* chunk = frames + i * 2;
+			for (Stage& stage : stages_) {
+				const std::size_t BLOCK = stage.blockSize;
+				float* left = stage.input.data() + BLOCK + position_ % BLOCK;
+				float* right = left + BLOCK * 2;
+				for (std::size_t n = 0; n < CHUNK; ++n) {
+					left[n] = chunk[n * 2];
+					right[n] = chunk[n * 2 + 1];
+				}
+			}
+
+			for (std::size_t n = 0; n < CHUNK; ++n) {
+				float* wet = output_.data() + ((position_ + n) & outputMask_) * 2;
+				chunk[n * 2] = chunk[n * 2] * DRY + wet[0] * WET;
+				chunk[n * 2 + 1] = chunk[n * 2 + 1] * DRY + wet[1] * WET;
+				wet[0] = wet[1] = 0.f;
+			}
+
+			position_ += CHUNK;
+			i += CHUNK;
+			for (Stage& stage : stages_)
+				if (position_ % stage.blockSize == 0)
+					convolve(stage);
+		}
+	}
+
+	void ConvolutionReverb::reset()
+	{
+		for (Stage& stage : stages_) {
+			std::fill(stage.historyRe.begin(), stage.historyRe.end(), 0.f);
+			std::fill(stage.historyIm.begin(), stage.historyIm.end(), 0.f);
+			std::fill(stage.input.begin(), stage.input.end(), 0.f);
+			stage.cursor = 0;
+		}
+		std::fill(output_.begin(), output_.end(), 0.f);
+		position_ = 0;
+	}
+
+	void ConvolutionReverb::setWet(float wet)
+	{
+		wet_ = std::min(std::max(wet, 0.f), 1.f);
+	}
+
+	float ConvolutionReverb::getWet() const
+	{
+		return wet_;
+	}
+
+	void ConvolutionReverb::setDry(float dry)
+	{
+		dry_ = std::min(std::max(dry, 0.f), 1.f);
+	}
+
+	float ConvolutionReverb::getDry() const
+	{
+		return dry_;
+	}
+
+	std::size_t ConvolutionReverb::getLatency() const
+	{
+		return FIRST_BLOCK_SIZE;
+	}
+
+	void ConvolutionReverb::prepare(unsigned int sampleRate)
+	{
+		std::vector<float> response;
+		unsigned int channels = 0, responseRate = 0;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			dirty_ = false;
+			response = response_;
+			channels = responseChannels_;
+			responseRate = responseRate_;
+		}
+
+		sampleRate_ = sampleRate;
+		filterChannels_ = channels;
+		stages_.clear();
+		position_ = 0;
+		if (channels == 0 || response.empty() || responseRate == 0 || sampleRate == 0)
+			return;
+
+		// Resamples the response to the mixer's rate (linear interpolation) and normalizes it to unit energy
+		std::size_t length = response.size() / channels;
+		if (responseRate != sampleRate) {
+			const std::size_t RESAMPLED = std::max<std::size_t>(static_cast<std::size_t>(static_cast<double>(length) * sampleRate / responseRate), 1);
+			std::vector<float> resampled(RESAMPLED * channels);
+			const double STEP = static_cast<double>(responseRate) / sampleRate;
+			for (std::size_t i = 0; i < RESAMPLED; ++i) {
+				const double POSITION = i * STEP;
+				const std::size_t INDEX = std::min(static_cast<std::size_t>(POSITION), length - 1);
+				const std::size_t NEXT = std::min(INDEX + 1, length - 1);
+				const float FRACTION = static_cast<float>(POSITION - INDEX);
+				for (unsigned int c = 0; c < channels; ++c)
+					resampled[i * channels + c] = response[INDEX * channels + c] * (1.f - FRACTION) + response[NEXT * channels + c] * FRACTION;
+			}
+			response.swap(resampled);
+			length = RESAMPLED;
+		}
+
+		double energy = 0.0;
+		for (float sample : response)
+			energy += static_cast<double>(sample) * sample;
+		const float SCALE = energy > 0.0 ? static_cast<float>(1.0 / std::sqrt(energy / channels)) : 0.f;
+
+		// Covers the response with stages of growing partitions, each starting where its own latency is hidden by the first stage's
+		// (a stage of N frames per partition starts N - 128 frames in, so the previous one needs GROWTH - 1 partitions)
+		std::size_t blockSize = FIRST_BLOCK_SIZE, offset = 0, largest = FIRST_BLOCK_SIZE;
+		while (offset < length) {
+			stages_.emplace_back(blockSize, offset);
+			Stage& stage = stages_.back();
+			const std::size_t REMAINING = (length - offset + blockSize - 1) / blockSize;
+			stage.partitionCount = blockSize < LAST_BLOCK_SIZE ? std::min(REMAINING, GROWTH - 1) : REMAINING;
+
+			const std::size_t BINS = stage.fft.getBinCount();
+			stage.filterRe.assign(channels * stage.partitionCount * BINS, 0.f);
+			stage.filterIm.assign(channels * stage.partitionCount * BINS, 0.f);
+			stage.historyRe.assign(2 * stage.partitionCount * BINS, 0.f);
+			stage.historyIm.assign(2 * stage.partitionCount * BINS, 0.f);
+			stage.input.assign(2 * blockSize * 2, 0.f);
+
+			std::vector<float> partition(blockSize * 2);
+			for (unsigned int c = 0; c < channels; ++c) {
+				for (std::size_t p = 0; p < stage.partitionCount; ++p) {
+					std::fill(partition.begin(), partition.end(), 0.f);
+					const std::size_t START = offset + p * blockSize;
+					const std::size_t COUNT = std::min(blockSize, length - std::min(START, length));
+					for (std::size_t n = 0; n < COUNT; ++n)
+						partition[n] = response[(START + n) * channels + c] * SCALE;
+
+					const std::size_t SLOT = (c * stage.partitionCount + p) * BINS;
+					stage.fft.forward(partition.data(), stage.filterRe.data() + SLOT, stage.filterIm.data() + SLOT);
+				}
+			}
+
+			largest = blockSize;
+			offset += stage.partitionCount * blockSize;
+			blockSize = std::min(blockSize * GROWTH, LAST_BLOCK_SIZE);
+		}
+
+		// The ring buffer holds the results of the last stage, written up to its offset and block size ahead
+		std::size_t frames = 1;
+		while (frames < stages_.back().offset + largest + FIRST_BLOCK_SIZE * 2)
+			frames <<= 1;
+		output_.assign(frames * 2, 0.f);
+		outputMask_ = frames - 1;
+		sumRe_.resize(largest + 1);
+		sumIm_.resize(largest + 1);
+		block_.resize(largest * 2);
+	}
+
+	void ConvolutionReverb::convolve(Stage& stage)
+	{
+		const std::size_t BLOCK = stage.blockSize;
+		const std::size_t PARTITIONS = stage.partitionCount;
+		const std::size_t BINS = stage.fft.getBinCount();
+		stage.cursor = (stage.cursor + 1) % PARTITIONS;
+
+		for (unsigned int c = 0; c < 2; ++c) {
+			// The previous and current blocks are transformed together (overlap-save)
+			float* input = stage.input.data() + c * BLOCK * 2;
+			float* historyRe = stage.historyRe.data() + c * PARTITIONS * BINS;
+			float* historyIm = stage.historyIm.data() + c * PARTITIONS * BINS;
+			stage.fft.forward(input, historyRe + stage.cursor * BINS, historyIm + stage.cursor * BINS);
+			std::memcpy(input, input + BLOCK, BLOCK * sizeof(float));
+
+			// Each partition of the response is applied to the input block as old as its position
+			const std::size_t FILTER = std::min(c, filterChannels_ - 1) * PARTITIONS * BINS;
+			std::fill(sumRe_.begin(), sumRe_.begin() + BINS, 0.f);
+			std::fill(sumIm_.begin(), sumIm_.begin() + BINS, 0.f);
+			for (std::size_t p = 0; p < PARTITIONS; ++p) {
+				const std::size_t SLOT = ((stage.cursor + PARTITIONS - p) % PARTITIONS) * BINS;
+				multiplyAccumulate(historyRe + SLOT, historyIm + SLOT, stage.filterRe.data() + FILTER + p * BINS, stage.filterIm.data() + FILTER + p * BINS, sumRe_.data(), sumIm_.data(), BINS);
+			}
+			stage.fft.inverse(sumRe_.data(), sumIm_.data(), block_.data());
+
+			// The second half is the linear convolution of the block, delayed by the stage's offset and the first block's latency
+			const std::size_t START = position_ - BLOCK + stage.offset + FIRST_BLOCK_SIZE;
+			for (std::size_t n = 0; n < BLOCK; ++n)
+				output_[((START + n) & outputMask_) * 2 + c] += block_[BLOCK + n];
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,93 @@
+#include <algorithm>
+#include <chrono>
+
+#include "../../include/Audio/PooledSampleSource.h"
+#include "../../include/Audio/DecodePool.h"
+
+namespace ae
+{
+	DecodePool::DecodePool(std::size_t threadCount)
+		: threads_()
+		, sources_()
+		, mutex_()
+		, condition_()
+		, running_(true)
+	{
+		for (std::size_t i = 0; i < threadCount; ++i)
+			threads_.emplace_back(&DecodePool::run, this);
+	}
+
+	DecodePool::~DecodePool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			running_ = false;
+		}
+		condition_.notify_all();
+		for (std::thread& thread : threads_)
+			thread.join();
+	}
+
+	std::size_t DecodePool::getThreadCount() const
+	{
+		return threads_.size();
+	}
+
+	void DecodePool::attach(PooledSampleSource& source)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			sources_.push_back(&source);
+		}
+		condition_.notify_one();
+	}
+
+	void DecodePool::detach(PooledSampleSource& source)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			sources_.erase(std::remove(sources_.begin(), sources_.end(), &source), sources_.end());
+		}
+
+		// A decode thread may still be refilling the source it picked before it was removed
+		std::lock_guard<std::mutex> decodeLock(source.decodeMutex_);
+	}
+
+	void DecodePool::run()
+	{
+		// Time slept once all the sources are full, a fraction of their buffer's duration
+		const auto IDLE_TIME = std::chrono::milliseconds(5);
+
+		std::vector<std::pair<float, PooledSampleSource*>> order;
+		std::unique_lock<std::mutex> lock(mutex_);
+		while (running_) {
+			// Refill the sources closest to running out of decoded frames first
+			order.clear();
+			for (PooledSampleSource* source : sources_)
+				order.emplace_back(source->getLead(), source);
+			std::sort(order.begin(), order.end(), [](const std::pair<float, PooledSampleSource*>& s1, const std::pair<float, PooledSampleSource*>& s2) {
+				return s1.first < s2.first;
+			});
+
+			bool decoded = false;
+			for (const auto& entry : order) {
+				// Skip the sources detached since the order was made and those already being refilled by another thread
+				PooledSampleSource* source = entry.second;
+				if (std::find(sources_.begin(), sources_.end(), source) == sources_.end())
+					continue;
+				std::unique_lock<std::mutex> decodeLock(source->decodeMutex_, std::try_to_lock);
+				if (!decodeLock.owns_lock())
+					continue;
+
+				// The source can't be destroyed while its decode mutex is locked, the list of sources can change in the meantime
+				lock.unlock();
+				decoded |= source->decode();
+				decodeLock.unlock();
+				lock.lock();
+			}
+
+			if (!decoded && running_)
+				condition_.wait_for(lock, IDLE_TIME);
+		}
+	}
+}
\ No newline at end of file
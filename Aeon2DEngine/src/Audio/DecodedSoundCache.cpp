@@ -0,0 +1,99 @@
+#include "../../include/Audio/DecodedSoundCache.h"
+
+namespace ae
+{
+	DecodedSoundCache::DecodedSoundCache(std::size_t capacity)
+		: entries_()
+		, index_()
+		, capacity_(capacity)
+		, size_(0)
+		, hits_(0)
+		, misses_(0)
+	{
+	}
+
+	const sf::SoundBuffer* DecodedSoundCache::acquire(const CompressedSoundBuffer& sound)
+	{
+		auto found = index_.find(&sound);
+		if (found != index_.end()) {
+			// Moves the decoded copy to the front as the most recently used
+			entries_.splice(entries_.begin(), entries_, found->second);
+			++found->second->pins;
+			++hits_;
+			return found->second->buffer.get();
+		}
+
+		++misses_;
+		std::unique_ptr<sf::SoundBuffer> buffer(new sf::SoundBuffer());
+		if (!sound.decode(*buffer))
+			return nullptr;
+
+		entries_.push_front(Entry{ &sound, std::move(buffer), sound.getDecodedSize(), 1 });
+		index_[&sound] = entries_.begin();
+		size_ += sound.getDecodedSize();
+		evict();
+		return entries_.front().buffer.get();
+	}
+
+	void DecodedSoundCache::release(const CompressedSoundBuffer& sound)
+	{
+		auto found = index_.find(&sound);
+		if (found == index_.end() || found->second->pins == 0)
+			return;
+
+		if (--found->second->pins == 0)
+			evict();
+	}
+
+	void DecodedSoundCache::remove(const CompressedSoundBuffer& sound)
+	{
+		auto found = index_.find(&sound);
+		if (found == index_.end())
+			return;
+
+		size_ -= found->second->size;
+		entries_.erase(found->second);
+		index_.erase(found);
+	}
+
+	void DecodedSoundCache::setCapacity(std::size_t capacity)
+	{
+		capacity_ = capacity;
+		evict();
+	}
+
+	std::size_t DecodedSoundCache::getCapacity() const
+	{
+		return capacity_;
+	}
+
+	std::size_t DecodedSoundCache::getSize() const
+	{
+		return size_;
+	}
+
+	std::size_t DecodedSoundCache::getHitCount() const
+	{
+		return hits_;
+	}
+
+	std::size_t DecodedSoundCache::getMissCount() const
+	{
+		return misses_;
+	}
+
+	void DecodedSoundCache::evict()
+	{
+		// The pinned decoded copies are skipped, they're still being played
+		auto entry = entries_.end();
+		while (size_ > capacity_ && entry != entries_.begin()) {
+			--entry;
+			if (entry->pins > 0)
+				continue;
+
+			size_ -= entry->size;
+			index_.erase(entry->sound);
+			entry = entries_.erase(entry);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,84 @@
+#include <algorithm>
+
+#include <SFML/System/Clock.hpp>
+
+#include "../../include/Audio/EffectChain.h"
+
+namespace ae
+{
+	EffectChain::EffectChain()
+		: effects_()
+		, bypassed_(false)
+		, lastProcessTime_(0)
+		, lastFrameCount_(0)
+		, mutex_()
+	{
+	}
+
+	void EffectChain::add(AudioEffect& effect)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		effects_.push_back(&effect);
+	}
+
+	void EffectChain::remove(AudioEffect& effect)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		effects_.erase(std::remove(effects_.begin(), effects_.end(), &effect), effects_.end());
+	}
+
+	void EffectChain::clear()
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		effects_.clear();
+	}
+
+	std::size_t EffectChain::getEffectCount() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return effects_.size();
+	}
+
+	void EffectChain::setBypassed(bool flag)
+	{
+		bypassed_ = flag;
+	}
+
+	bool EffectChain::isBypassed() const
+	{
+		return bypassed_;
+	}
+
+	void EffectChain::process(float* frames, std::size_t frameCount, unsigned int sampleRate)
+	{
+		if (bypassed_)
+			return;
+
+		sf::Clock clock;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			for (AudioEffect* effect : effects_)
+				effect->process(frames, frameCount, sampleRate);
+		}
+
+		lastFrameCount_ = frameCount;
+		lastProcessTime_ = clock.getElapsedTime().asMicroseconds();
+	}
+
+	void EffectChain::reset()
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		for (AudioEffect* effect : effects_)
+			effect->reset();
+	}
+
+	sf::Time EffectChain::getLastProcessTime() const
+	{
+		return sf::microseconds(lastProcessTime_);
+	}
+
+	std::size_t EffectChain::getLastFrameCount() const
+	{
+		return lastFrameCount_;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,176 @@
+#include <cmath>
+
+#include "../../include/Utils/Simd.h"
+#include "../../include/Audio/FFT.h"
+
+namespace ae
+{
+	namespace
+	{
+		// The twiddle factors are computed in double precision, Math::PI is only a float
+		const double PI = 3.14159265358979323846;
+	}
+
+	FFT::FFT(std::size_t size)
+		: size_(4)
+		, reversal_()
+		, stageRe_()
+		, stageIm_()
+		, splitRe_()
+		, splitIm_()
+		, workRe_()
+		, workIm_()
+	{
+		while (size_ < size)
+			size_ <<= 1;
+
+		// Bit-reversed order of the complex points
+		const std::size_t POINTS = size_ / 2;
+		std::size_t bits = 0;
+		while ((std::size_t(1) << bits) < POINTS)
+			++bits;
+		reversal_.resize(POINTS);
+		for (std::size_t i = 0; i < POINTS; ++i) {
+			std::size_t reversed = 0;
+			for (std::size_t b = 0; b < bits; ++b)
+				reversed |= ((i >> b) & 1) << (bits - 1 - b);
+			reversal_[i] = reversed;
+		}
+
+		// Twiddle factors of each stage (the stage of half-length h starts at h - 1)
+		stageRe_.reserve(POINTS);
+		stageIm_.reserve(POINTS);
+		for (std::size_t half = 1; half < POINTS; half <<= 1) {
+			for (std::size_t j = 0; j < half; ++j) {
+				const double ANGLE = -PI * j / half;
+				stageRe_.push_back(static_cast<float>(std::cos(ANGLE)));
+				stageIm_.push_back(static_cast<float>(std::sin(ANGLE)));
+			}
+		}
+
+		splitRe_.resize(POINTS);
+		splitIm_.resize(POINTS);
+		for (std::size_t k = 0; k < POINTS; ++k) {
+			const double ANGLE = -2.0 * PI * k / size_;
+			splitRe_[k] = static_cast<float>(std::cos(ANGLE));
+			splitIm_[k] = static_cast<float>(std::sin(ANGLE));
+		}
+
+		workRe_.resize(POINTS);
+		workIm_.resize(POINTS);
+	}
+
+	void FFT::forward(const float* input, float* real, float* imag)
+	{
+		// The even samples form the real parts and the odd samples the imaginary parts of a complex signal of half the size
+		const std::size_t POINTS = size_ / 2;
+		for (std::size_t n = 0; n < POINTS; ++n) {
+			workRe_[reversal_[n]] = input[n * 2];
+			workIm_[reversal_[n]] = input[n * 2 + 1];
+		}
+		transform();
+
+		// Separates the spectra of the even and odd samples and recombines them
+		real[0] = workRe_[0] + workIm_[0];
+		imag[0] = 0.f;
+		real[POINTS] = workRe_[0] - workIm_[0];
+		imag[POINTS] = 0.f;
+		for (std::size_t k = 1; k < POINTS; ++k) {
+			const float CONJ_RE = workRe_[POINTS - k], CONJ_IM = -workIm_[POINTS - k];
+			const float EVEN_RE = (workRe_[k] + CONJ_RE) * 0.5f;
+			const float EVEN_IM = (workIm_[k] + CONJ_IM) * 0.5f;
+			const float ODD_RE = (workIm_[k] - CONJ_IM) * 0.5f;
+			const float ODD_IM = (CONJ_RE - workRe_[k]) * 0.5f;
+			real[k] = EVEN_RE + splitRe_[k] * ODD_RE - splitIm_[k] * ODD_IM;
+			imag[k] = EVEN_IM + splitRe_[k] * ODD_IM + splitIm_[k] * ODD_RE;
+		}
+	}
+
+	void FFT::inverse(const float* real, const float* imag, float* output)
+	{
+		// Rebuilds the complex spectrum of half the size, conjugated so the forward transform computes the inverse one
+		const std::size_t POINTS = size_ / 2;
+		for (std::size_t k = 0; k < POINTS; ++k) {
+			const float CONJ_RE = real[POINTS - k], CONJ_IM = -imag[POINTS - k];
+			const float EVEN_RE = (real[k] + CONJ_RE) * 0.5f;
+			const float EVEN_IM = (imag[k] + CONJ_IM) * 0.5f;
+			const float DIFF_RE = (real[k] - CONJ_RE) * 0.5f;
+			const float DIFF_IM = (imag[k] - CONJ_IM) * 0.5f;
+			const float ODD_RE = DIFF_RE * splitRe_[k] + DIFF_IM * splitIm_[k];
+			const float ODD_IM = DIFF_IM * splitRe_[k] - DIFF_RE * splitIm_[k];
+			workRe_[reversal_[k]] = EVEN_RE - ODD_IM;
+			workIm_[reversal_[k]] = -(EVEN_IM + ODD_RE);
+		}
+		transform();
+
+		const float SCALE = 1.f / POINTS;
+		for (std::size_t n = 0; n < POINTS; ++n) {
+			output[n * 2] = workRe_[n] * SCALE;
+			output[n * 2 + 1] = -workIm_[n] * SCALE;
+		}
+	}
+
+	std::size_t FFT::getSize() const
+	{
+		return size_;
+	}
+
+	std::size_t FFT::getBinCount() const
+	{
+		return size_ / 2 + 1;
+	}
+
+	void FFT::transform()
+	{
+		const std::size_t POINTS = size_ / 2;
+		float* re = workRe_.data();
+		float* im = workIm_.data();
+		for (std::size_t half = 1; half < POINTS; half <<= 1) {
+			const float* twiddleRe = stageRe_.data() + half - 1;
+			const float* twiddleIm = stageIm_.data() + half - 1;
+			for (std::size_t start = 0; start < POINTS; start += half * 2) {
+				float* topRe = re + start;
+				float* topIm = im + start;
+				float* bottomRe = topRe + half;
+				float* bottomIm = topIm + half;
+				std::size_t j = 0;
+
+				// The butterflies of a stage are independent, the later stages are processed several at a time
+#if defined(AE_SIMD_AVX)
+				for (; j + 8 <= half; j += 8) {
+					const __m256 WR = _mm256_loadu_ps(twiddleRe + j), WI = _mm256_loadu_ps(twiddleIm + j);
+					const __m256 BR = _mm256_loadu_ps(bottomRe + j), BI = _mm256_loadu_ps(bottomIm + j);
+					const __m256 TR = _mm256_sub_ps(_mm256_mul_ps(BR, WR), _mm256_mul_ps(BI, WI));
+					const __m256 TI = _mm256_add_ps(_mm256_mul_ps(BR, WI), _mm256_mul_ps(BI, WR));
+					const __m256 AR = _mm256_loadu_ps(topRe + j), AI = _mm256_loadu_ps(topIm + j);
+					_mm256_storeu_ps(topRe + j, _mm256_add_ps(AR, TR));
+					_mm256_storeu_ps(topIm + j, _mm256_add_ps(AI, TI));
+					_mm256_storeu_ps(bottomRe + j, _mm256_sub_ps(AR, TR));
+					_mm256_storeu_ps(bottomIm + j, _mm256_sub_ps(AI, TI));
+				}
+#elif defined(AE_SIMD_SSE)
+				for (; j + 4 <= half; j += 4) {
+					const __m128 WR = _mm_loadu_ps(twiddleRe + j), WI = _mm_loadu_ps(twiddleIm + j);
+					const __m128 BR = _mm_loadu_ps(bottomRe + j), BI = _mm_loadu_ps(bottomIm + j);
+					const __m128 TR = _mm_sub_ps(_mm_mul_ps(BR, WR), _mm_mul_ps(BI, WI));
+					const __m128 TI = _mm_add_ps(_mm_mul_ps(BR, WI), _mm_mul_ps(BI, WR));
+					const __m128 AR = _mm_loadu_ps(topRe + j), AI = _mm_loadu_ps(topIm + j);
+					_mm_storeu_ps(topRe + j, _mm_add_ps(AR, TR));
+					_mm_storeu_ps(topIm + j, _mm_add_ps(AI, TI));
+					_mm_storeu_ps(bottomRe + j, _mm_sub_ps(AR, TR));
+					_mm_storeu_ps(bottomIm + j, _mm_sub_ps(AI, TI));
+				}
+#endif
+				for (; j < half; ++j) {
+					const float TR = bottomRe[j] * twiddleRe[j] - bottomIm[j] * twiddleIm[j];
+					const float TI = bottomRe[j] * twiddleIm[j] + bottomIm[j] * twiddleRe[j];
+					const float AR = topRe[j], AI = topIm[j];
+					topRe[j] = AR + TR;
+					topIm[j] = AI + TI;
+					bottomRe[j] = AR - TR;
+					bottomIm[j] = AI - TI;
+				}
+			}
+		}
+	}
+}
\ No newline at end of file
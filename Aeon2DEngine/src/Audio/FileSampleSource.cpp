@@ -0,0 +1,58 @@
+#include "../../include/Audio/FileSampleSource.h"
+
+namespace ae
+{
+	FileSampleSource::FileSampleSource()
+		: SampleSource()
+		, stream_()
+		, file_()
+	{
+	}
+
+	bool FileSampleSource::openFromFile(const std::string& filepath)
+	{
+		return file_.openFromFile(filepath) && file_.getChannelCount() > 0;
+	}
+
+	bool FileSampleSource::openFromMemory(const void* data, std::size_t size)
+	{
+		return data && file_.openFromMemory(data, size) && file_.getChannelCount() > 0;
+	}
+
+	bool FileSampleSource::openFromStream(std::unique_ptr<sf::InputStream> stream)
+	{
+		if (!stream || !file_.openFromStream(*stream) || file_.getChannelCount() == 0)
+			return false;
+
+		// The stream is kept alive for as long as the file reads it
+		stream_ = std::move(stream);
+		return true;
+	}
+
+	std::size_t FileSampleSource::read(sf::Int16* samples, std::size_t frameCount)
+	{
+		const unsigned int CHANNEL_COUNT = file_.getChannelCount();
+		return static_cast<std::size_t>(file_.read(samples, frameCount * CHANNEL_COUNT) / CHANNEL_COUNT);
+	}
+
+	void FileSampleSource::seek(sf::Uint64 frame)
+	{
+		// sf::InputSoundFile seeks in samples, taking the channels into account
+		file_.seek(frame * file_.getChannelCount());
+	}
+
+	sf::Uint64 FileSampleSource::getFrameCount() const
+	{
+		return file_.getSampleCount() / file_.getChannelCount();
+	}
+
+	unsigned int FileSampleSource::getChannelCount() const
+	{
+		return file_.getChannelCount();
+	}
+
+	unsigned int FileSampleSource::getSampleRate() const
+	{
+		return file_.getSampleRate();
+	}
+}
\ No newline at end of file
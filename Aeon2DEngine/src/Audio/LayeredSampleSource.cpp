@@ -0,0 +1,103 @@
+#include <algorithm>
+
+#include "../../include/Audio/LayeredSampleSource.h"
+
+namespace ae
+{
+	LayeredSampleSource::LayeredSampleSource(std::unique_ptr<SampleSource> stems, std::size_t layerCount)
+		: SampleSource()
+		, stems_(std::move(stems))
+		, CHANNEL_COUNT(stems_->getChannelCount() / static_cast<unsigned int>(std::max<std::size_t>(layerCount, 1)))
+		, layers_(std::max<std::size_t>(layerCount, 1), Layer{ 1.f, 1.f, 0.f, 0 })
+		, changes_()
+		, stemSamples_()
+		, mutex_()
+	{
+	}
+
+	void LayeredSampleSource::setLayerGain(std::size_t layer, float gain, std::size_t rampFrames)
+	{
+		if (layer >= layers_.size())
+			return;
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		changes_.push_back(GainChange{ layer, std::max(gain, 0.f), rampFrames });
+	}
+
+	std::size_t LayeredSampleSource::getLayerCount() const
+	{
+		return layers_.size();
+	}
+
+	std::size_t LayeredSampleSource::read(sf::Int16* samples, std::size_t frameCount)
+	{
+		applyGainChanges();
+
+		const std::size_t STRIDE = CHANNEL_COUNT * layers_.size();
+		if (stemSamples_.size() < frameCount * STRIDE)
+			stemSamples_.resize(frameCount * STRIDE);
+		const std::size_t READ = stems_->read(stemSamples_.data(), frameCount);
+
+		// The gains advance frame by frame so that the ramps are the same whatever the size of the reads
+		for (std::size_t frame = 0; frame < READ; ++frame) {
+			const sf::Int16* stemFrame = stemSamples_.data() + frame * STRIDE;
+			for (unsigned int channel = 0; channel < CHANNEL_COUNT; ++channel) {
+				float sample = 0.f;
+				for (std::size_t layer = 0; layer < layers_.size(); ++layer)
+					sample += layers_[layer].gain * stemFrame[layer * CHANNEL_COUNT + channel];
+				samples[frame * CHANNEL_COUNT + channel] = static_cast<sf::Int16>(std::max(-32768.f, std::min(sample, 32767.f)));
+			}
+
+			for (Layer& layer : layers_)
+				if (layer.rampLeft > 0)
+					layer.gain = (--layer.rampLeft == 0) ? layer.target : layer.gain + layer.step;
+		}
+
+		return READ;
+	}
+
+	void LayeredSampleSource::seek(sf::Uint64 frame)
+	{
+		stems_->seek(frame);
+	}
+
+	sf::Uint64 LayeredSampleSource::getFrameCount() const
+	{
+		return stems_->getFrameCount();
+	}
+
+	unsigned int LayeredSampleSource::getChannelCount() const
+	{
+		return CHANNEL_COUNT;
+	}
+
+	unsigned int LayeredSampleSource::getSampleRate() const
+	{
+		return stems_->getSampleRate();
+	}
+
+	bool LayeredSampleSource::getBufferState(float& fill, std::size_t& underruns) const
+	{
+		return stems_->getBufferState(fill, underruns);
+	}
+
+	bool LayeredSampleSource::setBuffering(std::size_t bufferFrames, std::size_t chunkFrames)
+	{
+		return stems_->setBuffering(bufferFrames, chunkFrames);
+	}
+
+	void LayeredSampleSource::applyGainChanges()
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		for (const GainChange& change : changes_) {
+			Layer& layer = layers_[change.layer];
+			layer.target = change.gain;
+			layer.rampLeft = change.rampFrames;
+			if (change.rampFrames == 0)
+				layer.gain = change.gain;
+			else
+				layer.step = (change.gain - layer.gain) / static_cast<float>(change.rampFrames);
+		}
+		changes_.clear();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <limits>
+
+#include "../../include/Audio/LoudnessCache.h"
+
+namespace ae
+{
+	namespace
+	{
+		// Retrieves the size of a file, 0 if it can't be opened
+		sf::Uint64 getFileSize(const std::string& filepath)
+		{
+			std::ifstream file(filepath, std::ios::binary | std::ios::ate);
+			return file ? static_cast<sf::Uint64>(file.tellg()) : 0;
+		}
+	}
+
+	LoudnessCache::LoudnessCache(const std::string& filepath)
+		: FILEPATH(filepath)
+		, entries_()
+		, mutex_()
+	{
+		// Each line holds the loudness, the file's size and its path (the later lines override the earlier ones)
+		std::ifstream file(FILEPATH);
+		std::string line;
+		while (std::getline(file, line)) {
+			std::istringstream stream(line);
+			Entry entry{ 0, 0.f };
+			std::string path;
+			if (stream >> entry.loudness >> entry.size && std::getline(stream >> std::ws, path) && !path.empty())
+				entries_[path] = entry;
+		}
+	}
+
+	bool LoudnessCache::find(const std::string& filepath, float& loudness) const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		auto found = entries_.find(filepath);
+		if (found == entries_.end() || found->second.size != getFileSize(filepath))
+			return false;
+
+		loudness = found->second.loudness;
+		return true;
+	}
+
+	void LoudnessCache::store(const std::string& filepath, float loudness)
+	{
+		// Silent files are stored with the lowest finite loudness, infinities can't be read back
+		const Entry ENTRY{ getFileSize(filepath), std::max(loudness, std::numeric_limits<float>::lowest()) };
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		entries_[filepath] = ENTRY;
+
+		std::ofstream file(FILEPATH, std::ios::app);
+		file.precision(std::numeric_limits<float>::max_digits10);
+		file << ENTRY.loudness << ' ' << ENTRY.size << ' ' << filepath << '\n';
+	}
+}
\ No newline at end of file
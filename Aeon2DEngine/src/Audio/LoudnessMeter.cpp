@@ -0,0 +1,159 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "../../include/Audio/LoudnessMeter.h"
+
+namespace ae
+{
+	namespace
+	{
+		// The loudness of a block's mean square energy (BS.1770 offset of the K-weighting)
+		double toLoudness(double energy)
+		{
+			return -0.691 + 10.0 * std::log10(energy);
+		}
+	}
+
+	LoudnessMeter::LoudnessMeter(unsigned int channelCount, unsigned int sampleRate)
+		: CHANNEL_COUNT(channelCount)
+		, STEP_FRAMES(std::max(sampleRate / 10, 1u))
+		, shelfB_()
+		, shelfA_()
+		, passB_()
+		, passA_()
+		, channels_(channelCount, ChannelState{ { 0.0, 0.0 }, { 0.0, 0.0 } })
+		, steps_()
+		, stepEnergy_(0.0)
+		, stepFrames_(0)
+	{
+		// K-weighting coefficients derived for the sample rate (BS.1770 stages given at 48 kHz)
+		const double PI = 3.14159265358979323846;
+		const double RATE = static_cast<double>(std::max(sampleRate, 1u));
+
+		// Stage 1: high shelf of about +4 dB above 1.5 kHz modelling the head
+		double K = std::tan(PI * 1681.974450955533 / RATE);
+		double Q = 0.7071752369554196;
+		const double VH = std::pow(10.0, 3.999843853973347 / 20.0);
+		const double VB = std::pow(VH, 0.4996667741545416);
+		double A0 = 1.0 + K / Q + K * K;
+		shelfB_[0] = (VH + VB * K / Q + K * K) / A0;
+		shelfB_[1] = 2.0 * (K * K - VH) / A0;
+		shelfB_[2] = (VH - VB * K / Q + K * K) / A0;
+		shelfA_[0] = 2.0 * (K * K - 1.0) / A0;
+		shelfA_[1] = (1.0 - K / Q + K * K) / A0;
+
+		// Stage 2: high pass at 38 Hz (RLB weighting)
+		K = std::tan(PI * 38.13547087602444 / RATE);
+		Q = 0.5003270373238773;
+		A0 = 1.0 + K / Q + K * K;
+		passB_[0] = 1.0;
+		passB_[1] = -2.0;
+		passB_[2] = 1.0;
+		passA_[0] = 2.0 * (K * K - 1.0) / A0;
+		passA_[1] = (1.0 - K / Q + K * K) / A0;
+	}
+
+	float LoudnessMeter::measure(const sf::SoundBuffer& buffer)
+	{
+		LoudnessMeter meter(buffer.getChannelCount(), buffer.getSampleRate());
+		if (buffer.getChannelCount() > 0)
+			meter.process(buffer.getSamples(), static_cast<std::size_t>(buffer.getSampleCount() / buffer.getChannelCount()));
+		return meter.getIntegratedLoudness();
+	}
+
+	float LoudnessMeter::measure(SampleSource& source)
+	{
+		// Amount of frames read at once
+		const std::size_t CHUNK_FRAMES = 8192;
+
+		LoudnessMeter meter(source.getChannelCount(), source.getSampleRate());
+		std::vector<sf::Int16> samples(CHUNK_FRAMES * source.getChannelCount());
+		std::size_t read = 0;
+		while (!samples.empty() && (read = source.read(samples.data(), CHUNK_FRAMES)) > 0)
+			meter.process(samples.data(), read);
+		return meter.getIntegratedLoudness();
+	}
+
+	void LoudnessMeter::process(const sf::Int16* samples, std::size_t frameCount)
+	{
+		const double SCALE = 1.0 / 32768.0;
+		for (std::size_t frame = 0; frame < frameCount; ++frame) {
+			for (unsigned int channel = 0; channel < CHANNEL_COUNT; ++channel) {
+				ChannelState& state = channels_[channel];
+				const double INPUT = samples[frame * CHANNEL_COUNT + channel] * SCALE;
+
+				const double SHELF = shelfB_[0] * INPUT + state.shelf[0];
+				state.shelf[0] = shelfB_[1] * INPUT - shelfA_[0] * SHELF + state.shelf[1];
+				state.shelf[1] = shelfB_[2] * INPUT - shelfA_[1] * SHELF;
+
+				const double PASS = passB_[0] * SHELF + state.pass[0];
+				state.pass[0] = passB_[1] * SHELF - passA_[0] * PASS + state.pass[1];
+				state.pass[1] = passB_[2] * SHELF - passA_[1] * PASS;
+
+				stepEnergy_ += PASS * PASS;
+			}
+
+			if (++stepFrames_ == STEP_FRAMES) {
+				steps_.push_back(stepEnergy_);
+				stepEnergy_ = 0.0;
+				stepFrames_ = 0;
+			}
+		}
+	}
+
+	float LoudnessMeter::getIntegratedLoudness() const
+	{
+		// Absolute gate and relative gate offset in LUFS / LU
+		const double ABSOLUTE_GATE = -70.0;
+		const double RELATIVE_GATE = -10.0;
+
+		// Blocks of four steps overlapping by three, a shorter sound is a single block
+		std::vector<double> blocks;
+		if (steps_.size() >= 4) {
+			blocks.reserve(steps_.size() - 3);
+			for (std::size_t i = 3; i < steps_.size(); ++i)
+				blocks.push_back((steps_[i - 3] + steps_[i - 2] + steps_[i - 1] + steps_[i]) / (4.0 * STEP_FRAMES));
+		}
+		else {
+			double energy = stepEnergy_;
+			for (double step : steps_)
+				energy += step;
+			const std::size_t FRAMES = steps_.size() * STEP_FRAMES + stepFrames_;
+			if (FRAMES > 0)
+				blocks.push_back(energy / FRAMES);
+		}
+
+		// Mean energy of the blocks above the absolute gate, then of those above the relative gate
+		double sum = 0.0;
+		std::size_t count = 0;
+		for (double block : blocks) {
+			if (block > 0.0 && toLoudness(block) > ABSOLUTE_GATE) {
+				sum += block;
+				++count;
+			}
+		}
+		if (count == 0)
+			return -std::numeric_limits<float>::infinity();
+
+		const double THRESHOLD = toLoudness(sum / count) + RELATIVE_GATE;
+		double gatedSum = 0.0;
+		std::size_t gatedCount = 0;
+		for (double block : blocks) {
+			if (block > 0.0 && toLoudness(block) > ABSOLUTE_GATE && toLoudness(block) > THRESHOLD) {
+				gatedSum += block;
+				++gatedCount;
+			}
+		}
+
+		return static_cast<float>(toLoudness(gatedSum / gatedCount));
+	}
+
+	void LoudnessMeter::reset()
+	{
+		channels_.assign(CHANNEL_COUNT, ChannelState{ { 0.0, 0.0 }, { 0.0, 0.0 } });
+		steps_.clear();
+		stepEnergy_ = 0.0;
+		stepFrames_ = 0;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,221 @@
+#include <cmath>
+#include <cstring>
+
+#include "../../include/Utils/Simd.h"
+#include "../../include/Audio/MixKernels.h"
+
+namespace ae
+{
+	void MixKernels::convertToFloat(const sf::Int16* input, float* output, std::size_t count)
+	{
+		const float SCALE = 1.f / 32768.f;
+		std::size_t i = 0;
+
+#if defined(AE_SIMD_AVX2)
+		const __m256 SCALE_8 = _mm256_set1_ps(SCALE);
+		for (; i + 8 <= count; i += 8) {
+			const __m128i SAMPLES = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+			_mm256_storeu_ps(output + i, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(SAMPLES)), SCALE_8));
+		}
+#elif defined(AE_SIMD_SSE)
+		const __m128 SCALE_4 = _mm_set1_ps(SCALE);
+		for (; i + 8 <= count; i += 8) {
+			// Sign-extend the 16-bit samples to 32-bit by placing them in the upper half and shifting them back down
+			const __m128i SAMPLES = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+			const __m128i LOW = _mm_srai_epi32(_mm_unpacklo_epi16(SAMPLES, SAMPLES), 16);
+			const __m128i HIGH = _mm_srai_epi32(_mm_unpackhi_epi16(SAMPLES, SAMPLES), 16);
+			_mm_storeu_ps(output + i, _mm_mul_ps(_mm_cvtepi32_ps(LOW), SCALE_4));
+			_mm_storeu_ps(output + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(HIGH), SCALE_4));
+		}
+#endif
+		for (; i < count; ++i)
+			output[i] = input[i] * SCALE;
+	}
+
+	void MixKernels::convertToInt16(const float* input, sf::Int16* output, std::size_t count)
+	{
+		const float SCALE = 32767.f;
+		std::size_t i = 0;
+
+#if defined(AE_SIMD_AVX)
+		const __m256 SCALE_8 = _mm256_set1_ps(SCALE);
+		const __m256 MIN_8 = _mm256_set1_ps(-1.f);
+		const __m256 MAX_8 = _mm256_set1_ps(1.f);
+		for (; i + 8 <= count; i += 8) {
+			const __m256 CLIPPED = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(input + i), MIN_8), MAX_8);
+			const __m256i SAMPLES = _mm256_cvtps_epi32(_mm256_mul_ps(CLIPPED, SCALE_8));
+			const __m128i PACKED = _mm_packs_epi32(_mm256_castsi256_si128(SAMPLES), _mm256_extractf128_si256(SAMPLES, 1));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), PACKED);
+		}
+#elif defined(AE_SIMD_SSE)
+		const __m128 SCALE_4 = _mm_set1_ps(SCALE);
+		const __m128 MIN_4 = _mm_set1_ps(-1.f);
+		const __m128 MAX_4 = _mm_set1_ps(1.f);
+		for (; i + 8 <= count; i += 8) {
+			const __m128 LOW = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(input + i), MIN_4), MAX_4);
+			const __m128 HIGH = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(input + i + 4), MIN_4), MAX_4);
+			const __m128i PACKED = _mm_packs_epi32(_mm_cvtps_epi32(_mm_mul_ps(LOW, SCALE_4)), _mm_cvtps_epi32(_mm_mul_ps(HIGH, SCALE_4)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), PACKED);
+		}
+#endif
+		for (; i < count; ++i)
+			output[i] = static_cast<sf::Int16>(std::lrint(fmaxf(fminf(input[i], 1.f), -1.f) * SCALE));
+	}
+
+	void MixKernels::resample(const float* input, unsigned int channelCount, float position, float step, float* output, std::size_t frameCount)
+	{
+		// Copy the frames directly if they're aligned and not pitched
+		if (step == 1.f && position == floorf(position)) {
+			std::memcpy(output, input + static_cast<std::size_t>(position) * channelCount, frameCount * channelCount * sizeof(float));
+			return;
+		}
+
+		std::size_t i = 0;
+		if (channelCount == 1) {
+#if defined(AE_SIMD_AVX2)
+			const __m256 OFFSETS_8 = _mm256_setr_ps(0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f);
+			const __m256 POSITION_8 = _mm256_set1_ps(position);
+			const __m256 STEP_8 = _mm256_set1_ps(step);
+			for (; i + 8 <= frameCount; i += 8) {
+				const __m256 POS = _mm256_add_ps(POSITION_8, _mm256_mul_ps(STEP_8, _mm256_add_ps(_mm256_set1_ps(static_cast<float>(i)), OFFSETS_8)));
+				const __m256i INDICES = _mm256_cvttps_epi32(POS);
+				const __m256 FRACTIONS = _mm256_sub_ps(POS, _mm256_cvtepi32_ps(INDICES));
+				const __m256 CURRENT = _mm256_i32gather_ps(input, INDICES, 4);
+				const __m256 NEXT = _mm256_i32gather_ps(input + 1, INDICES, 4);
+				_mm256_storeu_ps(output + i, _mm256_add_ps(CURRENT, _mm256_mul_ps(_mm256_sub_ps(NEXT, CURRENT), FRACTIONS)));
+			}
+#elif defined(AE_SIMD_SSE)
+			const __m128 OFFSETS_4 = _mm_setr_ps(0.f, 1.f, 2.f, 3.f);
+			const __m128 POSITION_4 = _mm_set1_ps(position);
+			const __m128 STEP_4 = _mm_set1_ps(step);
+			alignas(16) int indices[4];
+			for (; i + 4 <= frameCount; i += 4) {
+				const __m128 POS = _mm_add_ps(POSITION_4, _mm_mul_ps(STEP_4, _mm_add_ps(_mm_set1_ps(static_cast<float>(i)), OFFSETS_4)));
+				const __m128i INDICES = _mm_cvttps_epi32(POS);
+				const __m128 FRACTIONS = _mm_sub_ps(POS, _mm_cvtepi32_ps(INDICES));
+				_mm_store_si128(reinterpret_cast<__m128i*>(indices), INDICES);
+				const __m128 CURRENT = _mm_setr_ps(input[indices[0]], input[indices[1]], input[indices[2]], input[indices[3]]);
+				const __m128 NEXT = _mm_setr_ps(input[indices[0] + 1], input[indices[1] + 1], input[indices[2] + 1], input[indices[3] + 1]);
+				_mm_storeu_ps(output + i, _mm_add_ps(CURRENT, _mm_mul_ps(_mm_sub_ps(NEXT, CURRENT), FRACTIONS)));
+			}
+#endif
+		}
+		else if (channelCount == 2) {
+#if defined(AE_SIMD_SSE)
+			// Two stereo frames are interpolated at once
+			const __m128 OFFSETS_4 = _mm_setr_ps(0.f, 0.f, 1.f, 1.f);
+			const __m128 POSITION_4 = _mm_set1_ps(position);
+			const __m128 STEP_4 = _mm_set1_ps(step);
+			alignas(16) int indices[4];
+			for (; i + 2 <= frameCount; i += 2) {
+				const __m128 POS = _mm_add_ps(POSITION_4, _mm_mul_ps(STEP_4, _mm_add_ps(_mm_set1_ps(static_cast<float>(i)), OFFSETS_4)));
+				const __m128i INDICES = _mm_cvttps_epi32(POS);
+				const __m128 FRACTIONS = _mm_sub_ps(POS, _mm_cvtepi32_ps(INDICES));
+				_mm_store_si128(reinterpret_cast<__m128i*>(indices), INDICES);
+				const float* FRAME_1 = input + indices[0] * 2;
+				const float* FRAME_2 = input + indices[2] * 2;
+				const __m128 CURRENT = _mm_setr_ps(FRAME_1[0], FRAME_1[1], FRAME_2[0], FRAME_2[1]);
+				const __m128 NEXT = _mm_setr_ps(FRAME_1[2], FRAME_1[3], FRAME_2[2], FRAME_2[3]);
+				_mm_storeu_ps(output + i * 2, _mm_add_ps(CURRENT, _mm_mul_ps(_mm_sub_ps(NEXT, CURRENT), FRACTIONS)));
+			}
+#endif
+		}
+
+		for (; i < frameCount; ++i) {
+			const float POS = position + step * static_cast<float>(i);
+			const std::size_t INDEX = static_cast<std::size_t>(POS);
+			const float FRACTION = POS - static_cast<float>(INDEX);
+			for (unsigned int c = 0; c < channelCount; ++c) {
+				const float CURRENT = input[INDEX * channelCount + c];
+				const float NEXT = input[(INDEX + 1) * channelCount + c];
+				output[i * channelCount + c] = CURRENT + (NEXT - CURRENT) * FRACTION;
+			}
+		}
+	}
+
+	void MixKernels::mixMono(const float* input, float* output, std::size_t frameCount,
+	                         float startGainLeft, float startGainRight, float endGainLeft, float endGainRight)
+	{
+		if (frameCount == 0)
+			return;
+
+		const float DELTA_LEFT = (endGainLeft - startGainLeft) / static_cast<float>(frameCount);
+		const float DELTA_RIGHT = (endGainRight - startGainRight) / static_cast<float>(frameCount);
+		std::size_t i = 0;
+
+#if defined(AE_SIMD_AVX)
+		const __m256 START_8 = _mm256_setr_ps(startGainLeft, startGainRight, startGainLeft, startGainRight,
+		                                      startGainLeft, startGainRight, startGainLeft, startGainRight);
+		const __m256 DELTA_8 = _mm256_setr_ps(DELTA_LEFT, DELTA_RIGHT, DELTA_LEFT, DELTA_RIGHT,
+		                                      DELTA_LEFT, DELTA_RIGHT, DELTA_LEFT, DELTA_RIGHT);
+		const __m256 OFFSETS_8 = _mm256_setr_ps(0.f, 0.f, 1.f, 1.f, 2.f, 2.f, 3.f, 3.f);
+		for (; i + 4 <= frameCount; i += 4) {
+			// Duplicate every mono sample for the left and right channels
+			const __m128 SAMPLES = _mm_loadu_ps(input + i);
+			const __m256 DUPLICATED = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_unpacklo_ps(SAMPLES, SAMPLES)),
+			                                               _mm_unpackhi_ps(SAMPLES, SAMPLES), 1);
+			const __m256 GAINS = _mm256_add_ps(START_8, _mm256_mul_ps(DELTA_8, _mm256_add_ps(_mm256_set1_ps(static_cast<float>(i)), OFFSETS_8)));
+			float* out = output + i * 2;
+			_mm256_storeu_ps(out, _mm256_add_ps(_mm256_loadu_ps(out), _mm256_mul_ps(DUPLICATED, GAINS)));
+		}
+#elif defined(AE_SIMD_SSE)
+		const __m128 START_4 = _mm_setr_ps(startGainLeft, startGainRight, startGainLeft, startGainRight);
+		const __m128 DELTA_4 = _mm_setr_ps(DELTA_LEFT, DELTA_RIGHT, DELTA_LEFT, DELTA_RIGHT);
+		const __m128 OFFSETS_LOW = _mm_setr_ps(0.f, 0.f, 1.f, 1.f);
+		const __m128 OFFSETS_HIGH = _mm_setr_ps(2.f, 2.f, 3.f, 3.f);
+		for (; i + 4 <= frameCount; i += 4) {
+			// Duplicate every mono sample for the left and right channels
+			const __m128 SAMPLES = _mm_loadu_ps(input + i);
+			const __m128 INDEX = _mm_set1_ps(static_cast<float>(i));
+			const __m128 GAINS_LOW = _mm_add_ps(START_4, _mm_mul_ps(DELTA_4, _mm_add_ps(INDEX, OFFSETS_LOW)));
+			const __m128 GAINS_HIGH = _mm_add_ps(START_4, _mm_mul_ps(DELTA_4, _mm_add_ps(INDEX, OFFSETS_HIGH)));
+			float* out = output + i * 2;
+			_mm_storeu_ps(out, _mm_add_ps(_mm_loadu_ps(out), _mm_mul_ps(_mm_unpacklo_ps(SAMPLES, SAMPLES), GAINS_LOW)));
+			_mm_storeu_ps(out + 4, _mm_add_ps(_mm_loadu_ps(out + 4), _mm_mul_ps(_mm_unpackhi_ps(SAMPLES, SAMPLES), GAINS_HIGH)));
+		}
+#endif
+		for (; i < frameCount; ++i) {
+			const float INDEX = static_cast<float>(i);
+			output[i * 2] += input[i] * (startGainLeft + DELTA_LEFT * INDEX);
+			output[i * 2 + 1] += input[i] * (startGainRight + DELTA_RIGHT * INDEX);
+		}
+	}
+
+	void MixKernels::mixStereo(const float* input, float* output, std::size_t frameCount,
+	                           float startGainLeft, float startGainRight, float endGainLeft, float endGainRight)
+	{
+		if (frameCount == 0)
+			return;
+
+		const float DELTA_LEFT = (endGainLeft - startGainLeft) / static_cast<float>(frameCount);
+		const float DELTA_RIGHT = (endGainRight - startGainRight) / static_cast<float>(frameCount);
+		std::size_t i = 0;
+
+#if defined(AE_SIMD_AVX)
+		const __m256 START_8 = _mm256_setr_ps(startGainLeft, startGainRight, startGainLeft, startGainRight,
+		                                      startGainLeft, startGainRight, startGainLeft, startGainRight);
+		const __m256 DELTA_8 = _mm256_setr_ps(DELTA_LEFT, DELTA_RIGHT, DELTA_LEFT, DELTA_RIGHT,
+		                                      DELTA_LEFT, DELTA_RIGHT, DELTA_LEFT, DELTA_RIGHT);
+		const __m256 OFFSETS_8 = _mm256_setr_ps(0.f, 0.f, 1.f, 1.f, 2.f, 2.f, 3.f, 3.f);
+		for (; i + 4 <= frameCount; i += 4) {
+			const __m256 GAINS = _mm256_add_ps(START_8, _mm256_mul_ps(DELTA_8, _mm256_add_ps(_mm256_set1_ps(static_cast<float>(i)), OFFSETS_8)));
+			float* out = output + i * 2;
+			_mm256_storeu_ps(out, _mm256_add_ps(_mm256_loadu_ps(out), _mm256_mul_ps(_mm256_loadu_ps(input + i * 2), GAINS)));
+		}
+#elif defined(AE_SIMD_SSE)
+		const __m128 START_4 = _mm_setr_ps(startGainLeft, startGainRight, startGainLeft, startGainRight);
+		const __m128 DELTA_4 = _mm_setr_ps(DELTA_LEFT, DELTA_RIGHT, DELTA_LEFT, DELTA_RIGHT);
+		const __m128 OFFSETS_4 = _mm_setr_ps(0.f, 0.f, 1.f, 1.f);
+		for (; i + 2 <= frameCount; i += 2) {
+			const __m128 GAINS = _mm_add_ps(START_4, _mm_mul_ps(DELTA_4, _mm_add_ps(_mm_set1_ps(static_cast<float>(i)), OFFSETS_4)));
+			float* out = output + i * 2;
+			_mm_storeu_ps(out, _mm_add_ps(_mm_loadu_ps(out), _mm_mul_ps(_mm_loadu_ps(input + i * 2), GAINS)));
+		}
+#endif
+		for (; i < frameCount; ++i) {
+			const float INDEX = static_cast<float>(i);
+			output[i * 2] += input[i * 2] * (startGainLeft + DELTA_LEFT * INDEX);
+			output[i * 2 + 1] += input[i * 2 + 1] * (startGainRight + DELTA_RIGHT * INDEX);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,35 @@
+#include "../../include/Audio/SoftwareMixer.h"
+#include "../../include/Audio/MixKernels.h"
+#include "../../include/Audio/MixerStream.h"
+
+namespace ae
+{
+	MixerStream::MixerStream(SoftwareMixer& mixer, std::size_t blockFrames)
+		: mixer_(mixer)
+		, BLOCK_FRAMES(blockFrames)
+		, mixBlock_(blockFrames * 2)
+		, outputBlock_(blockFrames * 2)
+	{
+		initialize(2, mixer.getSampleRate());
+	}
+
+	MixerStream::~MixerStream()
+	{
+		stop();
+	}
+
+	bool MixerStream::onGetData(Chunk& data)
+	{
+		mixer_.render(mixBlock_.data(), BLOCK_FRAMES);
+		MixKernels::convertToInt16(mixBlock_.data(), outputBlock_.data(), outputBlock_.size());
+
+		data.samples = outputBlock_.data();
+		data.sampleCount = outputBlock_.size();
+
+		return true;
+	}
+
+	void MixerStream::onSeek(sf::Time)
+	{
+	}
+}
\ No newline at end of file
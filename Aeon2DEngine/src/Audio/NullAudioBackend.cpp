@@ -0,0 +1,70 @@
+#include <algorithm>
+
+#include <SFML/System/Clock.hpp>
+
+#include "../../include/Audio/MixKernels.h"
+#include "../../include/Audio/NullAudioBackend.h"
+
+namespace ae
+{
+	NullAudioBackend::NullAudioBackend(unsigned int sampleRate, std::size_t blockFrames)
+		: SoftwareAudioBackend(sampleRate, blockFrames, 0, false)
+		, BLOCK_FRAMES(blockFrames)
+		, output_()
+		, renderedFrames_(0)
+		, renderingTime_(sf::Time::Zero)
+		, outputFile_(nullptr)
+		, outputSamples_()
+	{
+	}
+
+	const std::vector<float>& NullAudioBackend::render(sf::Time duration)
+	{
+		const sf::Clock CLOCK;
+		SoftwareMixer& mixer = getMixer();
+		const std::size_t FRAME_COUNT = static_cast<std::size_t>(duration.asMicroseconds() * mixer.getSampleRate() / 1000000);
+		output_.resize(FRAME_COUNT * 2);
+
+		for (std::size_t frame = 0; frame < FRAME_COUNT; frame += BLOCK_FRAMES)
+			mixer.render(output_.data() + frame * 2, std::min(BLOCK_FRAMES, FRAME_COUNT - frame));
+
+		renderedFrames_ += FRAME_COUNT;
+		renderingTime_ += CLOCK.getElapsedTime();
+
+		// The conversion and the writing aren't part of the rendering speed, the disk would skew the benchmarks
+		if (outputFile_ && !output_.empty()) {
+			outputSamples_.resize(output_.size());
+			MixKernels::convertToInt16(output_.data(), outputSamples_.data(), output_.size());
+			outputFile_->write(outputSamples_.data(), outputSamples_.size());
+		}
+
+		return output_;
+	}
+
+	sf::Time NullAudioBackend::getRenderedTime() const
+	{
+		return sf::microseconds(static_cast<sf::Int64>(renderedFrames_ * 1000000 / getMixer().getSampleRate()));
+	}
+
+	float NullAudioBackend::getRenderSpeed() const
+	{
+		return (renderingTime_ > sf::Time::Zero) ? getRenderedTime() / renderingTime_ : 0.f;
+	}
+
+	bool NullAudioBackend::openOutputFile(const std::string& filepath)
+	{
+		closeOutputFile();
+
+		auto file = std::make_unique<sf::OutputSoundFile>();
+		if (!file->openFromFile(filepath, getMixer().getSampleRate(), 2))
+			return false;
+
+		outputFile_ = std::move(file);
+		return true;
+	}
+
+	void NullAudioBackend::closeOutputFile()
+	{
+		outputFile_.reset();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,251 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <SFML/System/Clock.hpp>
+
+#include "../../include/Utils/Simd.h"
+#include "../../include/Audio/OcclusionMap.h"
+
+namespace ae
+{
+	namespace
+	{
+		// The index given to the padding of the cells (their segments are empty and never hit)
+		const sf::Uint32 NO_WALL = std::numeric_limits<sf::Uint32>::max();
+		// The transmission under which a ray is considered fully occluded
+		const float SILENCE = 0.001f;
+	}
+
+	OcclusionMap::OcclusionMap(float cellSize)
+		: walls_()
+		, visits_()
+		, query_(0)
+		, dirty_(false)
+		, cellSize_(std::max(cellSize, 1.f))
+		, gridCellSize_(cellSize_)
+		, origin_(0.f, 0.f)
+		, columns_(0)
+		, rows_(0)
+		, cellStarts_()
+		, cellWalls_()
+		, startX_()
+		, startY_()
+		, deltaX_()
+		, deltaY_()
+	{
+	}
+
+	std::size_t OcclusionMap::addWall(const sf::Vector2f& start, const sf::Vector2f& end, float transmission)
+	{
+		walls_.push_back(Wall{ start, end, std::min(std::max(transmission, 0.f), 1.f) });
+		dirty_ = true;
+		return walls_.size() - 1;
+	}
+
+	void OcclusionMap::setWallTransmission(std::size_t wall, float transmission)
+	{
+		// The transmissions are read from the walls themselves, the grid doesn't need to be rebuilt
+		if (wall < walls_.size())
+			walls_[wall].transmission = std::min(std::max(transmission, 0.f), 1.f);
+	}
+
+	void OcclusionMap::clear()
+	{
+		walls_.clear();
+		dirty_ = true;
+	}
+
+	std::size_t OcclusionMap::getWallCount() const
+	{
+		return walls_.size();
+	}
+
+	float OcclusionMap::computeTransmission(const sf::Vector2f& listener, const sf::Vector2f& emitter)
+	{
+		if (dirty_)
+			build();
+		if (columns_ == 0)
+			return 1.f;
+
+		// Each wall is only counted once per query even if it overlaps several cells crossed by the ray
+		if (++query_ == 0) {
+			std::fill(visits_.begin(), visits_.end(), 0);
+			query_ = 1;
+		}
+
+		const float RAY_X = emitter.x - listener.x, RAY_Y = emitter.y - listener.y;
+		float transmission = 1.f;
+		walk(listener, emitter, [&](std::size_t cell) {
+			const std::size_t END = cellStarts_[cell + 1];
+			for (std::size_t i = cellStarts_[cell]; i < END; i += 4) {
+				// Parametric intersection of the ray (t) and the walls (u), both must lie within [0, 1]
+				unsigned int hits = 0;
+#if defined(AE_SIMD_SSE)
+				const __m128 DX = _mm_set1_ps(RAY_X), DY = _mm_set1_ps(RAY_Y);
+				const __m128 WX = _mm_loadu_ps(deltaX_.data() + i), WY = _mm_loadu_ps(deltaY_.data() + i);
+				const __m128 AX = _mm_sub_ps(_mm_loadu_ps(startX_.data() + i), _mm_set1_ps(listener.x));
+				const __m128 AY = _mm_sub_ps(_mm_loadu_ps(startY_.data() + i), _mm_set1_ps(listener.y));
+				const __m128 DENOMINATOR = _mm_sub_ps(_mm_mul_ps(DX, WY), _mm_mul_ps(DY, WX));
+				const __m128 T = _mm_div_ps(_mm_sub_ps(_mm_mul_ps(AX, WY), _mm_mul_ps(AY, WX)), DENOMINATOR);
+				const __m128 U = _mm_div_ps(_mm_sub_ps(_mm_mul_ps(AX, DY), _mm_mul_ps(AY, DX)), DENOMINATOR);
+				const __m128 ZERO = _mm_setzero_ps(), ONE = _mm_set1_ps(1.f);
+				const __m128 HIT = _mm_and_ps(_mm_and_ps(_mm_cmpgt_ps(T, ZERO), _mm_cmplt_ps(T, ONE)),
+				                              _mm_and_ps(_mm_cmpge_ps(U, ZERO), _mm_cmple_ps(U, ONE)));
+				hits = static_cast<unsigned int>(_mm_movemask_ps(HIT));
+#else
+				for (unsigned int lane = 0; lane < 4; ++lane) {
+					const float WX = deltaX_[i + lane], WY = deltaY_[i + lane];
+					const float AX = startX_[i + lane] - listener.x, AY = startY_[i + lane] - listener.y;
+					const float DENOMINATOR = RAY_X * WY - RAY_Y * WX;
+					if (DENOMINATOR == 0.f)
+						continue;
+					const float T = (AX * WY - AY * WX) / DENOMINATOR;
+					const float U = (AX * RAY_Y - AY * RAY_X) / DENOMINATOR;
+					if (T > 0.f && T < 1.f && U >= 0.f && U <= 1.f)
+						hits |= 1u << lane;
+				}
+#endif
+				for (unsigned int lane = 0; hits; ++lane, hits >>= 1) {
+					const sf::Uint32 WALL = cellWalls_[i + lane];
+					if ((hits & 1) && WALL != NO_WALL && visits_[WALL] != query_) {
+						visits_[WALL] = query_;
+						transmission *= walls_[WALL].transmission;
+					}
+				}
+			}
+			return transmission > SILENCE;
+		});
+
+		return transmission > SILENCE ? transmission : 0.f;
+	}
+
+	std::size_t OcclusionMap::computeTransmissions(const sf::Vector2f& listener, const sf::Vector2f* emitters, float* transmissions, std::size_t count, sf::Time budget)
+	{
+		sf::Clock clock;
+		for (std::size_t i = 0; i < count; ++i) {
+			if (budget > sf::Time::Zero && i % 8 == 0 && i > 0 && clock.getElapsedTime() >= budget)
+				return i;
+			transmissions[i] = computeTransmission(listener, emitters[i]);
+		}
+		return count;
+	}
+
+	void OcclusionMap::build()
+	{
+		dirty_ = false;
+		visits_.assign(walls_.size(), 0);
+		query_ = 0;
+		cellStarts_.clear();
+		cellWalls_.clear();
+		startX_.clear();
+		startY_.clear();
+		deltaX_.clear();
+		deltaY_.clear();
+		columns_ = rows_ = 0;
+		if (walls_.empty())
+			return;
+
+		// The grid covers the walls' bounding box, its cells grow until there aren't too many of them
+		sf::Vector2f minimum = walls_.front().start, maximum = walls_.front().start;
+		for (const Wall& wall : walls_) {
+			minimum.x = std::min(minimum.x, std::min(wall.start.x, wall.end.x));
+			minimum.y = std::min(minimum.y, std::min(wall.start.y, wall.end.y));
+			maximum.x = std::max(maximum.x, std::max(wall.start.x, wall.end.x));
+			maximum.y = std::max(maximum.y, std::max(wall.start.y, wall.end.y));
+		}
+		gridCellSize_ = cellSize_;
+		while ((static_cast<double>(maximum.x - minimum.x) / gridCellSize_ + 1.0) * (static_cast<double>(maximum.y - minimum.y) / gridCellSize_ + 1.0) > MAX_CELLS)
+			gridCellSize_ *= 2.f;
+		origin_ = minimum;
+		columns_ = static_cast<std::size_t>((maximum.x - minimum.x) / gridCellSize_) + 1;
+		rows_ = static_cast<std::size_t>((maximum.y - minimum.y) / gridCellSize_) + 1;
+
+		// Counting sort of the walls into the cells they cross, each cell padded to a multiple of four
+		std::vector<std::size_t> counts(columns_ * rows_, 0);
+		for (const Wall& wall : walls_)
+			walk(wall.start, wall.end, [&counts](std::size_t cell) { ++counts[cell]; return true; });
+
+		cellStarts_.resize(counts.size() + 1);
+		std::size_t total = 0;
+		for (std::size_t cell = 0; cell < counts.size(); ++cell) {
+			cellStarts_[cell] = total;
+			total += (counts[cell] + 3) / 4 * 4;
+		}
+		cellStarts_.back() = total;
+
+		cellWalls_.assign(total, NO_WALL);
+		startX_.assign(total, 0.f);
+		startY_.assign(total, 0.f);
+		deltaX_.assign(total, 0.f);
+		deltaY_.assign(total, 0.f);
+		std::fill(counts.begin(), counts.end(), 0);
+		for (std::size_t w = 0; w < walls_.size(); ++w) {
+			const Wall& WALL = walls_[w];
+			walk(WALL.start, WALL.end, [&](std::size_t cell) {
+				const std::size_t INDEX = cellStarts_[cell] + counts[cell]++;
+				cellWalls_[INDEX] = static_cast<sf::Uint32>(w);
+				startX_[INDEX] = WALL.start.x;
+				startY_[INDEX] = WALL.start.y;
+				deltaX_[INDEX] = WALL.end.x - WALL.start.x;
+				deltaY_[INDEX] = WALL.end.y - WALL.start.y;
+				return true;
+			});
+		}
+	}
+
+	template <typename F>
+	void OcclusionMap::walk(const sf::Vector2f& start, const sf::Vector2f& end, F visit) const
+	{
+		// Clips the segment to the grid's bounds (slabs)
+		const float DX = end.x - start.x, DY = end.y - start.y;
+		const float WIDTH = columns_ * gridCellSize_, HEIGHT = rows_ * gridCellSize_;
+		float first = 0.f, last = 1.f;
+		const float ORIGINS[2] = { start.x - origin_.x, start.y - origin_.y };
+		const float DELTAS[2] = { DX, DY };
+		const float SIZES[2] = { WIDTH, HEIGHT };
+		for (unsigned int axis = 0; axis < 2; ++axis) {
+			if (DELTAS[axis] == 0.f) {
+				if (ORIGINS[axis] < 0.f || ORIGINS[axis] > SIZES[axis])
+					return;
+				continue;
+			}
+			float entry = -ORIGINS[axis] / DELTAS[axis];
+			float leave = (SIZES[axis] - ORIGINS[axis]) / DELTAS[axis];
+			if (entry > leave)
+				std::swap(entry, leave);
+			first = std::max(first, entry);
+			last = std::min(last, leave);
+		}
+		if (first > last)
+			return;
+
+		// Walks the cells in the order they're crossed (Amanatides and Woo)
+		const float LOCAL_X = ORIGINS[0] + DX * first, LOCAL_Y = ORIGINS[1] + DY * first;
+		long column = std::min(static_cast<long>(columns_) - 1, std::max(0L, static_cast<long>(std::floor(LOCAL_X / gridCellSize_))));
+		long row = std::min(static_cast<long>(rows_) - 1, std::max(0L, static_cast<long>(std::floor(LOCAL_Y / gridCellSize_))));
+		const long STEP_X = DX > 0.f ? 1 : -1, STEP_Y = DY > 0.f ? 1 : -1;
+		const float UNREACHABLE = std::numeric_limits<float>::infinity();
+		float nextX = DX != 0.f ? ((column + (DX > 0.f ? 1 : 0)) * gridCellSize_ - ORIGINS[0]) / DX : UNREACHABLE;
+		float nextY = DY != 0.f ? ((row + (DY > 0.f ? 1 : 0)) * gridCellSize_ - ORIGINS[1]) / DY : UNREACHABLE;
+		const float STRIDE_X = DX != 0.f ? gridCellSize_ / std::fabs(DX) : UNREACHABLE;
+		const float STRIDE_Y = DY != 0.f ? gridCellSize_ / std::fabs(DY) : UNREACHABLE;
+
+		while (visit(static_cast<std::size_t>(row) * columns_ + static_cast<std::size_t>(column))) {
+			if (std::min(nextX, nextY) >= last)
+				return;
+			if (nextX < nextY) {
+				column += STEP_X;
+				nextX += STRIDE_X;
+				if (column < 0 || column >= static_cast<long>(columns_))
+					return;
+			}
+			else {
+				row += STEP_Y;
+				nextY += STRIDE_Y;
+				if (row < 0 || row >= static_cast<long>(rows_))
+					return;
+			}
+		}
+	}
+}
\ No newline at end of file
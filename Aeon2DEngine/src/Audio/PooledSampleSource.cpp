@@ -0,0 +1,244 @@
+#include <algorithm>
+#include <cstring>
+
+#include "../../include/Audio/PooledSampleSource.h"
+
+namespace ae
+{
+	PooledSampleSource::PooledSampleSource(std::unique_ptr<SampleSource> source, DecodePool& pool, std::size_t bufferFrames, std::size_t headFrames)
+		: SampleSource()
+		, source_(std::move(source))
+		, pool_(pool)
+		, CHANNEL_COUNT(source_->getChannelCount())
+		, SAMPLE_RATE(source_->getSampleRate())
+		, FRAME_COUNT(source_->getFrameCount())
+		, ringFrames_(std::max<std::size_t>(bufferFrames, 1024))
+		, chunkFrames_(std::max<std::size_t>(ringFrames_ / 4, 1024))
+		, head_()
+		, ring_(ringFrames_ * CHANNEL_COUNT)
+		, readCount_(0)
+		, writeCount_(0)
+		, seekFrame_(0)
+		, seekWrite_(0)
+		, seekRequest_(0)
+		, seekApplied_(0)
+		, decodeMutex_()
+		, decodeFrame_(0)
+		, reposition_(false)
+		, headCursor_(0)
+		, ringFrame_(0)
+		, seekPending_(0)
+		, underruns_(0)
+	{
+		// Decode the first frames straight away, the ring buffer continues after them
+		head_.resize(static_cast<std::size_t>(std::min<sf::Uint64>(headFrames, FRAME_COUNT)) * CHANNEL_COUNT);
+		const std::size_t HEAD_FRAMES = CHANNEL_COUNT > 0 ? source_->read(head_.data(), head_.size() / CHANNEL_COUNT) : 0;
+		head_.resize(HEAD_FRAMES * CHANNEL_COUNT);
+		decodeFrame_ = HEAD_FRAMES;
+		ringFrame_ = HEAD_FRAMES;
+
+		pool_.attach(*this);
+	}
+
+	PooledSampleSource::~PooledSampleSource()
+	{
+		pool_.detach(*this);
+	}
+
+	std::size_t PooledSampleSource::read(sf::Int16* samples, std::size_t frameCount)
+	{
+		// Read the first frames kept decoded
+		const sf::Uint64 HEAD_FRAMES = head_.size() / std::max(CHANNEL_COUNT, 1u);
+		std::size_t read = 0;
+		if (headCursor_ < HEAD_FRAMES) {
+			read = static_cast<std::size_t>(std::min<sf::Uint64>(frameCount, HEAD_FRAMES - headCursor_));
+			std::memcpy(samples, head_.data() + headCursor_ * CHANNEL_COUNT, read * CHANNEL_COUNT * sizeof(sf::Int16));
+			headCursor_ += read;
+		}
+		if (read == frameCount)
+			return read;
+
+		// Then the frames decoded ahead, decoding them on the spot if the pool has no thread
+		read += readRing(samples + read * CHANNEL_COUNT, frameCount - read);
+		if (read < frameCount && pool_.getThreadCount() == 0) {
+			std::lock_guard<std::mutex> lock(decodeMutex_);
+			decode();
+			read += readRing(samples + read * CHANNEL_COUNT, frameCount - read);
+		}
+
+		if (read < frameCount && ringFrame_ < FRAME_COUNT)
+			++underruns_;
+		return read;
+	}
+
+	void PooledSampleSource::seek(sf::Uint64 frame)
+	{
+		// The first frames are read from the ones kept decoded while the decode threads seek after them
+		const sf::Uint64 HEAD_FRAMES = head_.size() / std::max(CHANNEL_COUNT, 1u);
+		frame = std::min(frame, FRAME_COUNT);
+		headCursor_ = std::min(frame, HEAD_FRAMES);
+		const sf::Uint64 TARGET = std::max(frame, HEAD_FRAMES);
+
+		// The target may already be decoded ahead (i.e. the source looped before reading past its first frames, or a short skip forward),
+		// the frames before it are dropped instead of seeking the decoder
+		if (TARGET >= ringFrame_ && seekPending_ == seekApplied_.load(std::memory_order_acquire)) {
+			const sf::Uint64 CONSUMED = std::max(readCount_.load(std::memory_order_relaxed), seekWrite_.load(std::memory_order_relaxed));
+			if (TARGET - ringFrame_ <= writeCount_.load(std::memory_order_acquire) - CONSUMED) {
+				readCount_.store(CONSUMED + (TARGET - ringFrame_), std::memory_order_release);
+				ringFrame_ = TARGET;
+				return;
+			}
+		}
+
+		seekFrame_.store(TARGET, std::memory_order_relaxed);
+		seekPending_ = seekRequest_.fetch_add(1, std::memory_order_release) + 1;
+		ringFrame_ = TARGET;
+	}
+
+	bool PooledSampleSource::setBuffering(std::size_t bufferFrames, std::size_t chunkFrames)
+	{
+		std::lock_guard<std::mutex> lock(decodeMutex_);
+		const std::size_t RING_FRAMES = std::max<std::size_t>(bufferFrames, 1024);
+		std::vector<sf::Int16> ring(RING_FRAMES * CHANNEL_COUNT);
+
+		// Move the frames decoded ahead to the new ring buffer, those that don't fit are decoded again
+		sf::Uint64 kept = 0;
+		if (seekPending_ == seekApplied_.load(std::memory_order_acquire)) {
+			const sf::Uint64 CONSUMED = std::max(readCount_.load(std::memory_order_relaxed), seekWrite_.load(std::memory_order_relaxed));
+			const sf::Uint64 AVAILABLE = writeCount_.load(std::memory_order_relaxed) - CONSUMED;
+			kept = std::min<sf::Uint64>(AVAILABLE, RING_FRAMES);
+			for (sf::Uint64 copied = 0; copied < kept;) {
+				const std::size_t POSITION = static_cast<std::size_t>((CONSUMED + copied) % ringFrames_);
+				const std::size_t FRAMES = static_cast<std::size_t>(std::min<sf::Uint64>(kept - copied, ringFrames_ - POSITION));
+				std::memcpy(ring.data() + copied * CHANNEL_COUNT, ring_.data() + POSITION * CHANNEL_COUNT, FRAMES * CHANNEL_COUNT * sizeof(sf::Int16));
+				copied += FRAMES;
+			}
+			if (kept < AVAILABLE) {
+				decodeFrame_ = ringFrame_ + kept;
+				reposition_ = true;
+			}
+		}
+
+		ring_.swap(ring);
+		ringFrames_ = RING_FRAMES;
+		chunkFrames_ = (chunkFrames > 0) ? std::min(chunkFrames, ringFrames_) : std::max<std::size_t>(ringFrames_ / 4, 1024);
+		readCount_.store(0, std::memory_order_relaxed);
+		seekWrite_.store(0, std::memory_order_relaxed);
+		writeCount_.store(kept, std::memory_order_release);
+		return true;
+	}
+
+	sf::Uint64 PooledSampleSource::getFrameCount() const
+	{
+		return FRAME_COUNT;
+	}
+
+	unsigned int PooledSampleSource::getChannelCount() const
+	{
+		return CHANNEL_COUNT;
+	}
+
+	unsigned int PooledSampleSource::getSampleRate() const
+	{
+		return SAMPLE_RATE;
+	}
+
+	std::size_t PooledSampleSource::getUnderrunCount() const
+	{
+		return underruns_;
+	}
+
+	bool PooledSampleSource::getBufferState(float& fill, std::size_t& underruns) const
+	{
+		const sf::Uint64 WANTED = std::min<sf::Uint64>(ringFrames_, FRAME_COUNT - std::min(ringFrame_, FRAME_COUNT));
+		const sf::Uint64 AVAILABLE = writeCount_.load(std::memory_order_acquire) - readCount_.load(std::memory_order_acquire);
+		if (seekPending_ != seekApplied_.load(std::memory_order_acquire))
+			fill = 0.f;
+		else
+			fill = WANTED > 0 ? std::min(static_cast<float>(AVAILABLE) / WANTED, 1.f) : 1.f;
+		underruns = underruns_;
+		return true;
+	}
+
+	float PooledSampleSource::getLead() const
+	{
+		if (seekRequest_.load(std::memory_order_acquire) != seekApplied_.load(std::memory_order_acquire))
+			return 0.f;
+
+		const sf::Uint64 AVAILABLE = writeCount_.load(std::memory_order_acquire) - readCount_.load(std::memory_order_acquire);
+		return static_cast<float>(AVAILABLE) / std::max(SAMPLE_RATE, 1u);
+	}
+
+	bool PooledSampleSource::decode()
+	{
+		bool decoded = false;
+		sf::Uint64 written = writeCount_.load(std::memory_order_relaxed);
+
+		// Apply the last seek requested, the frames written from now on follow the new position
+		const unsigned int REQUEST = seekRequest_.load(std::memory_order_acquire);
+		if (REQUEST != seekApplied_.load(std::memory_order_relaxed)) {
+			decodeFrame_ = seekFrame_.load(std::memory_order_relaxed);
+			source_->seek(decodeFrame_);
+			reposition_ = false;
+			seekWrite_.store(written, std::memory_order_relaxed);
+			seekApplied_.store(REQUEST, std::memory_order_release);
+			decoded = true;
+		}
+		else if (reposition_) {
+			// The frames that didn't fit in a smaller ring buffer are decoded again
+			source_->seek(decodeFrame_);
+			reposition_ = false;
+		}
+
+		// Refill the free space of the ring buffer, in at most two contiguous parts
+		const sf::Uint64 FREE = ringFrames_ - (written - readCount_.load(std::memory_order_acquire));
+		if (FREE == 0 || decodeFrame_ >= FRAME_COUNT || (FREE < chunkFrames_ && pool_.getThreadCount() > 0))
+			return decoded;
+
+		sf::Uint64 left = std::min(FREE, FRAME_COUNT - decodeFrame_);
+		while (left > 0) {
+			const std::size_t POSITION = static_cast<std::size_t>(written % ringFrames_);
+			const std::size_t FRAMES = static_cast<std::size_t>(std::min<sf::Uint64>(left, ringFrames_ - POSITION));
+			const std::size_t READ = source_->read(ring_.data() + POSITION * CHANNEL_COUNT, FRAMES);
+			if (READ == 0) {
+				// The source ended earlier than announced
+				decodeFrame_ = FRAME_COUNT;
+				break;
+			}
+
+			written += READ;
+			decodeFrame_ += READ;
+			left -= READ;
+			writeCount_.store(written, std::memory_order_release);
+			decoded = true;
+		}
+
+		return decoded;
+	}
+
+	std::size_t PooledSampleSource::readRing(sf::Int16* samples, std::size_t frameCount)
+	{
+		// Skip the frames written before the last seek once the decode threads have applied it
+		sf::Uint64 consumed = readCount_.load(std::memory_order_relaxed);
+		if (seekPending_ != seekApplied_.load(std::memory_order_acquire))
+			return 0;
+		if (consumed < seekWrite_.load(std::memory_order_relaxed)) {
+			consumed = seekWrite_.load(std::memory_order_relaxed);
+			readCount_.store(consumed, std::memory_order_release);
+		}
+
+		const sf::Uint64 AVAILABLE = writeCount_.load(std::memory_order_acquire) - consumed;
+		std::size_t read = 0;
+		const std::size_t TOTAL = static_cast<std::size_t>(std::min<sf::Uint64>(frameCount, AVAILABLE));
+		while (read < TOTAL) {
+			const std::size_t POSITION = static_cast<std::size_t>((consumed + read) % ringFrames_);
+			const std::size_t FRAMES = std::min(TOTAL - read, ringFrames_ - POSITION);
+			std::memcpy(samples + read * CHANNEL_COUNT, ring_.data() + POSITION * CHANNEL_COUNT, FRAMES * CHANNEL_COUNT * sizeof(sf::Int16));
+			read += FRAMES;
+		}
+
+		readCount_.store(consumed + read, std::memory_order_release);
+		ringFrame_ += read;
+		return read;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,184 @@
+#include <algorithm>
+#include <cmath>
+
+#include "../../include/Utils/Simd.h"
+#include "../../include/Audio/Reverb.h"
+
+namespace ae
+{
+	namespace
+	{
+		// Freeverb's tuning, in frames at 44100 Hz (the right channel's delay lines are longer by the stereo spread)
+		const std::size_t COMB_TUNING[8] = { 1116, 1188, 1277, 1356, 1422, 1491, 1557, 1617 };
+		const std::size_t ALLPASS_TUNING[4] = { 556, 441, 341, 225 };
+		const std::size_t STEREO_SPREAD = 23;
+
+		const float INPUT_GAIN = 0.015f;
+		const float WET_SCALE = 3.f;
+		const float DAMPING_SCALE = 0.4f;
+		const float ROOM_SCALE = 0.28f;
+		const float ROOM_OFFSET = 0.7f;
+		const float ALLPASS_FEEDBACK = 0.5f;
+	}
+
+	Reverb::Reverb()
+		: AudioEffect()
+		, roomSize_(0.5f)
+		, damping_(0.5f)
+		, wet_(0.3f)
+		, dry_(1.f)
+		, width_(1.f)
+		, sampleRate_(0)
+		, lines_()
+		, offsets_()
+		, lengths_()
+		, cursors_()
+		, combStates_()
+	{
+	}
+
+	void Reverb::process(float* frames, std::size_t frameCount, unsigned int sampleRate)
+	{
+		if (sampleRate != sampleRate_)
+			allocate(sampleRate);
+
+		const float FEEDBACK = roomSize_ * ROOM_SCALE + ROOM_OFFSET;
+		const float DAMP_1 = damping_ * DAMPING_SCALE;
+		const float DAMP_2 = 1.f - DAMP_1;
+		const float WIDTH = width_;
+		const float WET_1 = wet_ * WET_SCALE * (WIDTH / 2.f + 0.5f);
+		const float WET_2 = wet_ * WET_SCALE * ((1.f - WIDTH) / 2.f);
+		const float DRY = dry_;
+		float* lines = lines_.data();
+
+		alignas(16) float delayed[COMB_COUNT];
+		alignas(16) float written[COMB_COUNT];
+		for (std::size_t i = 0; i < frameCount; ++i) {
+			const float INPUT = (frames[i * 2] + frames[i * 2 + 1]) * INPUT_GAIN;
+			for (std::size_t k = 0; k < COMB_COUNT; ++k)
+				delayed[k] = lines[offsets_[k] + cursors_[k]];
+
+			// Advance the damped comb filters of both channels four at a time
+			float outputLeft = 0.f, outputRight = 0.f;
+#if defined(AE_SIMD_SSE)
+			const __m128 INPUT_4 = _mm_set1_ps(INPUT);
+			const __m128 FEEDBACK_4 = _mm_set1_ps(FEEDBACK);
+			const __m128 DAMP_1_4 = _mm_set1_ps(DAMP_1);
+			const __m128 DAMP_2_4 = _mm_set1_ps(DAMP_2);
+			__m128 sums[2] = { _mm_setzero_ps(), _mm_setzero_ps() };
+			for (std::size_t k = 0; k < COMB_COUNT; k += 4) {
+				const __m128 DELAYED = _mm_load_ps(delayed + k);
+				const __m128 STATE = _mm_add_ps(_mm_mul_ps(DELAYED, DAMP_2_4), _mm_mul_ps(_mm_loadu_ps(combStates_ + k), DAMP_1_4));
+				_mm_storeu_ps(combStates_ + k, STATE);
+				_mm_store_ps(written + k, _mm_add_ps(INPUT_4, _mm_mul_ps(STATE, FEEDBACK_4)));
+				sums[k / 8] = _mm_add_ps(sums[k / 8], DELAYED);
+			}
+
+			alignas(16) float totals[8];
+			_mm_store_ps(totals, sums[0]);
+			_mm_store_ps(totals + 4, sums[1]);
+			outputLeft = totals[0] + totals[1] + totals[2] + totals[3];
+			outputRight = totals[4] + totals[5] + totals[6] + totals[7];
+#else
+			for (std::size_t k = 0; k < COMB_COUNT; ++k) {
+				combStates_[k] = delayed[k] * DAMP_2 + combStates_[k] * DAMP_1;
+				written[k] = INPUT + combStates_[k] * FEEDBACK;
+				(k < COMB_COUNT / 2 ? outputLeft : outputRight) += delayed[k];
+			}
+#endif
+			for (std::size_t k = 0; k < COMB_COUNT; ++k) {
+				lines[offsets_[k] + cursors_[k]] = written[k];
+				cursors_[k] = (cursors_[k] + 1 == lengths_[k]) ? 0 : cursors_[k] + 1;
+			}
+
+			// Diffuse the reflections through the serial all-pass filters of each channel
+			for (std::size_t k = COMB_COUNT; k < LINE_COUNT; ++k) {
+				float& output = (k < COMB_COUNT + 4) ? outputLeft : outputRight;
+				float& line = lines[offsets_[k] + cursors_[k]];
+				const float DELAYED = line;
+				line = output + DELAYED * ALLPASS_FEEDBACK;
+				output = DELAYED - output;
+				cursors_[k] = (cursors_[k] + 1 == lengths_[k]) ? 0 : cursors_[k] + 1;
+			}
+
+			const float LEFT = frames[i * 2], RIGHT = frames[i * 2 + 1];
+			frames[i * 2] = outputLeft * WET_1 + outputRight * WET_2 + LEFT * DRY;
+			frames[i * 2 + 1] = outputRight * WET_1 + outputLeft * WET_2 + RIGHT * DRY;
+		}
+	}
+
+	void Reverb::reset()
+	{
+		std::fill(lines_.begin(), lines_.end(), 0.f);
+		std::fill(std::begin(combStates_), std::end(combStates_), 0.f);
+	}
+
+	void Reverb::setRoomSize(float roomSize)
+	{
+		roomSize_ = fmaxf(fminf(roomSize, 1.f), 0.f);
+	}
+
+	float Reverb::getRoomSize() const
+	{
+		return roomSize_;
+	}
+
+	void Reverb::setDamping(float damping)
+	{
+		damping_ = fmaxf(fminf(damping, 1.f), 0.f);
+	}
+
+	float Reverb::getDamping() const
+	{
+		return damping_;
+	}
+
+	void Reverb::setWet(float wet)
+	{
+		wet_ = fmaxf(fminf(wet, 1.f), 0.f);
+	}
+
+	float Reverb::getWet() const
+	{
+		return wet_;
+	}
+
+	void Reverb::setDry(float dry)
+	{
+		dry_ = fmaxf(fminf(dry, 1.f), 0.f);
+	}
+
+	float Reverb::getDry() const
+	{
+		return dry_;
+	}
+
+	void Reverb::setWidth(float width)
+	{
+		width_ = fmaxf(fminf(width, 1.f), 0.f);
+	}
+
+	float Reverb::getWidth() const
+	{
+		return width_;
+	}
+
+	void Reverb::allocate(unsigned int sampleRate)
+	{
+		sampleRate_ = sampleRate;
+
+		// Scale the tuning to the sample rate, keeping every delay line at least one frame long
+		std::size_t total = 0;
+		for (std::size_t k = 0; k < LINE_COUNT; ++k) {
+			const std::size_t CHANNEL = (k < COMB_COUNT) ? k / 8 : (k - COMB_COUNT) / 4;
+			const std::size_t TUNING = (k < COMB_COUNT) ? COMB_TUNING[k % 8] : ALLPASS_TUNING[(k - COMB_COUNT) % 4];
+			lengths_[k] = std::max<std::size_t>((TUNING + CHANNEL * STEREO_SPREAD) * sampleRate / 44100, 1);
+			offsets_[k] = total;
+			cursors_[k] = 0;
+			total += lengths_[k];
+		}
+
+		lines_.assign(total, 0.f);
+		std::fill(std::begin(combStates_), std::end(combStates_), 0.f);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,14 @@
+#include "../../include/Audio/SampleSource.h"
+
+namespace ae
+{
+	bool SampleSource::getBufferState(float&, std::size_t&) const
+	{
+		return false;
+	}
+
+	bool SampleSource::setBuffering(std::size_t, std::size_t)
+	{
+		return false;
+	}
+}
\ No newline at end of file
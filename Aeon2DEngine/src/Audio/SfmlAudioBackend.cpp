@@ -0,0 +1,380 @@
+#include <algorithm>
+#include <chrono>
+
+#include <SFML/Audio/Listener.hpp>
+#include <SFML/System/Clock.hpp>
+
+#include "../../include/Audio/SfmlAudioBackend.h"
+
+namespace ae
+{
+	SfmlAudioBackend::SfmlAudioBackend()
+		: AudioBackend()
+		, sources_()
+		, nextId_(1)
+		, clock_()
+		, worker_()
+		, mutex_()
+		, workCondition_()
+		, running_(false)
+	{
+	}
+
+	SfmlAudioBackend::~SfmlAudioBackend()
+	{
+		if (worker_.joinable()) {
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				running_ = false;
+			}
+			workCondition_.notify_one();
+			worker_.join();
+		}
+	}
+
+	AudioBackend::SourceID SfmlAudioBackend::createSound(const sf::SoundBuffer& buffer)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Source& source = sources_[nextId_];
+		source.sound = std::make_unique<sf::Sound>(buffer);
+
+		return nextId_++;
+	}
+
+	AudioBackend::SourceID SfmlAudioBackend::createStream(const std::string& filepath)
+	{
+		auto music = std::make_unique<sf::Music>();
+		if (!music->openFromFile(filepath))
+			return 0;
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		sources_[nextId_].music = std::move(music);
+		return nextId_++;
+	}
+
+	AudioBackend::SourceID SfmlAudioBackend::createStream(const void* data, std::size_t size)
+	{
+		auto music = std::make_unique<sf::Music>();
+		if (!music->openFromMemory(data, size))
+			return 0;
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		sources_[nextId_].music = std::move(music);
+		return nextId_++;
+	}
+
+	AudioBackend::SourceID SfmlAudioBackend::createStream(std::unique_ptr<sf::InputStream> stream)
+	{
+		auto music = std::make_unique<sf::Music>();
+		if (!stream || !music->openFromStream(*stream))
+			return 0;
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		Source& source = sources_[nextId_];
+		source.stream = std::move(stream);
+		source.music = std::move(music);
+		return nextId_++;
+	}
+
+	void SfmlAudioBackend::destroySource(SourceID source)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		sources_.erase(source);
+	}
+
+	void SfmlAudioBackend::play(SourceID source)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Source* found = findSource(source);
+		if (found) {
+			found->scheduled = false;
+			startSource(*found);
+		}
+	}
+
+	void SfmlAudioBackend::playAt(SourceID source, sf::Time clockTime)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Source* found = findSource(source);
+		if (!found)
+			return;
+
+		if (clockTime <= clock_.getElapsedTime()) {
+			found->scheduled = false;
+			startSource(*found);
+		}
+		else if (found->sound ? found->sound->getStatus() != sf::SoundSource::Status::Playing
+		                      : found->music->getStatus() != sf::SoundSource::Status::Playing) {
+			found->scheduled = true;
+			found->startTime = clockTime;
+			wakeWorker();
+		}
+	}
+
+	void SfmlAudioBackend::pause(SourceID source)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Source* found = findSource(source);
+		if (found)
+			found->scheduled = false;
+
+		if (found && found->sound)
+			found->sound->pause();
+		else if (found)
+			found->music->pause();
+	}
+
+	void SfmlAudioBackend::stop(SourceID source)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Source* found = findSource(source);
+		if (found)
+			found->scheduled = false;
+
+		if (found && found->sound)
+			found->sound->stop();
+		else if (found)
+			found->music->stop();
+
+		if (found)
+			found->pendingOffset = sf::Time::Zero;
+	}
+
+	void SfmlAudioBackend::setLoop(SourceID source, bool flag)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Source* found = findSource(source);
+		if (found && found->sound)
+			found->sound->setLoop(flag);
+		else if (found)
+			found->music->setLoop(flag);
+	}
+
+	void SfmlAudioBackend::setVolume(SourceID source, float volume)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Source* found = findSource(source);
+		if (found) {
+			found->volume = volume;
+			findSoundSource(source)->setVolume(volume * found->fadeGain);
+		}
+	}
+
+	void SfmlAudioBackend::fade(SourceID source, float gain, sf::Time duration, bool stop)
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		Source* found = findSource(source);
+		if (!found)
+			return;
+
+		found->fadeTarget = std::max(0.f, std::min(gain, 1.f));
+		found->fadeLeft = std::max(duration, sf::Time::Zero);
+		found->stopAfterFade = stop;
+		if (found->fadeLeft == sf::Time::Zero) {
+			found->fadeGain = found->fadeTarget;
+			findSoundSource(source)->setVolume(found->volume * found->fadeGain);
+			lock.unlock();
+			if (stop)
+				this->stop(source);
+			return;
+		}
+
+		wakeWorker();
+	}
+
+	void SfmlAudioBackend::setProperties(SourceID source, const AudioProperties& properties)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		sf::SoundSource* soundSource = findSoundSource(source);
+		if (soundSource) {
+			soundSource->setAttenuation(properties.getAttenuation());
+			soundSource->setPitch(properties.getPitch());
+			soundSource->setMinDistance(properties.getMinDistance3D());
+			soundSource->setRelativeToListener(properties.isRelativeToListener());
+		}
+	}
+
+	void SfmlAudioBackend::setPosition(SourceID source, const sf::Vector3f& position)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		sf::SoundSource* soundSource = findSoundSource(source);
+		if (soundSource)
+			soundSource->setPosition(position);
+	}
+
+	void SfmlAudioBackend::setPlayingOffset(SourceID source, sf::Time offset)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Source* found = findSource(source);
+		if (!found)
+			return;
+
+		if (getSourceStatus(*found) == sf::SoundSource::Status::Stopped)
+			found->pendingOffset = offset;
+		else if (found->sound)
+			found->sound->setPlayingOffset(offset);
+		else
+			found->music->setPlayingOffset(offset);
+	}
+
+	sf::Time SfmlAudioBackend::getPlayingOffset(SourceID source) const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		const Source* found = findSource(source);
+		if (!found)
+			return sf::Time::Zero;
+		else if (found->pendingOffset > sf::Time::Zero && getSourceStatus(*found) == sf::SoundSource::Status::Stopped)
+			return found->pendingOffset;
+		return found->sound ? found->sound->getPlayingOffset() : found->music->getPlayingOffset();
+	}
+
+	sf::SoundSource::Status SfmlAudioBackend::getStatus(SourceID source) const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		const Source* found = findSource(source);
+		return found ? getSourceStatus(*found) : sf::SoundSource::Status::Stopped;
+	}
+
+	void SfmlAudioBackend::setListenerPosition(const sf::Vector3f& position)
+	{
+		sf::Listener::setPosition(position);
+	}
+
+	sf::Vector3f SfmlAudioBackend::getListenerPosition() const
+	{
+		return sf::Listener::getPosition();
+	}
+
+	std::size_t SfmlAudioBackend::getMaxSources() const
+	{
+		return 128;
+	}
+
+	sf::Time SfmlAudioBackend::getAudioClock() const
+	{
+		return clock_.getElapsedTime();
+	}
+
+	SfmlAudioBackend::Source* SfmlAudioBackend::findSource(SourceID source)
+	{
+		auto found = sources_.find(source);
+		return found != sources_.end() ? &found->second : nullptr;
+	}
+
+	const SfmlAudioBackend::Source* SfmlAudioBackend::findSource(SourceID source) const
+	{
+		auto found = sources_.find(source);
+		return found != sources_.end() ? &found->second : nullptr;
+	}
+
+	sf::SoundSource* SfmlAudioBackend::findSoundSource(SourceID source)
+	{
+		Source* found = findSource(source);
+		if (!found)
+			return nullptr;
+		return found->sound ? static_cast<sf::SoundSource*>(found->sound.get()) : found->music.get();
+	}
+
+	sf::SoundSource::Status SfmlAudioBackend::getSourceStatus(const Source& source) const
+	{
+		if (source.scheduled)
+			return sf::SoundSource::Status::Playing;
+		return source.sound ? source.sound->getStatus() : source.music->getStatus();
+	}
+
+	void SfmlAudioBackend::startSource(Source& source)
+	{
+		const bool STOPPED = getSourceStatus(source) == sf::SoundSource::Status::Stopped;
+		if (source.sound)
+			source.sound->play();
+		else
+			source.music->play();
+
+		if (STOPPED && source.pendingOffset > sf::Time::Zero) {
+			if (source.sound)
+				source.sound->setPlayingOffset(source.pendingOffset);
+			else
+				source.music->setPlayingOffset(source.pendingOffset);
+			source.pendingOffset = sf::Time::Zero;
+		}
+	}
+
+	void SfmlAudioBackend::wakeWorker()
+	{
+		if (!worker_.joinable()) {
+			running_ = true;
+			worker_ = std::thread(&SfmlAudioBackend::runWorker, this);
+		}
+		workCondition_.notify_one();
+	}
+
+	void SfmlAudioBackend::runWorker()
+	{
+		// Interval between two volume updates of the fading sources
+		const sf::Time FADE_INTERVAL = sf::milliseconds(10);
+
+		std::unique_lock<std::mutex> lock(mutex_);
+		sf::Clock clock;
+		while (running_) {
+			const sf::Time ELAPSED = clock.restart();
+			const sf::Time NOW = clock_.getElapsedTime();
+			sf::Time wait = sf::Time::Zero;
+			for (auto& entry : sources_) {
+				Source& source = entry.second;
+				if (source.scheduled) {
+					if (source.startTime <= NOW) {
+						source.scheduled = false;
+						startSource(source);
+					}
+					else if (wait == sf::Time::Zero || source.startTime - NOW < wait) {
+						wait = source.startTime - NOW;
+					}
+				}
+				if (source.fadeLeft == sf::Time::Zero)
+					continue;
+
+				// The ramps only advance while their source is playing
+				wait = wait == sf::Time::Zero ? FADE_INTERVAL : std::min(wait, FADE_INTERVAL);
+				sf::SoundSource* soundSource = findSoundSource(entry.first);
+				if (soundSource->getStatus() != sf::SoundSource::Status::Playing)
+					continue;
+
+				const sf::Time STEP = std::min(ELAPSED, source.fadeLeft);
+				source.fadeGain += (source.fadeTarget - source.fadeGain) * (STEP / source.fadeLeft);
+				source.fadeLeft -= STEP;
+				soundSource->setVolume(source.volume * source.fadeGain);
+
+				if (source.fadeLeft == sf::Time::Zero && source.stopAfterFade) {
+					if (source.sound)
+						source.sound->stop();
+					else
+						source.music->stop();
+					source.pendingOffset = sf::Time::Zero;
+				}
+			}
+
+			if (wait > sf::Time::Zero) {
+				workCondition_.wait_for(lock, std::chrono::microseconds(wait.asMicroseconds()));
+			}
+			else {
+				workCondition_.wait(lock);
+				clock.restart();
+			}
+		}
+	}
+
+	SfmlAudioBackend::Source::Source()
+		: sound(nullptr)
+		, stream(nullptr)
+		, music(nullptr)
+		, pendingOffset(sf::Time::Zero)
+		, volume(100.f)
+		, fadeGain(1.f)
+		, fadeTarget(1.f)
+		, fadeLeft(sf::Time::Zero)
+		, stopAfterFade(false)
+		, scheduled(false)
+		, startTime(sf::Time::Zero)
+	{
+	}
+}
\ No newline at end of file
@@ -0,0 +1,248 @@
+#include <limits>
+
+#include "../../include/Audio/FileSampleSource.h"
+#include "../../include/Audio/PooledSampleSource.h"
+#include "../../include/Audio/StemSampleSource.h"
+#include "../../include/Audio/SoftwareAudioBackend.h"
+
+namespace ae
+{
+	SoftwareAudioBackend::SoftwareAudioBackend(unsigned int sampleRate, std::size_t blockFrames, std::size_t decodeThreads)
+		: SoftwareAudioBackend(sampleRate, blockFrames, decodeThreads, true)
+	{
+	}
+
+	AudioBackend::SourceID SoftwareAudioBackend::createSound(const sf::SoundBuffer& buffer)
+	{
+		return mixer_.createVoice(buffer);
+	}
+
+	AudioBackend::SourceID SoftwareAudioBackend::createStream(const std::string& filepath)
+	{
+		auto source = std::make_unique<FileSampleSource>();
+		if (!source->openFromFile(filepath))
+			return 0;
+
+		return mixer_.createVoice(std::make_unique<PooledSampleSource>(std::move(source), decodePool_));
+	}
+
+	AudioBackend::SourceID SoftwareAudioBackend::createStream(const void* data, std::size_t size)
+	{
+		auto source = std::make_unique<FileSampleSource>();
+		if (!source->openFromMemory(data, size))
+			return 0;
+
+		return mixer_.createVoice(std::make_unique<PooledSampleSource>(std::move(source), decodePool_));
+	}
+
+	AudioBackend::SourceID SoftwareAudioBackend::createStream(std::unique_ptr<sf::InputStream> stream)
+	{
+		auto source = std::make_unique<FileSampleSource>();
+		if (!source->openFromStream(std::move(stream)))
+			return 0;
+
+		return mixer_.createVoice(std::make_unique<PooledSampleSource>(std::move(source), decodePool_));
+	}
+
+	AudioBackend::SourceID SoftwareAudioBackend::createLayeredStream(const std::vector<std::string>& filepaths)
+	{
+		auto stems = std::make_unique<StemSampleSource>();
+		if (!stems->openFromFiles(filepaths))
+			return 0;
+
+		// The stems are decoded ahead together as a single stream, the layers' gains are applied as it's read
+		auto source = std::make_unique<LayeredSampleSource>(std::make_unique<PooledSampleSource>(std::move(stems), decodePool_), filepaths.size());
+		LayeredSampleSource* layered = source.get();
+		const SourceID VOICE = mixer_.createVoice(std::move(source));
+		if (VOICE)
+			layeredSources_[VOICE] = layered;
+		return VOICE;
+	}
+
+	bool SoftwareAudioBackend::supportsLayeredStreams() const
+	{
+		return true;
+	}
+
+	void SoftwareAudioBackend::destroySource(SourceID source)
+	{
+		layeredSources_.erase(source);
+		mixer_.destroyVoice(source);
+	}
+
+	void SoftwareAudioBackend::play(SourceID source)
+	{
+		mixer_.play(source);
+	}
+
+	void SoftwareAudioBackend::playAt(SourceID source, sf::Time clockTime)
+	{
+		mixer_.playAt(source, clockTime);
+	}
+
+	bool SoftwareAudioBackend::chain(SourceID source, SourceID next)
+	{
+		mixer_.setVoiceNext(source, next);
+		return true;
+	}
+
+	void SoftwareAudioBackend::pause(SourceID source)
+	{
+		mixer_.pause(source);
+	}
+
+	void SoftwareAudioBackend::stop(SourceID source)
+	{
+		mixer_.stop(source);
+	}
+
+	void SoftwareAudioBackend::setLoop(SourceID source, bool flag)
+	{
+		mixer_.setLoop(source, flag);
+	}
+
+	void SoftwareAudioBackend::setVolume(SourceID source, float volume)
+	{
+		mixer_.setVolume(source, volume);
+	}
+
+	void SoftwareAudioBackend::fade(SourceID source, float gain, sf::Time duration, bool stop)
+	{
+		mixer_.fade(source, gain, duration, stop);
+	}
+
+	void SoftwareAudioBackend::setLayerGain(SourceID source, std::size_t layer, float gain, sf::Time duration)
+	{
+		auto found = layeredSources_.find(source);
+		if (found != layeredSources_.end())
+			found->second->setLayerGain(layer, gain, static_cast<std::size_t>(duration.asSeconds() * found->second->getSampleRate()));
+	}
+
+	void SoftwareAudioBackend::setProperties(SourceID source, const AudioProperties& properties)
+	{
+		mixer_.setProperties(source, properties);
+	}
+
+	void SoftwareAudioBackend::setPosition(SourceID source, const sf::Vector3f& position)
+	{
+		mixer_.setPosition(source, position);
+	}
+
+	void SoftwareAudioBackend::setPlayingOffset(SourceID source, sf::Time offset)
+	{
+		mixer_.setPlayingOffset(source, offset);
+	}
+
+	sf::Time SoftwareAudioBackend::getPlayingOffset(SourceID source) const
+	{
+		return mixer_.getPlayingOffset(source);
+	}
+
+	sf::SoundSource::Status SoftwareAudioBackend::getStatus(SourceID source) const
+	{
+		return mixer_.getStatus(source);
+	}
+
+	void SoftwareAudioBackend::setListenerPosition(const sf::Vector3f& position)
+	{
+		mixer_.setListenerPosition(position);
+	}
+
+	sf::Vector3f SoftwareAudioBackend::getListenerPosition() const
+	{
+		return mixer_.getListenerPosition();
+	}
+
+	std::size_t SoftwareAudioBackend::getMaxSources() const
+	{
+		return std::numeric_limits<std::size_t>::max();
+	}
+
+	sf::Time SoftwareAudioBackend::getAudioClock() const
+	{
+		return mixer_.getClock();
+	}
+
+	AudioBackend::SubmixID SoftwareAudioBackend::createSubmix(SubmixID parent)
+	{
+		return mixer_.createSubmix(parent);
+	}
+
+	void SoftwareAudioBackend::destroySubmix(SubmixID submix)
+	{
+		mixer_.destroySubmix(submix);
+	}
+
+	void SoftwareAudioBackend::setSubmixParent(SubmixID submix, SubmixID parent)
+	{
+		mixer_.setSubmixParent(submix, parent);
+	}
+
+	void SoftwareAudioBackend::setSubmixEffects(SubmixID submix, EffectChain* effects)
+	{
+		mixer_.setSubmixEffects(submix, effects);
+	}
+
+	void SoftwareAudioBackend::setSourceSubmix(SourceID source, SubmixID submix)
+	{
+		mixer_.setVoiceSubmix(source, submix);
+	}
+
+	void SoftwareAudioBackend::setSourceEffects(SourceID source, EffectChain* effects)
+	{
+		mixer_.setVoiceEffects(source, effects);
+	}
+
+	void SoftwareAudioBackend::setLowPass(SourceID source, float cutoff)
+	{
+		mixer_.setVoiceLowPass(source, cutoff);
+	}
+
+	void SoftwareAudioBackend::setStreamBuffering(SourceID source, sf::Time bufferTime, sf::Time chunkTime)
+	{
+		mixer_.setStreamBuffering(source, bufferTime, chunkTime);
+	}
+
+	bool SoftwareAudioBackend::getStreamState(SourceID source, float& fill, std::size_t& underruns) const
+	{
+		return mixer_.getStreamState(source, fill, underruns);
+	}
+
+	void SoftwareAudioBackend::setMarkers(SourceID source, const std::vector<sf::Time>& markers)
+	{
+		mixer_.setVoiceMarkers(source, markers);
+	}
+
+	bool SoftwareAudioBackend::pollMarker(SourceID& source, std::size_t& index, sf::Time& clockTime)
+	{
+		return mixer_.pollMarker(source, index, clockTime);
+	}
+
+	sf::Time SoftwareAudioBackend::getRenderTime() const
+	{
+		return mixer_.getLastRenderTime();
+	}
+
+	SoftwareMixer& SoftwareAudioBackend::getMixer()
+	{
+		return mixer_;
+	}
+
+	const SoftwareMixer& SoftwareAudioBackend::getMixer() const
+	{
+		return mixer_;
+	}
+
+	SoftwareAudioBackend::SoftwareAudioBackend(unsigned int sampleRate, std::size_t blockFrames, std::size_t decodeThreads, bool streamToDevice)
+		: AudioBackend()
+		, decodePool_(decodeThreads)
+		, mixer_(sampleRate)
+		, stream_(nullptr)
+		, layeredSources_()
+	{
+		if (streamToDevice) {
+			stream_ = std::make_unique<MixerStream>(mixer_, blockFrames);
+			stream_->play();
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,698 @@
+#include <algorithm>
+#include <cmath>
+
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/System/Clock.hpp>
+
+#include "../../include/Audio/EffectChain.h"
+#include "../../include/Audio/MixKernels.h"
+#include "../../include/Audio/SoftwareMixer.h"
+
+namespace ae
+{
+	SoftwareMixer::SoftwareMixer(unsigned int sampleRate)
+		: SAMPLE_RATE(sampleRate)
+		, voices_()
+		, listenerPosition_(0.f, 0.f, 0.f)
+		, nextId_(1)
+		, sourceBlock_()
+		, resampledBlock_()
+		, voiceBlock_()
+		, submixes_()
+		, nextSubmixId_(1)
+		, clockFrames_(0)
+		, lastRenderTime_(0)
+		, lastVoiceCount_(0)
+		, markerEvents_(1024)
+		, mutex_()
+	{
+	}
+
+	SoftwareMixer::VoiceID SoftwareMixer::createVoice(const sf::SoundBuffer& buffer)
+	{
+		const unsigned int CHANNEL_COUNT = buffer.getChannelCount();
+		Voice voice(0, CHANNEL_COUNT > 0 ? buffer.getSampleCount() / CHANNEL_COUNT : 0, CHANNEL_COUNT, buffer.getSampleRate());
+		voice.buffer = &buffer;
+
+		return addVoice(std::move(voice));
+	}
+
+	SoftwareMixer::VoiceID SoftwareMixer::createVoice(std::unique_ptr<SampleSource> source)
+	{
+		Voice voice(0, source->getFrameCount(), source->getChannelCount(), source->getSampleRate());
+		voice.source = std::move(source);
+
+		return addVoice(std::move(voice));
+	}
+
+	void SoftwareMixer::destroyVoice(VoiceID id)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		voices_.erase(std::remove_if(voices_.begin(), voices_.end(), [id](const Voice& voice) {
+			return voice.id == id;
+		}), voices_.end());
+	}
+
+	void SoftwareMixer::play(VoiceID id)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Voice* voice = findVoice(id);
+		if (voice) {
+			voice->status = sf::SoundSource::Status::Playing;
+			voice->startFrame = 0;
+		}
+	}
+
+	void SoftwareMixer::playAt(VoiceID id, sf::Time clockTime)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Voice* voice = findVoice(id);
+		if (voice) {
+			voice->status = sf::SoundSource::Status::Playing;
+			voice->startFrame = static_cast<sf::Uint64>(std::max<sf::Int64>(clockTime.asMicroseconds(), 0) * SAMPLE_RATE / 1000000);
+		}
+	}
+
+	void SoftwareMixer::setVoiceNext(VoiceID id, VoiceID next)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Voice* voice = findVoice(id);
+		if (voice)
+			voice->next = next;
+	}
+
+	void SoftwareMixer::pause(VoiceID id)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Voice* voice = findVoice(id);
+		if (voice && voice->status == sf::SoundSource::Status::Playing)
+			voice->status = sf::SoundSource::Status::Paused;
+	}
+
+	void SoftwareMixer::stop(VoiceID id)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Voice* voice = findVoice(id);
+		if (voice) {
+			voice->status = sf::SoundSource::Status::Stopped;
+			voice->cursor = 0.0;
+			voice->rendered = false;
+			voice->next = 0;
+		}
+	}
+
+	void SoftwareMixer::setLoop(VoiceID id, bool flag)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Voice* voice = findVoice(id);
+		if (voice)
+			voice->loop = flag;
+	}
+
+	void SoftwareMixer::setVolume(VoiceID id, float volume)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Voice* voice = findVoice(id);
+		if (voice)
+			voice->volume = volume;
+	}
+
+	void SoftwareMixer::fade(VoiceID id, float gain, sf::Time duration, bool stop)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Voice* voice = findVoice(id);
+		if (!voice)
+			return;
+
+		voice->fadeTarget = std::max(0.f, std::min(gain, 1.f));
+		voice->fadeFrames = static_cast<sf::Uint64>(std::max(duration.asSeconds(), 0.f) * SAMPLE_RATE);
+		voice->stopAfterFade = stop;
+		if (voice->fadeFrames == 0) {
+			voice->fadeGain = voice->fadeTarget;
+			if (stop) {
+				voice->status = sf::SoundSource::Status::Stopped;
+				voice->cursor = 0.0;
+				voice->rendered = false;
+			}
+		}
+	}
+
+	void SoftwareMixer::setProperties(VoiceID id, const AudioProperties& properties)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Voice* voice = findVoice(id);
+		if (voice) {
+			voice->pitch = properties.getPitch();
+			voice->attenuation = properties.getAttenuation();
+			voice->minDistance = properties.getMinDistance3D();
+			voice->relativeToListener = properties.isRelativeToListener();
+		}
+	}
+
+	void SoftwareMixer::setPosition(VoiceID id, const sf::Vector3f& position)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Voice* voice = findVoice(id);
+		if (voice)
+			voice->position = position;
+	}
+
+	void SoftwareMixer::setPlayingOffset(VoiceID id, sf::Time offset)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Voice* voice = findVoice(id);
+		if (voice) {
+			voice->cursor = std::min(static_cast<double>(offset.asSeconds()) * voice->sampleRate, static_cast<double>(voice->frameCount));
+
+			// A stream that isn't playing is positioned straight away, its source seeks and refills before the voice is played
+			if (voice->source && voice->status != sf::SoundSource::Status::Playing) {
+				voice->windowStart = static_cast<sf::Uint64>(voice->cursor);
+				voice->window.clear();
+				voice->source->seek(voice->windowStart);
+			}
+		}
+	}
+
+	sf::Time SoftwareMixer::getPlayingOffset(VoiceID id) const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		const Voice* voice = findVoice(id);
+		return voice && voice->sampleRate > 0 ? sf::seconds(static_cast<float>(voice->cursor / voice->sampleRate)) : sf::Time::Zero;
+	}
+
+	sf::SoundSource::Status SoftwareMixer::getStatus(VoiceID id) const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		const Voice* voice = findVoice(id);
+		return voice ? voice->status : sf::SoundSource::Status::Stopped;
+	}
+
+	bool SoftwareMixer::setStreamBuffering(VoiceID id, sf::Time bufferTime, sf::Time chunkTime)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Voice* voice = findVoice(id);
+		if (!voice || !voice->source)
+			return false;
+
+		// The durations are converted with the source's own sample rate, the frames decoded ahead are resampled as they're mixed
+		const std::size_t BUFFER_FRAMES = static_cast<std::size_t>(std::max<sf::Int64>(bufferTime.asMicroseconds(), 0) * voice->sampleRate / 1000000);
+		const std::size_t CHUNK_FRAMES = static_cast<std::size_t>(std::max<sf::Int64>(chunkTime.asMicroseconds(), 0) * voice->sampleRate / 1000000);
+		return voice->source->setBuffering(BUFFER_FRAMES, CHUNK_FRAMES);
+	}
+
+	bool SoftwareMixer::getStreamState(VoiceID id, float& fill, std::size_t& underruns) const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		const Voice* voice = findVoice(id);
+		return voice && voice->source && voice->source->getBufferState(fill, underruns);
+	}
+
+	void SoftwareMixer::setVoiceMarkers(VoiceID id, const std::vector<sf::Time>& markers)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Voice* voice = findVoice(id);
+		if (!voice)
+			return;
+
+		voice->markers.resize(markers.size());
+		for (std::size_t i = 0; i < markers.size(); ++i)
+			voice->markers[i] = static_cast<sf::Uint64>(std::max<sf::Int64>(markers[i].asMicroseconds(), 0) * voice->sampleRate / 1000000);
+	}
+
+	bool SoftwareMixer::pollMarker(VoiceID& id, std::size_t& index, sf::Time& clockTime)
+	{
+		MarkerEvent event;
+		if (!markerEvents_.pop(event))
+			return false;
+
+		id = event.voice;
+		index = event.index;
+		clockTime = sf::microseconds(static_cast<sf::Int64>(event.clockFrame * 1000000 / SAMPLE_RATE));
+		return true;
+	}
+
+	void SoftwareMixer::setListenerPosition(const sf::Vector3f& position)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		listenerPosition_ = position;
+	}
+
+	sf::Vector3f SoftwareMixer::getListenerPosition() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return listenerPosition_;
+	}
+
+	SoftwareMixer::SubmixID SoftwareMixer::createSubmix(SubmixID parent)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		const SubmixID ID = nextSubmixId_++;
+		if (nextSubmixId_ == 0)
+			nextSubmixId_ = 1;
+		submixes_.push_back(Submix{ ID, findSubmix(parent) ? parent : 0, nullptr, 0, std::vector<float>() });
+		sortSubmixes();
+
+		return ID;
+	}
+
+	void SoftwareMixer::destroySubmix(SubmixID id)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Submix* submix = findSubmix(id);
+		if (!submix)
+			return;
+
+		const SubmixID PARENT = submix->parent;
+		for (auto& voice : voices_) {
+			if (voice.submix == id)
+				voice.submix = PARENT;
+		}
+		for (auto& other : submixes_) {
+			if (other.parent == id)
+				other.parent = PARENT;
+		}
+		submixes_.erase(submixes_.begin() + (submix - submixes_.data()));
+		sortSubmixes();
+	}
+
+	void SoftwareMixer::setSubmixParent(SubmixID id, SubmixID parent)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Submix* submix = findSubmix(id);
+		if (!submix)
+			return;
+
+		// A submix can't be rendered into one of its own children
+		for (Submix* ancestor = findSubmix(parent); ancestor; ancestor = findSubmix(ancestor->parent)) {
+			if (ancestor->id == id)
+				return;
+		}
+		submix->parent = findSubmix(parent) ? parent : 0;
+		sortSubmixes();
+	}
+
+	void SoftwareMixer::setSubmixEffects(SubmixID id, EffectChain* effects)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Submix* submix = findSubmix(id);
+		if (submix)
+			submix->effects = effects;
+	}
+
+	void SoftwareMixer::setVoiceSubmix(VoiceID id, SubmixID submix)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Voice* voice = findVoice(id);
+		if (voice)
+			voice->submix = findSubmix(submix) ? submix : 0;
+	}
+
+	void SoftwareMixer::setVoiceEffects(VoiceID id, EffectChain* effects)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Voice* voice = findVoice(id);
+		if (voice)
+			voice->effects = effects;
+	}
+
+	void SoftwareMixer::setVoiceLowPass(VoiceID id, float cutoff)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Voice* voice = findVoice(id);
+		if (voice)
+			voice->lowPassCutoff = std::max(cutoff, 0.f);
+	}
+
+	void SoftwareMixer::render(float* output, std::size_t frameCount)
+	{
+		sf::Clock clock;
+		std::fill(output, output + frameCount * 2, 0.f);
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		for (auto& submix : submixes_)
+			submix.frames.assign(frameCount * 2, 0.f);
+
+		const sf::Uint64 BLOCK_START = clockFrames_;
+		startChainedVoices(BLOCK_START, frameCount);
+		std::size_t mixedVoices = 0;
+		for (auto& voice : voices_) {
+			if (voice.status != sf::SoundSource::Status::Playing || voice.startFrame >= BLOCK_START + frameCount)
+				continue;
+
+			// A scheduled voice starts on its exact frame inside the block
+			const std::size_t DELAY = voice.startFrame > BLOCK_START ? static_cast<std::size_t>(voice.startFrame - BLOCK_START) : 0;
+			Submix* submix = voice.submix ? findSubmix(voice.submix) : nullptr;
+			float* target = submix ? submix->frames.data() : output;
+			if (voice.effects || voice.lowPassCutoff > 0.f) {
+				voiceBlock_.assign(frameCount * 2, 0.f);
+				mixVoice(voice, voiceBlock_.data() + DELAY * 2, frameCount - DELAY, BLOCK_START + DELAY);
+				if (voice.lowPassCutoff > 0.f)
+					filterVoice(voice, voiceBlock_.data(), frameCount);
+				if (voice.effects)
+					voice.effects->process(voiceBlock_.data(), frameCount, SAMPLE_RATE);
+				MixKernels::mixStereo(voiceBlock_.data(), target, frameCount, 1.f, 1.f, 1.f, 1.f);
+			}
+			else
+				mixVoice(voice, target + DELAY * 2, frameCount - DELAY, BLOCK_START + DELAY);
+			++mixedVoices;
+		}
+
+		// The children come first so that they're added to their parent before it's processed
+		for (auto& submix : submixes_) {
+			if (submix.effects)
+				submix.effects->process(submix.frames.data(), frameCount, SAMPLE_RATE);
+
+			Submix* parent = submix.parent ? findSubmix(submix.parent) : nullptr;
+			MixKernels::mixStereo(submix.frames.data(), parent ? parent->frames.data() : output, frameCount, 1.f, 1.f, 1.f, 1.f);
+		}
+
+		clockFrames_ = BLOCK_START + frameCount;
+		lastVoiceCount_ = mixedVoices;
+		lastRenderTime_ = clock.getElapsedTime().asMicroseconds();
+	}
+
+	unsigned int SoftwareMixer::getSampleRate() const
+	{
+		return SAMPLE_RATE;
+	}
+
+	sf::Time SoftwareMixer::getClock() const
+	{
+		return sf::microseconds(static_cast<sf::Int64>(clockFrames_ * 1000000 / SAMPLE_RATE));
+	}
+
+	std::size_t SoftwareMixer::getVoiceCount() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return voices_.size();
+	}
+
+	sf::Time SoftwareMixer::getLastRenderTime() const
+	{
+		return sf::microseconds(lastRenderTime_);
+	}
+
+	std::size_t SoftwareMixer::getLastRenderedVoiceCount() const
+	{
+		return lastVoiceCount_;
+	}
+
+	SoftwareMixer::VoiceID SoftwareMixer::addVoice(Voice&& voice)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		voice.id = nextId_++;
+		if (nextId_ == 0)
+			nextId_ = 1;
+		voices_.push_back(std::move(voice));
+
+		return voices_.back().id;
+	}
+
+	SoftwareMixer::Voice* SoftwareMixer::findVoice(VoiceID id)
+	{
+		auto found = std::find_if(voices_.begin(), voices_.end(), [id](const Voice& voice) {
+			return voice.id == id;
+		});
+		return found != voices_.end() ? &*found : nullptr;
+	}
+
+	const SoftwareMixer::Voice* SoftwareMixer::findVoice(VoiceID id) const
+	{
+		auto found = std::find_if(voices_.cbegin(), voices_.cend(), [id](const Voice& voice) {
+			return voice.id == id;
+		});
+		return found != voices_.cend() ? &*found : nullptr;
+	}
+
+	SoftwareMixer::Submix* SoftwareMixer::findSubmix(SubmixID id)
+	{
+		auto found = std::find_if(submixes_.begin(), submixes_.end(), [id](const Submix& submix) {
+			return submix.id == id;
+		});
+		return found != submixes_.end() ? &*found : nullptr;
+	}
+
+	void SoftwareMixer::sortSubmixes()
+	{
+		for (auto& submix : submixes_) {
+			submix.depth = 0;
+			for (Submix* parent = findSubmix(submix.parent); parent; parent = findSubmix(parent->parent))
+				++submix.depth;
+		}
+
+		std::stable_sort(submixes_.begin(), submixes_.end(), [](const Submix& s1, const Submix& s2) {
+			return s1.depth > s2.depth;
+		});
+	}
+
+	void SoftwareMixer::computeGains(const Voice& voice, float& gainLeft, float& gainRight) const
+	{
+		const float VOLUME = voice.volume / 100.f;
+
+		// Stereo voices aren't spatialized (same as OpenAL)
+		if (voice.channelCount != 1) {
+			gainLeft = gainRight = VOLUME;
+			return;
+		}
+
+		const sf::Vector3f DELTA = voice.relativeToListener ? voice.position : voice.position - listenerPosition_;
+		const float DISTANCE = std::sqrt(DELTA.x * DELTA.x + DELTA.y * DELTA.y + DELTA.z * DELTA.z);
+
+		// Inverse distance clamped model
+		const float CLAMPED_DISTANCE = std::max(DISTANCE, voice.minDistance);
+		const float ATTENUATION = voice.minDistance / (voice.minDistance + voice.attenuation * (CLAMPED_DISTANCE - voice.minDistance));
+
+		// Equal-power panning from the horizontal direction of the source
+		const float PAN = DISTANCE > 0.f ? std::max(-1.f, std::min(DELTA.x / DISTANCE, 1.f)) : 0.f;
+		const float ANGLE = (PAN + 1.f) * 0.785398163f;
+
+		gainLeft = VOLUME * ATTENUATION * std::cos(ANGLE);
+		gainRight = VOLUME * ATTENUATION * std::sin(ANGLE);
+	}
+
+	const sf::Int16* SoftwareMixer::fetchFrames(Voice& voice, sf::Uint64 firstFrame, std::size_t frameCount)
+	{
+		if (voice.buffer)
+			return voice.buffer->getSamples() + firstFrame * voice.channelCount;
+
+		// Minimum amount of frames read from a sample source at once
+		const std::size_t READ_AHEAD_FRAMES = 4096;
+
+		const unsigned int CHANNEL_COUNT = voice.channelCount;
+		const sf::Uint64 WINDOW_END = voice.windowStart + voice.window.size() / CHANNEL_COUNT;
+		if (firstFrame < voice.windowStart || firstFrame > WINDOW_END) {
+			// The frames aren't contiguous with the window (i.e. the voice looped or has been seeked)
+			voice.source->seek(firstFrame);
+			voice.window.clear();
+			voice.windowStart = firstFrame;
+		}
+		else {
+			// Drop the frames that have already been mixed
+			voice.window.erase(voice.window.begin(), voice.window.begin() + static_cast<std::size_t>(firstFrame - voice.windowStart) * CHANNEL_COUNT);
+			voice.windowStart = firstFrame;
+		}
+
+		const std::size_t AVAILABLE_FRAMES = voice.window.size() / CHANNEL_COUNT;
+		if (AVAILABLE_FRAMES < frameCount) {
+			const std::size_t READ_FRAMES = std::max(frameCount - AVAILABLE_FRAMES, READ_AHEAD_FRAMES);
+			voice.window.resize((AVAILABLE_FRAMES + READ_FRAMES) * CHANNEL_COUNT);
+			const std::size_t READ = voice.source->read(voice.window.data() + AVAILABLE_FRAMES * CHANNEL_COUNT, READ_FRAMES);
+
+			// Pad the missing frames with silence if the source ended earlier than announced
+			voice.window.resize(std::max(AVAILABLE_FRAMES + READ, frameCount) * CHANNEL_COUNT, 0);
+		}
+
+		return voice.window.data();
+	}
+
+	void SoftwareMixer::startChainedVoices(sf::Uint64 blockStart, std::size_t frameCount)
+	{
+		for (auto& voice : voices_) {
+			if (!voice.next || voice.loop || voice.status != sf::SoundSource::Status::Playing || voice.startFrame >= blockStart + frameCount)
+				continue;
+
+			// The end is found as in mixVoice, the next voice's first frame directly follows the voice's last one
+			const double STEP = static_cast<double>(voice.pitch) * voice.sampleRate / SAMPLE_RATE;
+			if (STEP <= 0.0)
+				continue;
+			const double REMAINING = std::max(std::ceil((voice.frameCount - voice.cursor) / STEP), 0.0);
+			const sf::Uint64 END = std::max(voice.startFrame, blockStart) + static_cast<sf::Uint64>(REMAINING);
+			if (END > blockStart + frameCount)
+				continue;
+
+			Voice* next = findVoice(voice.next);
+			if (next) {
+				next->status = sf::SoundSource::Status::Playing;
+				next->startFrame = END;
+			}
+			voice.next = 0;
+		}
+	}
+
+	void SoftwareMixer::mixVoice(Voice& voice, float* output, std::size_t frameCount, sf::Uint64 clockFrame)
+	{
+		const unsigned int CHANNEL_COUNT = voice.channelCount;
+		const std::size_t SOURCE_FRAMES = static_cast<std::size_t>(voice.frameCount);
+		const double STEP = static_cast<double>(voice.pitch) * voice.sampleRate / SAMPLE_RATE;
+		if (SOURCE_FRAMES == 0 || STEP <= 0.0 || CHANNEL_COUNT == 0 || CHANNEL_COUNT > 2) {
+			voice.status = sf::SoundSource::Status::Stopped;
+			return;
+		}
+
+		// Output only the frames that are still inside the voice unless it loops
+		std::size_t outputFrames = frameCount;
+		bool finished = false;
+		bool fadeEnded = false;
+		if (!voice.loop) {
+			const double REMAINING = std::ceil((SOURCE_FRAMES - voice.cursor) / STEP);
+			if (REMAINING <= static_cast<double>(frameCount)) {
+				outputFrames = static_cast<std::size_t>(std::max(REMAINING, 0.0));
+				finished = true;
+			}
+		}
+
+		if (outputFrames > 0) {
+			// Convert the source frames needed by the interpolation, wrapping around for loops and padding with silence past the end
+			const std::size_t FIRST_FRAME = static_cast<std::size_t>(voice.cursor);
+			const float POSITION = static_cast<float>(voice.cursor - FIRST_FRAME);
+			const std::size_t NEEDED_FRAMES = static_cast<std::size_t>(POSITION + (outputFrames - 1) * STEP) + 2;
+			if (sourceBlock_.size() < NEEDED_FRAMES * CHANNEL_COUNT)
+				sourceBlock_.resize(NEEDED_FRAMES * CHANNEL_COUNT);
+			if (resampledBlock_.size() < outputFrames * CHANNEL_COUNT)
+				resampledBlock_.resize(outputFrames * CHANNEL_COUNT);
+
+			std::size_t converted = 0;
+			std::size_t sourceFrame = FIRST_FRAME % SOURCE_FRAMES;
+			while (converted < NEEDED_FRAMES) {
+				const std::size_t RUN = std::min(NEEDED_FRAMES - converted, SOURCE_FRAMES - sourceFrame);
+				MixKernels::convertToFloat(fetchFrames(voice, sourceFrame, RUN), sourceBlock_.data() + converted * CHANNEL_COUNT, RUN * CHANNEL_COUNT);
+				converted += RUN;
+				sourceFrame = 0;
+
+				if (!voice.loop) {
+					std::fill(sourceBlock_.begin() + converted * CHANNEL_COUNT, sourceBlock_.begin() + NEEDED_FRAMES * CHANNEL_COUNT, 0.f);
+					break;
+				}
+			}
+
+			MixKernels::resample(sourceBlock_.data(), CHANNEL_COUNT, POSITION, static_cast<float>(STEP), resampledBlock_.data(), outputFrames);
+
+			// Advance the fade over the frames mixed, the gains below ramp it sample by sample
+			const float FADE_START = voice.fadeGain;
+			std::size_t rampFrames = outputFrames;
+			if (voice.fadeFrames > 0) {
+				const sf::Uint64 FADED = std::min<sf::Uint64>(voice.fadeFrames, outputFrames);
+				voice.fadeGain += (voice.fadeTarget - voice.fadeGain) * FADED / voice.fadeFrames;
+				voice.fadeFrames -= FADED;
+				fadeEnded = voice.fadeFrames == 0 && voice.stopAfterFade;
+				rampFrames = static_cast<std::size_t>(FADED);
+			}
+
+			// Ramp the gains from the previous block to avoid clicks when the voice moves or changes volume
+			float gainLeft = 0.f, gainRight = 0.f;
+			computeGains(voice, gainLeft, gainRight);
+			const float START_LEFT = voice.rendered ? voice.gainLeft : gainLeft * FADE_START;
+			const float START_RIGHT = voice.rendered ? voice.gainRight : gainRight * FADE_START;
+			gainLeft *= voice.fadeGain;
+			gainRight *= voice.fadeGain;
+			if (CHANNEL_COUNT == 1)
+				MixKernels::mixMono(resampledBlock_.data(), output, rampFrames, START_LEFT, START_RIGHT, gainLeft, gainRight);
+			else
+				MixKernels::mixStereo(resampledBlock_.data(), output, rampFrames, START_LEFT, START_RIGHT, gainLeft, gainRight);
+
+			// A fade ending inside the block holds its target for the rest of it, a fade-out that stops the voice cuts it there
+			if (fadeEnded)
+				outputFrames = rampFrames;
+			else if (rampFrames < outputFrames) {
+				const std::size_t HELD_FRAMES = outputFrames - rampFrames;
+				if (CHANNEL_COUNT == 1)
+					MixKernels::mixMono(resampledBlock_.data() + rampFrames, output + rampFrames * 2, HELD_FRAMES, gainLeft, gainRight, gainLeft, gainRight);
+				else
+					MixKernels::mixStereo(resampledBlock_.data() + rampFrames * 2, output + rampFrames * 2, HELD_FRAMES, gainLeft, gainRight, gainLeft, gainRight);
+			}
+			voice.gainLeft = gainLeft;
+			voice.gainRight = gainRight;
+			voice.rendered = true;
+
+			if (!voice.markers.empty())
+				pushMarkers(voice, STEP, outputFrames, clockFrame);
+			voice.cursor = std::fmod(voice.cursor + outputFrames * STEP, static_cast<double>(SOURCE_FRAMES));
+		}
+
+		// A voice that reaches its end (or the end of its fade-out) is stopped and rewound, like an sf::Sound
+		if (finished || fadeEnded) {
+			voice.status = sf::SoundSource::Status::Stopped;
+			voice.cursor = 0.0;
+			voice.rendered = false;
+		}
+	}
+
+	void SoftwareMixer::pushMarkers(const Voice& voice, double step, std::size_t outputFrames, sf::Uint64 clockFrame)
+	{
+		// Each pass looks for the markers of one lap of the voice, a voice on loop may wrap around its end inside the block
+		const double END = voice.cursor + outputFrames * step;
+		const double SOURCE_FRAMES = static_cast<double>(voice.frameCount);
+		for (double lap = 0.0; lap < END; lap += SOURCE_FRAMES) {
+			const double FIRST = std::max(voice.cursor - lap, 0.0);
+			auto marker = std::lower_bound(voice.markers.cbegin(), voice.markers.cend(), static_cast<sf::Uint64>(std::ceil(FIRST)));
+			for (; marker != voice.markers.cend() && *marker < voice.frameCount && lap + *marker < END; ++marker) {
+				// The marker is heard on the first output frame whose source position reaches it
+				const double DELAY = std::ceil((lap + *marker - voice.cursor) / step);
+				markerEvents_.push(MarkerEvent{ voice.id, static_cast<std::size_t>(marker - voice.markers.cbegin()), clockFrame + static_cast<sf::Uint64>(DELAY) });
+			}
+
+			if (!voice.loop)
+				break;
+		}
+	}
+
+	void SoftwareMixer::filterVoice(Voice& voice, float* frames, std::size_t frameCount) const
+	{
+		// One-pole low-pass, gentle enough to sound like a wall absorbing the high frequencies
+		const float COEFFICIENT = 1.f - std::exp(-2.f * 3.14159265f * std::min(voice.lowPassCutoff, SAMPLE_RATE * 0.49f) / SAMPLE_RATE);
+		float left = voice.lowPassState[0], right = voice.lowPassState[1];
+		for (std::size_t i = 0; i < frameCount; ++i) {
+			left += COEFFICIENT * (frames[i * 2] - left);
+			right += COEFFICIENT * (frames[i * 2 + 1] - right);
+			frames[i * 2] = left;
+			frames[i * 2 + 1] = right;
+		}
+		voice.lowPassState[0] = left;
+		voice.lowPassState[1] = right;
+	}
+
+	SoftwareMixer::Voice::Voice(VoiceID id, sf::Uint64 frameCount, unsigned int channelCount, unsigned int sampleRate)
+		: buffer(nullptr)
+		, source(nullptr)
+		, window()
+		, windowStart(0)
+		, frameCount(frameCount)
+		, channelCount(channelCount)
+		, sampleRate(sampleRate)
+		, id(id)
+		, position(0.f, 0.f, 0.f)
+		, volume(100.f)
+		, fadeGain(1.f)
+		, fadeTarget(1.f)
+		, fadeFrames(0)
+		, stopAfterFade(false)
+		, pitch(1.f)
+		, attenuation(1.f)
+		, minDistance(1.f)
+		, relativeToListener(false)
+		, loop(false)
+		, status(sf::SoundSource::Status::Stopped)
+		, startFrame(0)
+		, next(0)
+		, cursor(0.0)
+		, gainLeft(0.f)
+		, gainRight(0.f)
+		, rendered(false)
+		, submix(0)
+		, effects(nullptr)
+		, lowPassCutoff(0.f)
+		, lowPassState{ 0.f, 0.f }
+		, markers()
+	{
+	}
+}
\ No newline at end of file
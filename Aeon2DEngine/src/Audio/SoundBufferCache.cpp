@@ -0,0 +1,134 @@
+#include <algorithm>
+#include <cstring>
+
+#ifdef _DEBUG
+#include "../../include/Utils/DebugLogger.h"
+#endif
+#include "../../include/Audio/SoundBufferCache.h"
+
+namespace ae
+{
+	namespace
+	{
+		// Normalizes the separators of a filepath so that both spellings of a path share their buffer
+		std::string normalizePath(const std::string& filepath)
+		{
+			std::string path(filepath);
+			std::replace(path.begin(), path.end(), '\\', '/');
+			while (path.compare(0, 2, "./") == 0)
+				path.erase(0, 2);
+			return path;
+		}
+
+		// Hashes the format and the samples of a buffer (64-bit FNV-1a)
+		sf::Uint64 hashContent(const sf::SoundBuffer& buffer)
+		{
+			sf::Uint64 hash = 14695981039346656037ULL;
+			auto mix = [&hash](const void* data, std::size_t size) {
+				const unsigned char* bytes = static_cast<const unsigned char*>(data);
+				for (std::size_t i = 0; i < size; ++i)
+					hash = (hash ^ bytes[i]) * 1099511628211ULL;
+			};
+
+			const unsigned int CHANNEL_COUNT = buffer.getChannelCount();
+			const unsigned int SAMPLE_RATE = buffer.getSampleRate();
+			mix(&CHANNEL_COUNT, sizeof(CHANNEL_COUNT));
+			mix(&SAMPLE_RATE, sizeof(SAMPLE_RATE));
+			mix(buffer.getSamples(), static_cast<std::size_t>(buffer.getSampleCount()) * sizeof(sf::Int16));
+			return hash;
+		}
+
+		// Checks if two buffers hold the same samples in the same format
+		bool isSameContent(const sf::SoundBuffer& first, const sf::SoundBuffer& second)
+		{
+			return first.getChannelCount() == second.getChannelCount() && first.getSampleRate() == second.getSampleRate() &&
+			       first.getSampleCount() == second.getSampleCount() &&
+			       std::memcmp(first.getSamples(), second.getSamples(), static_cast<std::size_t>(first.getSampleCount()) * sizeof(sf::Int16)) == 0;
+		}
+	}
+
+	SoundBufferCache::SoundBufferCache()
+		: paths_()
+		, contents_()
+		, mutex_()
+	{
+	}
+
+	SoundBufferCache& SoundBufferCache::getGlobal()
+	{
+		static SoundBufferCache cache;
+		return cache;
+	}
+
+	std::shared_ptr<const sf::SoundBuffer> SoundBufferCache::acquire(const std::string& filepath)
+	{
+		const std::string PATH = normalizePath(filepath);
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			auto found = paths_.find(PATH);
+			if (found != paths_.end()) {
+				std::shared_ptr<const sf::SoundBuffer> buffer = found->second.lock();
+				if (buffer)
+					return buffer;
+			}
+		}
+
+		// Decode the file without holding the lock, another thread may load the same file in the meantime
+		auto loaded = std::make_shared<sf::SoundBuffer>();
+		if (!loaded->loadFromFile(filepath)) {
+#ifdef _DEBUG
+			DebugLogger::cacheMessage("ae::SoundBufferCache::acquire - Failed to load " + filepath);
+#endif
+			return nullptr;
+		}
+		const sf::Uint64 HASH = hashContent(*loaded);
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		prune();
+
+		// Share the buffer holding the same samples if there's one (i.e. the same file under another path)
+		std::shared_ptr<const sf::SoundBuffer> buffer;
+		auto range = contents_.equal_range(HASH);
+		for (auto it = range.first; it != range.second && !buffer; ++it) {
+			std::shared_ptr<const sf::SoundBuffer> candidate = it->second.lock();
+			if (candidate && isSameContent(*candidate, *loaded))
+				buffer = candidate;
+		}
+		if (!buffer) {
+			buffer = loaded;
+			contents_.insert(std::make_pair(HASH, buffer));
+		}
+
+		paths_[PATH] = buffer;
+		return buffer;
+	}
+
+	std::size_t SoundBufferCache::getBufferCount() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		std::size_t count = 0;
+		for (const auto& content : contents_)
+			count += !content.second.expired();
+		return count;
+	}
+
+	std::size_t SoundBufferCache::getSize() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		std::size_t size = 0;
+		for (const auto& content : contents_) {
+			std::shared_ptr<const sf::SoundBuffer> buffer = content.second.lock();
+			if (buffer)
+				size += static_cast<std::size_t>(buffer->getSampleCount()) * sizeof(sf::Int16);
+		}
+		return size;
+	}
+
+	void SoundBufferCache::prune()
+	{
+		for (auto it = paths_.begin(); it != paths_.end();)
+			it = it->second.expired() ? paths_.erase(it) : std::next(it);
+		for (auto it = contents_.begin(); it != contents_.end();)
+			it = it->second.expired() ? contents_.erase(it) : std::next(it);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+#include <algorithm>
+
+#include "../../include/Audio/StemSampleSource.h"
+
+namespace ae
+{
+	StemSampleSource::StemSampleSource()
+		: SampleSource()
+		, stems_()
+		, stemSamples_()
+		, position_(0)
+		, frameCount_(0)
+	{
+	}
+
+	bool StemSampleSource::openFromFiles(const std::vector<std::string>& filepaths)
+	{
+		stems_.clear();
+		position_ = 0;
+		frameCount_ = 0;
+		for (const auto& filepath : filepaths) {
+			auto stem = std::make_unique<FileSampleSource>();
+			if (!stem->openFromFile(filepath) || (!stems_.empty() &&
+				(stem->getChannelCount() != getStemChannelCount() || stem->getSampleRate() != getSampleRate()))) {
+				stems_.clear();
+				frameCount_ = 0;
+				return false;
+			}
+
+			frameCount_ = std::max(frameCount_, stem->getFrameCount());
+			stems_.push_back(std::move(stem));
+		}
+
+		return !stems_.empty();
+	}
+
+	std::size_t StemSampleSource::getStemCount() const
+	{
+		return stems_.size();
+	}
+
+	unsigned int StemSampleSource::getStemChannelCount() const
+	{
+		return (stems_.empty()) ? 0 : stems_.front()->getChannelCount();
+	}
+
+	std::size_t StemSampleSource::read(sf::Int16* samples, std::size_t frameCount)
+	{
+		const unsigned int STEM_CHANNELS = getStemChannelCount();
+		const unsigned int CHANNEL_COUNT = getChannelCount();
+		const std::size_t READ = static_cast<std::size_t>(std::min<sf::Uint64>(frameCount, frameCount_ - position_));
+		if (stemSamples_.size() < READ * STEM_CHANNELS)
+			stemSamples_.resize(READ * STEM_CHANNELS);
+
+		// Every stem is read over the same frames, a stem that has ended adds silence
+		for (std::size_t stem = 0; stem < stems_.size(); ++stem) {
+			const std::size_t STEM_READ = stems_[stem]->read(stemSamples_.data(), READ);
+			std::fill(stemSamples_.begin() + STEM_READ * STEM_CHANNELS, stemSamples_.begin() + READ * STEM_CHANNELS, sf::Int16(0));
+			for (std::size_t frame = 0; frame < READ; ++frame)
+				std::copy_n(stemSamples_.data() + frame * STEM_CHANNELS, STEM_CHANNELS, samples + frame * CHANNEL_COUNT + stem * STEM_CHANNELS);
+		}
+
+		position_ += READ;
+		return READ;
+	}
+
+	void StemSampleSource::seek(sf::Uint64 frame)
+	{
+		position_ = std::min(frame, frameCount_);
+		for (auto& stem : stems_)
+			stem->seek(std::min(position_, stem->getFrameCount()));
+	}
+
+	sf::Uint64 StemSampleSource::getFrameCount() const
+	{
+		return frameCount_;
+	}
+
+	unsigned int StemSampleSource::getChannelCount() const
+	{
+		return getStemChannelCount() * static_cast<unsigned int>(stems_.size());
+	}
+
+	unsigned int StemSampleSource::getSampleRate() const
+	{
+		return (stems_.empty()) ? 0 : stems_.front()->getSampleRate();
+	}
+}
\ No newline at end of file